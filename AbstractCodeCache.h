@@ -0,0 +1,52 @@
+/* Copyright 2016-2022 Matt Evans
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ABSTRACT_CODE_CACHE_H
+#define ABSTRACT_CODE_CACHE_H
+
+#include "types.h"
+
+/* Interface for things caching derived forms of guest code (e.g. predecoded
+ * instructions), so that the MMU can tell them when code is overwritten.
+ *
+ * Addresses are host VAs of direct-mapped memory, i.e. what the uTLB holds,
+ * so this doesn't see writes to IO.
+ */
+class AbstractCodeCache
+{
+	////////////////////////////////////////////////////////////////////////////////
+protected:
+	// Cannot be constructed, except for by subclasses
+	AbstractCodeCache() {};
+
+	////////////////////////////////////////////////////////////////////////////////
+public:
+	/* Is anything cached from the given (page-aligned) host page? */
+	virtual bool	isCodePage(u64 host_page) = 0;
+	/* Host memory in [host_addr, host_addr+len) has been/is about to be written: */
+	virtual void	invalidateHostRange(u64 host_addr, unsigned int len) = 0;
+	/* Everything is stale (e.g. the I-cache was invalidated): */
+	virtual void	invalidateAll() = 0;
+};
+
+#endif
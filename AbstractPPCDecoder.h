@@ -32,12 +32,25 @@
 
 typedef void * RET_TYPE;
 
+#if ENABLE_THREADED
+/* Threaded dispatch:  a predecode thunk goes straight on to the next
+ * instruction (via T::pd_next()) instead of returning to the run loop.
+ */
+#define PD_CALL(t, call)	do { (call); return (t)->template pd_next<trace_variant>(); } while(0)
+#else
+#define PD_CALL(t, call)	return (call)
+#endif
+
 template<class T>
 class AbstractPPCDecoder
 {
 public:
         AbstractPPCDecoder() {};
 
+	/* The trace_variant parameter selects which variant of the op_xxx()
+	 * handlers to call (see log.h):
+	 */
+	template <bool trace_variant>
 	void	*decode(u32 inst)
 	{
 		unsigned int opcode = getOpcode(inst);
@@ -47,6 +60,43 @@ public:
 		return static_cast<T*>(this)->op_unk(inst);
 	}
 
+#if ENABLE_PREDECODE
+	/* A predecoded instruction:  the fields are extracted once, and fn is
+	 * a thunk that calls the corresponding op_xxx() with them.  The
+	 * (generated) thunks just shuffle f[] into arguments, so
+	 * dispatching is one indirect call rather than the decode switch.
+	 *
+	 * tag is owned by whoever caches these (i.e. it's used to say whether
+	 * the entry is valid).
+	 */
+	typedef struct predecoded {
+		RET_TYPE	(*fn)(T *t, const struct predecoded *pd);
+		u32		inst;
+		u32		tag;
+		int		f[6];
+	} predecoded_t;
+
+	template <bool trace_variant>
+	void	predecode(u32 inst, predecoded_t *pd)
+	{
+		unsigned int opcode = getOpcode(inst);
+
+		pd->inst = inst;
+#include "AbstractPPCDecoder_predecoder.h"
+		pd->fn = &pd_op_unk<trace_variant>;
+	}
+#endif
+
+protected:
+#if ENABLE_PREDECODE
+	/* Predecode thunks, one per op_xxx().  (The derived class can compare
+	 * a predecoded_t's fn against these to see what it is.)
+	 */
+#include "AbstractPPCDecoder_predecode_fns.h"
+	template <bool trace_variant>
+	static RET_TYPE	pd_op_unk(T *t, const predecoded_t *pd) { PD_CALL(t, t->op_unk(pd->inst)); }
+#endif
+
 private:
 	/* Field utility accessors for decode table above: */
 #include "PPCInstructionFields.h"
@@ -0,0 +1,228 @@
+switch(opcode) {
+	case 0x003: /* 3 */	return static_cast<T*>(this)->template op_twi<trace_variant>(D_TO(inst), D_RA(inst), D_SI(inst)); 	break;  /* D-form */
+	case 0x005: /* 5 */	if (X_XOPC(inst) == 69) { return static_cast<T*>(this)->template op_DEBUG<trace_variant>(X_RA(inst)); } 	break;  /* X-form */
+	case 0x007: /* 7 */	return static_cast<T*>(this)->template op_mulli<trace_variant>(D_RA(inst), D_SI(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x008: /* 8 */	return static_cast<T*>(this)->template op_subfic<trace_variant>(D_RA(inst), D_SI(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x00a: /* 10 */	return static_cast<T*>(this)->template op_cmpli<trace_variant>(D_BF(inst), D_RA(inst), D_UI(inst)); 	break;  /* D-form */
+	case 0x00b: /* 11 */	return static_cast<T*>(this)->template op_cmpi<trace_variant>(D_BF(inst), D_RA(inst), D_SI(inst)); 	break;  /* D-form */
+	case 0x00c: /* 12 */	return static_cast<T*>(this)->template op_addic<trace_variant>(D_RA(inst), D_SI(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x00d: /* 13 */	return static_cast<T*>(this)->template op_addic_rc<trace_variant>(D_RA(inst), D_SI(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x00e: /* 14 */	if (D_RA(inst) == 0) { return static_cast<T*>(this)->template op_li<trace_variant>(D_SI(inst), D_RT(inst)); } return static_cast<T*>(this)->template op_addi<trace_variant>(D_RA0(inst), D_SI(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x00f: /* 15 */	if (D_RA(inst) == 0) { return static_cast<T*>(this)->template op_lis<trace_variant>(D_SI(inst), D_RT(inst)); } return static_cast<T*>(this)->template op_addis<trace_variant>(D_RA0(inst), D_SI(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x010: /* 16 */	return static_cast<T*>(this)->template op_bc<trace_variant>(B_BO(inst), B_BI(inst), B_BD(inst), B_AA(inst), B_LK(inst)); 	break;  /* B-form */
+	case 0x011: /* 17 */	if (SC_XOPC(inst) == 1) { return static_cast<T*>(this)->template op_sc<trace_variant>(SC_LEV(inst)); } 	break;  /* SC-form */
+	case 0x012: /* 18 */	return static_cast<T*>(this)->template op_b<trace_variant>(I_LI(inst), I_AA(inst), I_LK(inst)); 	break;  /* I-form */
+	case 0x013: /* 19 */ {
+		switch(XL_XOPC(inst)) {
+			case 0x000: /* 0 */	return static_cast<T*>(this)->template op_mcrf<trace_variant>(XL_BF(inst), XL_BFA(inst)); 	break;  /* XL-form */
+			case 0x010: /* 16 */	if ((XL_BO(inst) & 0x14) == 0x14 && XL_LK(inst) == 0) { return static_cast<T*>(this)->template op_blr<trace_variant>(); } return static_cast<T*>(this)->template op_bclr<trace_variant>(XL_BO(inst), XL_BI(inst), XL_BH(inst), XL_LK(inst)); 	break;  /* XL-form */
+			case 0x021: /* 33 */	return static_cast<T*>(this)->template op_crnor<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x032: /* 50 */	return static_cast<T*>(this)->template op_rfi<trace_variant>(); 	break;  /* XL-form */
+			case 0x081: /* 129 */	return static_cast<T*>(this)->template op_crandc<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x096: /* 150 */	return static_cast<T*>(this)->template op_isync<trace_variant>(); 	break;  /* XL-form */
+			case 0x0c1: /* 193 */	return static_cast<T*>(this)->template op_crxor<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x0e1: /* 225 */	return static_cast<T*>(this)->template op_crnand<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x101: /* 257 */	return static_cast<T*>(this)->template op_crand<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x121: /* 289 */	return static_cast<T*>(this)->template op_creqv<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x1a1: /* 417 */	return static_cast<T*>(this)->template op_crorc<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x1c1: /* 449 */	return static_cast<T*>(this)->template op_cror<trace_variant>(XL_BT(inst), XL_BA(inst), XL_BB(inst)); 	break;  /* XL-form */
+			case 0x210: /* 528 */	if ((XL_BO(inst) & 0x14) == 0x14 && XL_LK(inst) == 0) { return static_cast<T*>(this)->template op_bctr<trace_variant>(); } return static_cast<T*>(this)->template op_bcctr<trace_variant>(XL_BO(inst), XL_BI(inst), XL_BH(inst), XL_LK(inst)); 	break;  /* XL-form */
+			default: break;
+		}
+	} break;
+	case 0x014: /* 20 */	return static_cast<T*>(this)->template op_rlwimi<trace_variant>(M_RA(inst), M_RS(inst), M_SH(inst), M_MB(inst), M_ME(inst), M_Rc(inst)); 	break;  /* M-form */
+	case 0x015: /* 21 */	if (M_MB(inst) == 0 && M_ME(inst) == 31 - M_SH(inst) && M_Rc(inst) == 0) { return static_cast<T*>(this)->template op_slwi<trace_variant>(M_RS(inst), M_SH(inst), M_RA(inst)); } if (M_ME(inst) == 31 && M_SH(inst) + M_MB(inst) == 32 && M_Rc(inst) == 0) { return static_cast<T*>(this)->template op_srwi<trace_variant>(M_RS(inst), M_MB(inst), M_RA(inst)); } if (M_SH(inst) == 0 && M_ME(inst) == 31 && M_Rc(inst) == 0) { return static_cast<T*>(this)->template op_clrlwi<trace_variant>(M_RS(inst), M_MB(inst), M_RA(inst)); } return static_cast<T*>(this)->template op_rlwinm<trace_variant>(M_RS(inst), M_SH(inst), M_MB(inst), M_ME(inst), M_RA(inst), M_Rc(inst)); 	break;  /* M-form */
+	case 0x017: /* 23 */	return static_cast<T*>(this)->template op_rlwnm<trace_variant>(M_RB(inst), M_RS(inst), M_MB(inst), M_ME(inst), M_RA(inst), M_Rc(inst)); 	break;  /* M-form */
+	case 0x018: /* 24 */	if (D_RS(inst) == 0 && D_RA(inst) == 0 && D_UI(inst) == 0) { return static_cast<T*>(this)->template op_nop<trace_variant>(); } return static_cast<T*>(this)->template op_ori<trace_variant>(D_RS(inst), D_UI(inst), D_RA(inst)); 	break;  /* D-form */
+	case 0x019: /* 25 */	return static_cast<T*>(this)->template op_oris<trace_variant>(D_RS(inst), D_UI(inst), D_RA(inst)); 	break;  /* D-form */
+	case 0x01a: /* 26 */	return static_cast<T*>(this)->template op_xori<trace_variant>(D_RS(inst), D_UI(inst), D_RA(inst)); 	break;  /* D-form */
+	case 0x01b: /* 27 */	return static_cast<T*>(this)->template op_xoris<trace_variant>(D_RS(inst), D_UI(inst), D_RA(inst)); 	break;  /* D-form */
+	case 0x01c: /* 28 */	return static_cast<T*>(this)->template op_andi_rc<trace_variant>(D_RS(inst), D_UI(inst), D_RA(inst)); 	break;  /* D-form */
+	case 0x01d: /* 29 */	return static_cast<T*>(this)->template op_andis_rc<trace_variant>(D_RS(inst), D_UI(inst), D_RA(inst)); 	break;  /* D-form */
+	case 0x01f: /* 31 */ {
+		switch(X_XOPC(inst)) {
+			case 0x000: /* 0 */	return static_cast<T*>(this)->template op_cmp<trace_variant>(X_BF(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x004: /* 4 */	return static_cast<T*>(this)->template op_tw<trace_variant>(X_TO(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x008: /* 8 */
+			case 0x208: /* 1032 */	return static_cast<T*>(this)->template op_subfc<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x00a: /* 10 */
+			case 0x20a: /* 1034 */	return static_cast<T*>(this)->template op_addc<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x00b: /* 11 */	return static_cast<T*>(this)->template op_mulhwu<trace_variant>(X_RA(inst), X_RB(inst), X_RT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x013: /* 19 */	return static_cast<T*>(this)->template op_mfcr<trace_variant>(XFX_RT(inst)); 	break;  /* XFX-form */
+			case 0x014: /* 20 */	return static_cast<T*>(this)->template op_lwarx<trace_variant>(X_RA0(inst), X_RB(inst), X_EH(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x016: /* 22 */	return static_cast<T*>(this)->template op_icbt<trace_variant>(X_CT(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x017: /* 23 */	return static_cast<T*>(this)->template op_lwzx<trace_variant>(X_RA0(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x018: /* 24 */	return static_cast<T*>(this)->template op_slw<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x01a: /* 26 */	return static_cast<T*>(this)->template op_cntlzw<trace_variant>(X_RS(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x01c: /* 28 */	return static_cast<T*>(this)->template op_and<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x020: /* 32 */	return static_cast<T*>(this)->template op_cmpl<trace_variant>(X_BF(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x028: /* 40 */
+			case 0x228: /* 1064 */	return static_cast<T*>(this)->template op_subf<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x036: /* 54 */	return static_cast<T*>(this)->template op_dcbst<trace_variant>(X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x037: /* 55 */	return static_cast<T*>(this)->template op_lwzux<trace_variant>(X_RA(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x03c: /* 60 */	return static_cast<T*>(this)->template op_andc<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x04b: /* 75 */	return static_cast<T*>(this)->template op_mulhw<trace_variant>(X_RA(inst), X_RB(inst), X_RT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x053: /* 83 */	return static_cast<T*>(this)->template op_mfmsr<trace_variant>(X_RT(inst)); 	break;  /* X-form */
+			case 0x056: /* 86 */	return static_cast<T*>(this)->template op_dcbf<trace_variant>(X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x057: /* 87 */	return static_cast<T*>(this)->template op_lbzx<trace_variant>(X_RA0(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x068: /* 104 */
+			case 0x268: /* 1128 */	return static_cast<T*>(this)->template op_neg<trace_variant>(XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x077: /* 119 */	return static_cast<T*>(this)->template op_lbzux<trace_variant>(X_RA(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x07c: /* 124 */	return static_cast<T*>(this)->template op_nor<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x088: /* 136 */
+			case 0x288: /* 1160 */	return static_cast<T*>(this)->template op_subfe<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x08a: /* 138 */
+			case 0x28a: /* 1162 */	return static_cast<T*>(this)->template op_adde<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x090: /* 144 */	return static_cast<T*>(this)->template op_mtcrf<trace_variant>(XFX_FXM(inst), XFX_RS(inst)); 	break;  /* XFX-form */
+			case 0x092: /* 146 */	return static_cast<T*>(this)->template op_mtmsr<trace_variant>(X_RS(inst)); 	break;  /* X-form */
+			case 0x096: /* 150 */	return static_cast<T*>(this)->template op_stwcx<trace_variant>(X_RS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x097: /* 151 */	return static_cast<T*>(this)->template op_stwx<trace_variant>(X_RS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x0b7: /* 183 */	return static_cast<T*>(this)->template op_stwux<trace_variant>(X_RS(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x0c8: /* 200 */
+			case 0x2c8: /* 1224 */	return static_cast<T*>(this)->template op_subfze<trace_variant>(XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x0ca: /* 202 */
+			case 0x2ca: /* 1226 */	return static_cast<T*>(this)->template op_addze<trace_variant>(XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x0d2: /* 210 */	return static_cast<T*>(this)->template op_mtsr<trace_variant>(X_SR(inst), X_RS(inst)); 	break;  /* X-form */
+			case 0x0d7: /* 215 */	return static_cast<T*>(this)->template op_stbx<trace_variant>(X_RS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x0e8: /* 232 */
+			case 0x2e8: /* 1256 */	return static_cast<T*>(this)->template op_subfme<trace_variant>(XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x0ea: /* 234 */
+			case 0x2ea: /* 1258 */	return static_cast<T*>(this)->template op_addme<trace_variant>(XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x0eb: /* 235 */
+			case 0x2eb: /* 1259 */	return static_cast<T*>(this)->template op_mullw<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x0f2: /* 242 */	return static_cast<T*>(this)->template op_mtsrin<trace_variant>(X_RS(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x0f6: /* 246 */	return static_cast<T*>(this)->template op_dcbtst<trace_variant>(X_RA0(inst), X_RB(inst), X_TH(inst)); 	break;  /* X-form */
+			case 0x0f7: /* 247 */	return static_cast<T*>(this)->template op_stbux<trace_variant>(X_RS(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x10a: /* 266 */
+			case 0x30a: /* 1290 */	return static_cast<T*>(this)->template op_add<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x112: /* 274 */	return static_cast<T*>(this)->template op_tlbiel<trace_variant>(X_RB(inst), X_L(inst)); 	break;  /* X-form */
+			case 0x116: /* 278 */	return static_cast<T*>(this)->template op_dcbt<trace_variant>(X_RA0(inst), X_RB(inst), X_TH(inst)); 	break;  /* X-form */
+			case 0x117: /* 279 */	return static_cast<T*>(this)->template op_lhzx<trace_variant>(X_RA0(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x11c: /* 284 */	return static_cast<T*>(this)->template op_eqv<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x132: /* 306 */	return static_cast<T*>(this)->template op_tlbie<trace_variant>(X_RB(inst), X_L(inst)); 	break;  /* X-form */
+			case 0x137: /* 311 */	return static_cast<T*>(this)->template op_lhzux<trace_variant>(X_RA(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x13c: /* 316 */	return static_cast<T*>(this)->template op_xor<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x153: /* 339 */	return static_cast<T*>(this)->template op_mfspr<trace_variant>(XFX_spr(inst), XFX_RT(inst)); 	break;  /* XFX-form */
+			case 0x157: /* 343 */	return static_cast<T*>(this)->template op_lhax<trace_variant>(X_RA0(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x172: /* 370 */	return static_cast<T*>(this)->template op_tlbia<trace_variant>(); 	break;  /* X-form */
+			case 0x173: /* 371 */	return static_cast<T*>(this)->template op_mftb<trace_variant>(XFX_spr(inst), XFX_RT(inst)); 	break;  /* XFX-form */
+			case 0x177: /* 375 */	return static_cast<T*>(this)->template op_lhaux<trace_variant>(X_RA(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x197: /* 407 */	return static_cast<T*>(this)->template op_sthx<trace_variant>(X_RS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x19c: /* 412 */	return static_cast<T*>(this)->template op_orc<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x1b7: /* 439 */	return static_cast<T*>(this)->template op_sthux<trace_variant>(X_RS(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x1bc: /* 444 */	if (X_RS(inst) == X_RB(inst) && X_Rc(inst) == 0) { return static_cast<T*>(this)->template op_mr<trace_variant>(X_RS(inst), X_RA(inst)); } return static_cast<T*>(this)->template op_or<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x1cb: /* 459 */
+			case 0x3cb: /* 1483 */	return static_cast<T*>(this)->template op_divwu<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x1d3: /* 467 */	return static_cast<T*>(this)->template op_mtspr<trace_variant>(XFX_spr(inst), XFX_RS(inst)); 	break;  /* XFX-form */
+			case 0x1d6: /* 470 */	return static_cast<T*>(this)->template op_dcbi<trace_variant>(X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x1dc: /* 476 */	return static_cast<T*>(this)->template op_nand<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x1eb: /* 491 */
+			case 0x3eb: /* 1515 */	return static_cast<T*>(this)->template op_divw<trace_variant>(XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); 	break;  /* XO-form */
+			case 0x200: /* 512 */	return static_cast<T*>(this)->template op_mcrxr<trace_variant>(X_BF(inst)); 	break;  /* X-form */
+			case 0x215: /* 533 */	return static_cast<T*>(this)->template op_lswx<trace_variant>(X_RT(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x216: /* 534 */	return static_cast<T*>(this)->template op_lwbrx<trace_variant>(X_RA0(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x217: /* 535 */	return static_cast<T*>(this)->template op_lfsx<trace_variant>(X_RA0(inst), X_RB(inst), X_FRT(inst)); 	break;  /* X-form */
+			case 0x218: /* 536 */	return static_cast<T*>(this)->template op_srw<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x236: /* 566 */	return static_cast<T*>(this)->template op_tlbsync<trace_variant>(); 	break;  /* X-form */
+			case 0x237: /* 567 */	return static_cast<T*>(this)->template op_lfsux<trace_variant>(X_RA(inst), X_RB(inst), X_FRT(inst)); 	break;  /* X-form */
+			case 0x253: /* 595 */	return static_cast<T*>(this)->template op_mfsr<trace_variant>(X_SR(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x255: /* 597 */	return static_cast<T*>(this)->template op_lswi<trace_variant>(X_RT(inst), X_RA0(inst), X_NB(inst)); 	break;  /* X-form */
+			case 0x256: /* 598 */	return static_cast<T*>(this)->template op_sync<trace_variant>(X_L(inst), X_E(inst)); 	break;  /* X-form */
+			case 0x257: /* 599 */	return static_cast<T*>(this)->template op_lfdx<trace_variant>(X_RA0(inst), X_RB(inst), X_FRT(inst)); 	break;  /* X-form */
+			case 0x277: /* 631 */	return static_cast<T*>(this)->template op_lfdux<trace_variant>(X_RA(inst), X_RB(inst), X_FRT(inst)); 	break;  /* X-form */
+			case 0x293: /* 659 */	return static_cast<T*>(this)->template op_mfsrin<trace_variant>(X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x295: /* 661 */	return static_cast<T*>(this)->template op_stswx<trace_variant>(X_RS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x296: /* 662 */	return static_cast<T*>(this)->template op_stwbrx<trace_variant>(X_RS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x297: /* 663 */	return static_cast<T*>(this)->template op_stfsx<trace_variant>(X_FRS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x2b7: /* 695 */	return static_cast<T*>(this)->template op_stfsux<trace_variant>(X_FRS(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x2d5: /* 725 */	return static_cast<T*>(this)->template op_stswi<trace_variant>(X_RS(inst), X_RA0(inst), X_NB(inst)); 	break;  /* X-form */
+			case 0x2d7: /* 727 */	return static_cast<T*>(this)->template op_stfdx<trace_variant>(X_FRS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x2f6: /* 758 */	return static_cast<T*>(this)->template op_dcba<trace_variant>(X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x2f7: /* 759 */	return static_cast<T*>(this)->template op_stfdux<trace_variant>(X_FRS(inst), X_RA(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x316: /* 790 */	return static_cast<T*>(this)->template op_lhbrx<trace_variant>(X_RA0(inst), X_RB(inst), X_RT(inst)); 	break;  /* X-form */
+			case 0x318: /* 792 */	return static_cast<T*>(this)->template op_sraw<trace_variant>(X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x338: /* 824 */	return static_cast<T*>(this)->template op_srawi<trace_variant>(X_RS(inst), X_SH(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x356: /* 854 */	return static_cast<T*>(this)->template op_eieio<trace_variant>(); 	break;  /* X-form */
+			case 0x396: /* 918 */	return static_cast<T*>(this)->template op_sthbrx<trace_variant>(X_RS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x39a: /* 922 */	return static_cast<T*>(this)->template op_extsh<trace_variant>(X_RS(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x3ba: /* 954 */	return static_cast<T*>(this)->template op_extsb<trace_variant>(X_RS(inst), X_RA(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x3d6: /* 982 */	return static_cast<T*>(this)->template op_icbi<trace_variant>(X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x3d7: /* 983 */	return static_cast<T*>(this)->template op_stfiwx<trace_variant>(X_FRS(inst), X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			case 0x3f6: /* 1014 */	return static_cast<T*>(this)->template op_dcbz<trace_variant>(X_RA0(inst), X_RB(inst)); 	break;  /* X-form */
+			default: break;
+		}
+	} break;
+	case 0x020: /* 32 */	return static_cast<T*>(this)->template op_lwz<trace_variant>(D_RA0(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x021: /* 33 */	return static_cast<T*>(this)->template op_lwzu<trace_variant>(D_RA(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x022: /* 34 */	return static_cast<T*>(this)->template op_lbz<trace_variant>(D_RA0(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x023: /* 35 */	return static_cast<T*>(this)->template op_lbzu<trace_variant>(D_RA(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x024: /* 36 */	return static_cast<T*>(this)->template op_stw<trace_variant>(D_RS(inst), D_RA0(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x025: /* 37 */	return static_cast<T*>(this)->template op_stwu<trace_variant>(D_RS(inst), D_RA(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x026: /* 38 */	return static_cast<T*>(this)->template op_stb<trace_variant>(D_RS(inst), D_RA0(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x027: /* 39 */	return static_cast<T*>(this)->template op_stbu<trace_variant>(D_RS(inst), D_RA(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x028: /* 40 */	return static_cast<T*>(this)->template op_lhz<trace_variant>(D_RA0(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x029: /* 41 */	return static_cast<T*>(this)->template op_lhzu<trace_variant>(D_RA(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x02a: /* 42 */	return static_cast<T*>(this)->template op_lha<trace_variant>(D_RA0(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x02b: /* 43 */	return static_cast<T*>(this)->template op_lhau<trace_variant>(D_RA(inst), D_D(inst), D_RT(inst)); 	break;  /* D-form */
+	case 0x02c: /* 44 */	return static_cast<T*>(this)->template op_sth<trace_variant>(D_RS(inst), D_RA0(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x02d: /* 45 */	return static_cast<T*>(this)->template op_sthu<trace_variant>(D_RS(inst), D_RA(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x02e: /* 46 */	return static_cast<T*>(this)->template op_lmw<trace_variant>(D_RT(inst), D_D(inst), D_RA0(inst)); 	break;  /* D-form */
+	case 0x02f: /* 47 */	return static_cast<T*>(this)->template op_stmw<trace_variant>(D_RS(inst), D_D(inst), D_RA0(inst)); 	break;  /* D-form */
+	case 0x030: /* 48 */	return static_cast<T*>(this)->template op_lfs<trace_variant>(D_RA0(inst), D_D(inst), D_FRT(inst)); 	break;  /* D-form */
+	case 0x031: /* 49 */	return static_cast<T*>(this)->template op_lfsu<trace_variant>(D_RA(inst), D_D(inst), D_FRT(inst)); 	break;  /* D-form */
+	case 0x032: /* 50 */	return static_cast<T*>(this)->template op_lfd<trace_variant>(D_RA0(inst), D_D(inst), D_FRT(inst)); 	break;  /* D-form */
+	case 0x033: /* 51 */	return static_cast<T*>(this)->template op_lfdu<trace_variant>(D_RA(inst), D_D(inst), D_FRT(inst)); 	break;  /* D-form */
+	case 0x034: /* 52 */	return static_cast<T*>(this)->template op_stfs<trace_variant>(D_FRS(inst), D_RA0(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x035: /* 53 */	return static_cast<T*>(this)->template op_stfsu<trace_variant>(D_FRS(inst), D_RA(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x036: /* 54 */	return static_cast<T*>(this)->template op_stfd<trace_variant>(D_FRS(inst), D_RA0(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x037: /* 55 */	return static_cast<T*>(this)->template op_stfdu<trace_variant>(D_FRS(inst), D_RA(inst), D_D(inst)); 	break;  /* D-form */
+	case 0x03b: /* 59 */ {
+		switch(A_XOPC(inst)) {
+			case 0x012: /* 18 */	return static_cast<T*>(this)->template op_fdivs<trace_variant>(A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x014: /* 20 */	return static_cast<T*>(this)->template op_fsubs<trace_variant>(A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x015: /* 21 */	return static_cast<T*>(this)->template op_fadds<trace_variant>(A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x016: /* 22 */	return static_cast<T*>(this)->template op_fsqrts<trace_variant>(A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x018: /* 24 */	return static_cast<T*>(this)->template op_fres<trace_variant>(A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x019: /* 25 */	return static_cast<T*>(this)->template op_fmuls<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01c: /* 28 */	return static_cast<T*>(this)->template op_fmsubs<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01d: /* 29 */	return static_cast<T*>(this)->template op_fmadds<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01e: /* 30 */	return static_cast<T*>(this)->template op_fnmsubs<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01f: /* 31 */	return static_cast<T*>(this)->template op_fnmadds<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			default: break;
+		}
+	} break;
+	case 0x03f: /* 63 */ {
+		switch(X_XOPC(inst)) {
+			case 0x000: /* 0 */	return static_cast<T*>(this)->template op_fcmpu<trace_variant>(X_FRA(inst), X_FRB(inst), X_BF(inst)); 	break;  /* X-form */
+			case 0x00c: /* 12 */	return static_cast<T*>(this)->template op_frsp<trace_variant>(X_FRB(inst), X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x00e: /* 14 */	return static_cast<T*>(this)->template op_fctiw<trace_variant>(X_FRB(inst), X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x00f: /* 15 */	return static_cast<T*>(this)->template op_fctiwz<trace_variant>(X_FRB(inst), X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x020: /* 32 */	return static_cast<T*>(this)->template op_fcmpo<trace_variant>(X_FRA(inst), X_FRB(inst), X_BF(inst)); 	break;  /* X-form */
+			case 0x026: /* 38 */	return static_cast<T*>(this)->template op_mtfsb1<trace_variant>(X_BT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x028: /* 40 */	return static_cast<T*>(this)->template op_fneg<trace_variant>(X_FRB(inst), X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x040: /* 64 */	return static_cast<T*>(this)->template op_mcrfs<trace_variant>(X_BFA(inst), X_BF(inst)); 	break;  /* X-form */
+			case 0x046: /* 70 */	return static_cast<T*>(this)->template op_mtfsb0<trace_variant>(X_BT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x048: /* 72 */	return static_cast<T*>(this)->template op_fmr<trace_variant>(X_FRB(inst), X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x086: /* 134 */	return static_cast<T*>(this)->template op_mtfsfi<trace_variant>(X_U(inst), X_BF(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x088: /* 136 */	return static_cast<T*>(this)->template op_fnabs<trace_variant>(X_FRB(inst), X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x108: /* 264 */	return static_cast<T*>(this)->template op_fabs<trace_variant>(X_FRB(inst), X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x247: /* 583 */	return static_cast<T*>(this)->template op_mffs<trace_variant>(X_FRT(inst), X_Rc(inst)); 	break;  /* X-form */
+			case 0x2c7: /* 711 */	return static_cast<T*>(this)->template op_mtfsf<trace_variant>(XFL_FLM(inst), XFL_FRB(inst), XFL_Rc(inst)); 	break;  /* XFL-form */
+			default: break;
+		}
+		switch(A_XOPC(inst)) {
+			case 0x012: /* 18 */	return static_cast<T*>(this)->template op_fdiv<trace_variant>(A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x014: /* 20 */	return static_cast<T*>(this)->template op_fsub<trace_variant>(A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x015: /* 21 */	return static_cast<T*>(this)->template op_fadd<trace_variant>(A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x016: /* 22 */	return static_cast<T*>(this)->template op_fsqrt<trace_variant>(A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x017: /* 23 */	return static_cast<T*>(this)->template op_fsel<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x019: /* 25 */	return static_cast<T*>(this)->template op_fmul<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01a: /* 26 */	return static_cast<T*>(this)->template op_frsqrte<trace_variant>(A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01c: /* 28 */	return static_cast<T*>(this)->template op_fmsub<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01d: /* 29 */	return static_cast<T*>(this)->template op_fmadd<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01e: /* 30 */	return static_cast<T*>(this)->template op_fnmsub<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			case 0x01f: /* 31 */	return static_cast<T*>(this)->template op_fnmadd<trace_variant>(A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); 	break;  /* A-form */
+			default: break;
+		}
+	} break;
+}
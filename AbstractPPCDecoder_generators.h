@@ -0,0 +1,228 @@
+switch(opcode) {
+	case 0x003: /* 3 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_twi), D_TO(inst), D_RA(inst), D_SI(inst)); return 0; 	break;  /* D-form */
+	case 0x005: /* 5 */	if (X_XOPC(inst) == 69) { generate_call_int(codeptr, codelen, OP_ADDR(op_DEBUG), X_RA(inst)); return 0; } 	break;  /* X-form */
+	case 0x007: /* 7 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_mulli), D_RA(inst), D_SI(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x008: /* 8 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_subfic), D_RA(inst), D_SI(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x00a: /* 10 */	generate_call_int_int_u16(codeptr, codelen, OP_ADDR(op_cmpli), D_BF(inst), D_RA(inst), D_UI(inst)); return 0; 	break;  /* D-form */
+	case 0x00b: /* 11 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_cmpi), D_BF(inst), D_RA(inst), D_SI(inst)); return 0; 	break;  /* D-form */
+	case 0x00c: /* 12 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_addic), D_RA(inst), D_SI(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x00d: /* 13 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_addic_rc), D_RA(inst), D_SI(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x00e: /* 14 */	if (D_RA(inst) == 0) { generate_call_s16_int(codeptr, codelen, OP_ADDR(op_li), D_SI(inst), D_RT(inst)); return 0; } generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_addi), D_RA0(inst), D_SI(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x00f: /* 15 */	if (D_RA(inst) == 0) { generate_call_s16_int(codeptr, codelen, OP_ADDR(op_lis), D_SI(inst), D_RT(inst)); return 0; } generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_addis), D_RA0(inst), D_SI(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x010: /* 16 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_bc), B_BO(inst), B_BI(inst), B_BD(inst), B_AA(inst), B_LK(inst)); return 1; 	break;  /* B-form */
+	case 0x011: /* 17 */	if (SC_XOPC(inst) == 1) { generate_call_u8(codeptr, codelen, OP_ADDR(op_sc), SC_LEV(inst)); return 2; } 	break;  /* SC-form */
+	case 0x012: /* 18 */	generate_call_u32_int_int(codeptr, codelen, OP_ADDR(op_b), I_LI(inst), I_AA(inst), I_LK(inst)); return 1; 	break;  /* I-form */
+	case 0x013: /* 19 */ {
+		switch(XL_XOPC(inst)) {
+			case 0x000: /* 0 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mcrf), XL_BF(inst), XL_BFA(inst)); return 0; 	break;  /* XL-form */
+			case 0x010: /* 16 */	if ((XL_BO(inst) & 0x14) == 0x14 && XL_LK(inst) == 0) { generate_call(codeptr, codelen, OP_ADDR(op_blr)); return 1; } generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_bclr), XL_BO(inst), XL_BI(inst), XL_BH(inst), XL_LK(inst)); return 1; 	break;  /* XL-form */
+			case 0x021: /* 33 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_crnor), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x032: /* 50 */	generate_call(codeptr, codelen, OP_ADDR(op_rfi)); return 2; 	break;  /* XL-form */
+			case 0x081: /* 129 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_crandc), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x096: /* 150 */	generate_call(codeptr, codelen, OP_ADDR(op_isync)); return 0; 	break;  /* XL-form */
+			case 0x0c1: /* 193 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_crxor), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x0e1: /* 225 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_crnand), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x101: /* 257 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_crand), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x121: /* 289 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_creqv), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x1a1: /* 417 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_crorc), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x1c1: /* 449 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_cror), XL_BT(inst), XL_BA(inst), XL_BB(inst)); return 0; 	break;  /* XL-form */
+			case 0x210: /* 528 */	if ((XL_BO(inst) & 0x14) == 0x14 && XL_LK(inst) == 0) { generate_call(codeptr, codelen, OP_ADDR(op_bctr)); return 1; } generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_bcctr), XL_BO(inst), XL_BI(inst), XL_BH(inst), XL_LK(inst)); return 1; 	break;  /* XL-form */
+			default: break;
+		}
+	} break;
+	case 0x014: /* 20 */	generate_call_int_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_rlwimi), M_RA(inst), M_RS(inst), M_SH(inst), M_MB(inst), M_ME(inst), M_Rc(inst)); return 0; 	break;  /* M-form */
+	case 0x015: /* 21 */	if (M_MB(inst) == 0 && M_ME(inst) == 31 - M_SH(inst) && M_Rc(inst) == 0) { generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_slwi), M_RS(inst), M_SH(inst), M_RA(inst)); return 0; } if (M_ME(inst) == 31 && M_SH(inst) + M_MB(inst) == 32 && M_Rc(inst) == 0) { generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_srwi), M_RS(inst), M_MB(inst), M_RA(inst)); return 0; } if (M_SH(inst) == 0 && M_ME(inst) == 31 && M_Rc(inst) == 0) { generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_clrlwi), M_RS(inst), M_MB(inst), M_RA(inst)); return 0; } generate_call_int_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_rlwinm), M_RS(inst), M_SH(inst), M_MB(inst), M_ME(inst), M_RA(inst), M_Rc(inst)); return 0; 	break;  /* M-form */
+	case 0x017: /* 23 */	generate_call_int_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_rlwnm), M_RB(inst), M_RS(inst), M_MB(inst), M_ME(inst), M_RA(inst), M_Rc(inst)); return 0; 	break;  /* M-form */
+	case 0x018: /* 24 */	if (D_RS(inst) == 0 && D_RA(inst) == 0 && D_UI(inst) == 0) { generate_call(codeptr, codelen, OP_ADDR(op_nop)); return 0; } generate_call_int_u16_int(codeptr, codelen, OP_ADDR(op_ori), D_RS(inst), D_UI(inst), D_RA(inst)); return 0; 	break;  /* D-form */
+	case 0x019: /* 25 */	generate_call_int_u16_int(codeptr, codelen, OP_ADDR(op_oris), D_RS(inst), D_UI(inst), D_RA(inst)); return 0; 	break;  /* D-form */
+	case 0x01a: /* 26 */	generate_call_int_u16_int(codeptr, codelen, OP_ADDR(op_xori), D_RS(inst), D_UI(inst), D_RA(inst)); return 0; 	break;  /* D-form */
+	case 0x01b: /* 27 */	generate_call_int_u16_int(codeptr, codelen, OP_ADDR(op_xoris), D_RS(inst), D_UI(inst), D_RA(inst)); return 0; 	break;  /* D-form */
+	case 0x01c: /* 28 */	generate_call_int_u16_int(codeptr, codelen, OP_ADDR(op_andi_rc), D_RS(inst), D_UI(inst), D_RA(inst)); return 0; 	break;  /* D-form */
+	case 0x01d: /* 29 */	generate_call_int_u16_int(codeptr, codelen, OP_ADDR(op_andis_rc), D_RS(inst), D_UI(inst), D_RA(inst)); return 0; 	break;  /* D-form */
+	case 0x01f: /* 31 */ {
+		switch(X_XOPC(inst)) {
+			case 0x000: /* 0 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_cmp), X_BF(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x004: /* 4 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_tw), X_TO(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x008: /* 8 */
+			case 0x208: /* 1032 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_subfc), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x00a: /* 10 */
+			case 0x20a: /* 1034 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_addc), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x00b: /* 11 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_mulhwu), X_RA(inst), X_RB(inst), X_RT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x013: /* 19 */	generate_call_int(codeptr, codelen, OP_ADDR(op_mfcr), XFX_RT(inst)); return 0; 	break;  /* XFX-form */
+			case 0x014: /* 20 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_lwarx), X_RA0(inst), X_RB(inst), X_EH(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x016: /* 22 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_icbt), X_CT(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x017: /* 23 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lwzx), X_RA0(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x018: /* 24 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_slw), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x01a: /* 26 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_cntlzw), X_RS(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x01c: /* 28 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_and), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x020: /* 32 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_cmpl), X_BF(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x028: /* 40 */
+			case 0x228: /* 1064 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_subf), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x036: /* 54 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_dcbst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x037: /* 55 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lwzux), X_RA(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x03c: /* 60 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_andc), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x04b: /* 75 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_mulhw), X_RA(inst), X_RB(inst), X_RT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x053: /* 83 */	generate_call_int(codeptr, codelen, OP_ADDR(op_mfmsr), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x056: /* 86 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_dcbf), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x057: /* 87 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lbzx), X_RA0(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x068: /* 104 */
+			case 0x268: /* 1128 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_neg), XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x077: /* 119 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lbzux), X_RA(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x07c: /* 124 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_nor), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x088: /* 136 */
+			case 0x288: /* 1160 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_subfe), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x08a: /* 138 */
+			case 0x28a: /* 1162 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_adde), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x090: /* 144 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mtcrf), XFX_FXM(inst), XFX_RS(inst)); return 0; 	break;  /* XFX-form */
+			case 0x092: /* 146 */	generate_call_int(codeptr, codelen, OP_ADDR(op_mtmsr), X_RS(inst)); return 2; 	break;  /* X-form */
+			case 0x096: /* 150 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stwcx), X_RS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x097: /* 151 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stwx), X_RS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x0b7: /* 183 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stwux), X_RS(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x0c8: /* 200 */
+			case 0x2c8: /* 1224 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_subfze), XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x0ca: /* 202 */
+			case 0x2ca: /* 1226 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_addze), XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x0d2: /* 210 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mtsr), X_SR(inst), X_RS(inst)); return 0; 	break;  /* X-form */
+			case 0x0d7: /* 215 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stbx), X_RS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x0e8: /* 232 */
+			case 0x2e8: /* 1256 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_subfme), XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x0ea: /* 234 */
+			case 0x2ea: /* 1258 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_addme), XO_RA(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x0eb: /* 235 */
+			case 0x2eb: /* 1259 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_mullw), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x0f2: /* 242 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mtsrin), X_RS(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x0f6: /* 246 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_dcbtst), X_RA0(inst), X_RB(inst), X_TH(inst)); return 0; 	break;  /* X-form */
+			case 0x0f7: /* 247 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stbux), X_RS(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x10a: /* 266 */
+			case 0x30a: /* 1290 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_add), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x112: /* 274 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_tlbiel), X_RB(inst), X_L(inst)); return 2; 	break;  /* X-form */
+			case 0x116: /* 278 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_dcbt), X_RA0(inst), X_RB(inst), X_TH(inst)); return 0; 	break;  /* X-form */
+			case 0x117: /* 279 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lhzx), X_RA0(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x11c: /* 284 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_eqv), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x132: /* 306 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_tlbie), X_RB(inst), X_L(inst)); return 2; 	break;  /* X-form */
+			case 0x137: /* 311 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lhzux), X_RA(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x13c: /* 316 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_xor), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x153: /* 339 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mfspr), XFX_spr(inst), XFX_RT(inst)); return 0; 	break;  /* XFX-form */
+			case 0x157: /* 343 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lhax), X_RA0(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x172: /* 370 */	generate_call(codeptr, codelen, OP_ADDR(op_tlbia)); return 2; 	break;  /* X-form */
+			case 0x173: /* 371 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mftb), XFX_spr(inst), XFX_RT(inst)); return 0; 	break;  /* XFX-form */
+			case 0x177: /* 375 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lhaux), X_RA(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x197: /* 407 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_sthx), X_RS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x19c: /* 412 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_orc), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x1b7: /* 439 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_sthux), X_RS(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x1bc: /* 444 */	if (X_RS(inst) == X_RB(inst) && X_Rc(inst) == 0) { generate_call_int_int(codeptr, codelen, OP_ADDR(op_mr), X_RS(inst), X_RA(inst)); return 0; } generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_or), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x1cb: /* 459 */
+			case 0x3cb: /* 1483 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_divwu), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x1d3: /* 467 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mtspr), XFX_spr(inst), XFX_RS(inst)); return 0; 	break;  /* XFX-form */
+			case 0x1d6: /* 470 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_dcbi), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x1dc: /* 476 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_nand), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x1eb: /* 491 */
+			case 0x3eb: /* 1515 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_divw), XO_RA(inst), XO_RB(inst), XO_RT(inst), XO_Rc(inst), XO_OE(inst)); return 0; 	break;  /* XO-form */
+			case 0x200: /* 512 */	generate_call_int(codeptr, codelen, OP_ADDR(op_mcrxr), X_BF(inst)); return 0; 	break;  /* X-form */
+			case 0x215: /* 533 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lswx), X_RT(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x216: /* 534 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lwbrx), X_RA0(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x217: /* 535 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lfsx), X_RA0(inst), X_RB(inst), X_FRT(inst)); return 0; 	break;  /* X-form */
+			case 0x218: /* 536 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_srw), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x236: /* 566 */	generate_call(codeptr, codelen, OP_ADDR(op_tlbsync)); return 2; 	break;  /* X-form */
+			case 0x237: /* 567 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lfsux), X_RA(inst), X_RB(inst), X_FRT(inst)); return 0; 	break;  /* X-form */
+			case 0x253: /* 595 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mfsr), X_SR(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x255: /* 597 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lswi), X_RT(inst), X_RA0(inst), X_NB(inst)); return 0; 	break;  /* X-form */
+			case 0x256: /* 598 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_sync), X_L(inst), X_E(inst)); return 0; 	break;  /* X-form */
+			case 0x257: /* 599 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lfdx), X_RA0(inst), X_RB(inst), X_FRT(inst)); return 0; 	break;  /* X-form */
+			case 0x277: /* 631 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lfdux), X_RA(inst), X_RB(inst), X_FRT(inst)); return 0; 	break;  /* X-form */
+			case 0x293: /* 659 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mfsrin), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x295: /* 661 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stswx), X_RS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x296: /* 662 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stwbrx), X_RS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x297: /* 663 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stfsx), X_FRS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x2b7: /* 695 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stfsux), X_FRS(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x2d5: /* 725 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stswi), X_RS(inst), X_RA0(inst), X_NB(inst)); return 0; 	break;  /* X-form */
+			case 0x2d7: /* 727 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stfdx), X_FRS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x2f6: /* 758 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_dcba), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x2f7: /* 759 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stfdux), X_FRS(inst), X_RA(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x316: /* 790 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_lhbrx), X_RA0(inst), X_RB(inst), X_RT(inst)); return 0; 	break;  /* X-form */
+			case 0x318: /* 792 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_sraw), X_RS(inst), X_RB(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x338: /* 824 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_srawi), X_RS(inst), X_SH(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x356: /* 854 */	generate_call(codeptr, codelen, OP_ADDR(op_eieio)); return 0; 	break;  /* X-form */
+			case 0x396: /* 918 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_sthbrx), X_RS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x39a: /* 922 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_extsh), X_RS(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x3ba: /* 954 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_extsb), X_RS(inst), X_RA(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x3d6: /* 982 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_icbi), X_RA0(inst), X_RB(inst)); return 2; 	break;  /* X-form */
+			case 0x3d7: /* 983 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_stfiwx), X_FRS(inst), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			case 0x3f6: /* 1014 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_dcbz), X_RA0(inst), X_RB(inst)); return 0; 	break;  /* X-form */
+			default: break;
+		}
+	} break;
+	case 0x020: /* 32 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lwz), D_RA0(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x021: /* 33 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lwzu), D_RA(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x022: /* 34 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lbz), D_RA0(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x023: /* 35 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lbzu), D_RA(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x024: /* 36 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stw), D_RS(inst), D_RA0(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x025: /* 37 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stwu), D_RS(inst), D_RA(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x026: /* 38 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stb), D_RS(inst), D_RA0(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x027: /* 39 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stbu), D_RS(inst), D_RA(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x028: /* 40 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lhz), D_RA0(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x029: /* 41 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lhzu), D_RA(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x02a: /* 42 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lha), D_RA0(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x02b: /* 43 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lhau), D_RA(inst), D_D(inst), D_RT(inst)); return 0; 	break;  /* D-form */
+	case 0x02c: /* 44 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_sth), D_RS(inst), D_RA0(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x02d: /* 45 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_sthu), D_RS(inst), D_RA(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x02e: /* 46 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lmw), D_RT(inst), D_D(inst), D_RA0(inst)); return 0; 	break;  /* D-form */
+	case 0x02f: /* 47 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_stmw), D_RS(inst), D_D(inst), D_RA0(inst)); return 0; 	break;  /* D-form */
+	case 0x030: /* 48 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lfs), D_RA0(inst), D_D(inst), D_FRT(inst)); return 0; 	break;  /* D-form */
+	case 0x031: /* 49 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lfsu), D_RA(inst), D_D(inst), D_FRT(inst)); return 0; 	break;  /* D-form */
+	case 0x032: /* 50 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lfd), D_RA0(inst), D_D(inst), D_FRT(inst)); return 0; 	break;  /* D-form */
+	case 0x033: /* 51 */	generate_call_int_s16_int(codeptr, codelen, OP_ADDR(op_lfdu), D_RA(inst), D_D(inst), D_FRT(inst)); return 0; 	break;  /* D-form */
+	case 0x034: /* 52 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stfs), D_FRS(inst), D_RA0(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x035: /* 53 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stfsu), D_FRS(inst), D_RA(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x036: /* 54 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stfd), D_FRS(inst), D_RA0(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x037: /* 55 */	generate_call_int_int_s16(codeptr, codelen, OP_ADDR(op_stfdu), D_FRS(inst), D_RA(inst), D_D(inst)); return 0; 	break;  /* D-form */
+	case 0x03b: /* 59 */ {
+		switch(A_XOPC(inst)) {
+			case 0x012: /* 18 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fdivs), A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x014: /* 20 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fsubs), A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x015: /* 21 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fadds), A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x016: /* 22 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fsqrts), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x018: /* 24 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fres), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x019: /* 25 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fmuls), A_FRA(inst), A_FRC(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01c: /* 28 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fmsubs), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01d: /* 29 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fmadds), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01e: /* 30 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fnmsubs), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01f: /* 31 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fnmadds), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			default: break;
+		}
+	} break;
+	case 0x03f: /* 63 */ {
+		switch(X_XOPC(inst)) {
+			case 0x000: /* 0 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fcmpu), X_FRA(inst), X_FRB(inst), X_BF(inst)); return 0; 	break;  /* X-form */
+			case 0x00c: /* 12 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_frsp), X_FRB(inst), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x00e: /* 14 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fctiw), X_FRB(inst), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x00f: /* 15 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fctiwz), X_FRB(inst), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x020: /* 32 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fcmpo), X_FRA(inst), X_FRB(inst), X_BF(inst)); return 0; 	break;  /* X-form */
+			case 0x026: /* 38 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mtfsb1), X_BT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x028: /* 40 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fneg), X_FRB(inst), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x040: /* 64 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mcrfs), X_BFA(inst), X_BF(inst)); return 0; 	break;  /* X-form */
+			case 0x046: /* 70 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mtfsb0), X_BT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x048: /* 72 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fmr), X_FRB(inst), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x086: /* 134 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_mtfsfi), X_U(inst), X_BF(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x088: /* 136 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fnabs), X_FRB(inst), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x108: /* 264 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fabs), X_FRB(inst), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x247: /* 583 */	generate_call_int_int(codeptr, codelen, OP_ADDR(op_mffs), X_FRT(inst), X_Rc(inst)); return 0; 	break;  /* X-form */
+			case 0x2c7: /* 711 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_mtfsf), XFL_FLM(inst), XFL_FRB(inst), XFL_Rc(inst)); return 0; 	break;  /* XFL-form */
+			default: break;
+		}
+		switch(A_XOPC(inst)) {
+			case 0x012: /* 18 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fdiv), A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x014: /* 20 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fsub), A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x015: /* 21 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fadd), A_FRA(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x016: /* 22 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_fsqrt), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x017: /* 23 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fsel), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x019: /* 25 */	generate_call_int_int_int_int(codeptr, codelen, OP_ADDR(op_fmul), A_FRA(inst), A_FRC(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01a: /* 26 */	generate_call_int_int_int(codeptr, codelen, OP_ADDR(op_frsqrte), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01c: /* 28 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fmsub), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01d: /* 29 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fmadd), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01e: /* 30 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fnmsub), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			case 0x01f: /* 31 */	generate_call_int_int_int_int_int(codeptr, codelen, OP_ADDR(op_fnmadd), A_FRA(inst), A_FRC(inst), A_FRB(inst), A_FRT(inst), A_Rc(inst)); return 0; 	break;  /* A-form */
+			default: break;
+		}
+	} break;
+}
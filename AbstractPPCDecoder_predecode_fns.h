@@ -0,0 +1,198 @@
+template <bool trace_variant> static RET_TYPE pd_op_add(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_add<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_addc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_addc<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_adde(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_adde<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_addi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_addi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_li(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_li<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_addis(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_addis<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lis(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lis<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_addic(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_addic<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_addic_rc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_addic_rc<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_addme(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_addme<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_addze(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_addze<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_and(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_and<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_andc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_andc<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_andi_rc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_andi_rc<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_andis_rc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_andis_rc<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_b(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_b<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_bc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_bc<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_bclr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_bclr<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_blr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_blr<trace_variant>()); }
+template <bool trace_variant> static RET_TYPE pd_op_bcctr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_bcctr<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_bctr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_bctr<trace_variant>()); }
+template <bool trace_variant> static RET_TYPE pd_op_cmp(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_cmp<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_cmpi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_cmpi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_cmpl(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_cmpl<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_cmpli(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_cmpli<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_cntlzw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_cntlzw<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_crand(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_crand<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_crandc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_crandc<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_creqv(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_creqv<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_crnand(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_crnand<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_crnor(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_crnor<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_cror(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_cror<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_crorc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_crorc<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_crxor(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_crxor<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_divw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_divw<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_divwu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_divwu<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_eieio(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_eieio<trace_variant>()); }
+template <bool trace_variant> static RET_TYPE pd_op_eqv(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_eqv<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_extsb(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_extsb<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_extsh(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_extsh<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_isync(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_isync<trace_variant>()); }
+template <bool trace_variant> static RET_TYPE pd_op_lbz(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lbz<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lbzu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lbzu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lbzx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lbzx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lbzux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lbzux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lha(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lha<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhau(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhau<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhax(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhax<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhaux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhaux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhbrx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhbrx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhz(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhz<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhzu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhzu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhzx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhzx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lhzux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lhzux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lmw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lmw<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lswi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lswi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lswx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lswx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lwarx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lwarx<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_lwbrx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lwbrx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lwz(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lwz<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lwzu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lwzu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lwzx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lwzx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lwzux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lwzux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_mcrf(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mcrf<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mcrxr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mcrxr<trace_variant>(pd->f[0])); }
+template <bool trace_variant> static RET_TYPE pd_op_mfcr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mfcr<trace_variant>(pd->f[0])); }
+template <bool trace_variant> static RET_TYPE pd_op_mfmsr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mfmsr<trace_variant>(pd->f[0])); }
+template <bool trace_variant> static RET_TYPE pd_op_mfspr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mfspr<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mftb(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mftb<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtcrf(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtcrf<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtmsr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtmsr<trace_variant>(pd->f[0])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtspr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtspr<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mulhw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mulhw<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_mulhwu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mulhwu<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_mulli(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mulli<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_mullw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mullw<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_nand(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_nand<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_neg(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_neg<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_nor(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_nor<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_or(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_or<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_mr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mr<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_orc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_orc<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_ori(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_ori<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_nop(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_nop<trace_variant>()); }
+template <bool trace_variant> static RET_TYPE pd_op_oris(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_oris<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_rfi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_rfi<trace_variant>()); }
+template <bool trace_variant> static RET_TYPE pd_op_rlwimi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_rlwimi<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4], pd->f[5])); }
+template <bool trace_variant> static RET_TYPE pd_op_rlwinm(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_rlwinm<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4], pd->f[5])); }
+template <bool trace_variant> static RET_TYPE pd_op_slwi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_slwi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_srwi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_srwi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_clrlwi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_clrlwi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_rlwnm(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_rlwnm<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4], pd->f[5])); }
+template <bool trace_variant> static RET_TYPE pd_op_sc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sc<trace_variant>(pd->f[0])); }
+template <bool trace_variant> static RET_TYPE pd_op_slw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_slw<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_sraw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sraw<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_srawi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_srawi<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_srw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_srw<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_stb(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stb<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stbu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stbu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stbx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stbx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stbux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stbux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_sth(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sth<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_sthbrx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sthbrx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_sthu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sthu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_sthx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sthx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_sthux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sthux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stmw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stmw<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stswi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stswi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stswx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stswx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stw<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stwbrx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stwbrx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stwcx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stwcx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stwu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stwu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stwx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stwx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stwux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stwux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_subf(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_subf<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_subfc(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_subfc<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_subfe(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_subfe<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_subfic(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_subfic<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_subfme(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_subfme<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_subfze(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_subfze<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_sync(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_sync<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_tw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_tw<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_twi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_twi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_xor(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_xor<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_xori(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_xori<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_xoris(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_xoris<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfs<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfsu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfsu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfsx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfsx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfsux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfsux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfd(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfd<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfdu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfdu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfdx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfdx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_lfdux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_lfdux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfs<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfsu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfsu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfsx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfsx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfsux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfsux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfd(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfd<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfdu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfdu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfdx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfdx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfdux(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfdux<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_stfiwx(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_stfiwx<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fadd(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fadd<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fsub(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fsub<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fmul(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fmul<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fdiv(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fdiv<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fsqrt(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fsqrt<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fmadd(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fmadd<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fmsub(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fmsub<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fnmadd(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fnmadd<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fnmsub(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fnmsub<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fadds(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fadds<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fsubs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fsubs<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fmuls(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fmuls<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fdivs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fdivs<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3])); }
+template <bool trace_variant> static RET_TYPE pd_op_fsqrts(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fsqrts<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fmadds(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fmadds<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fmsubs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fmsubs<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fnmadds(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fnmadds<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fnmsubs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fnmsubs<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fres(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fres<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_frsqrte(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_frsqrte<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fsel(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fsel<trace_variant>(pd->f[0], pd->f[1], pd->f[2], pd->f[3], pd->f[4])); }
+template <bool trace_variant> static RET_TYPE pd_op_fmr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fmr<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fneg(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fneg<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fabs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fabs<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fnabs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fnabs<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_frsp(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_frsp<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fctiw(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fctiw<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fctiwz(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fctiwz<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fcmpu(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fcmpu<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_fcmpo(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_fcmpo<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_mffs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mffs<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtfsf(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtfsf<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtfsfi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtfsfi<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtfsb0(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtfsb0<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtfsb1(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtfsb1<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mcrfs(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mcrfs<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_DEBUG(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_DEBUG<trace_variant>(pd->f[0])); }
+template <bool trace_variant> static RET_TYPE pd_op_dcba(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_dcba<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_dcbi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_dcbi<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_dcbf(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_dcbf<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_dcbt(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_dcbt<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_dcbst(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_dcbst<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_dcbtst(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_dcbtst<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_dcbz(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_dcbz<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_icbi(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_icbi<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_icbt(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_icbt<trace_variant>(pd->f[0], pd->f[1], pd->f[2])); }
+template <bool trace_variant> static RET_TYPE pd_op_mfsr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mfsr<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mfsrin(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mfsrin<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtsr(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtsr<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_mtsrin(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_mtsrin<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_tlbie(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_tlbie<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_tlbiel(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_tlbiel<trace_variant>(pd->f[0], pd->f[1])); }
+template <bool trace_variant> static RET_TYPE pd_op_tlbia(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_tlbia<trace_variant>()); }
+template <bool trace_variant> static RET_TYPE pd_op_tlbsync(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_tlbsync<trace_variant>()); }
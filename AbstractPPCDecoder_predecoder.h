@@ -0,0 +1,228 @@
+switch(opcode) {
+	case 0x003: /* 3 */	pd->f[0] = D_TO(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_SI(inst); pd->fn = &pd_op_twi<trace_variant>; return; 	break;  /* D-form */
+	case 0x005: /* 5 */	if (X_XOPC(inst) == 69) { pd->f[0] = X_RA(inst); pd->fn = &pd_op_DEBUG<trace_variant>; return; } 	break;  /* X-form */
+	case 0x007: /* 7 */	pd->f[0] = D_RA(inst); pd->f[1] = D_SI(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_mulli<trace_variant>; return; 	break;  /* D-form */
+	case 0x008: /* 8 */	pd->f[0] = D_RA(inst); pd->f[1] = D_SI(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_subfic<trace_variant>; return; 	break;  /* D-form */
+	case 0x00a: /* 10 */	pd->f[0] = D_BF(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_UI(inst); pd->fn = &pd_op_cmpli<trace_variant>; return; 	break;  /* D-form */
+	case 0x00b: /* 11 */	pd->f[0] = D_BF(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_SI(inst); pd->fn = &pd_op_cmpi<trace_variant>; return; 	break;  /* D-form */
+	case 0x00c: /* 12 */	pd->f[0] = D_RA(inst); pd->f[1] = D_SI(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_addic<trace_variant>; return; 	break;  /* D-form */
+	case 0x00d: /* 13 */	pd->f[0] = D_RA(inst); pd->f[1] = D_SI(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_addic_rc<trace_variant>; return; 	break;  /* D-form */
+	case 0x00e: /* 14 */	if (D_RA(inst) == 0) { pd->f[0] = D_SI(inst); pd->f[1] = D_RT(inst); pd->fn = &pd_op_li<trace_variant>; return; } pd->f[0] = D_RA0(inst); pd->f[1] = D_SI(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_addi<trace_variant>; return; 	break;  /* D-form */
+	case 0x00f: /* 15 */	if (D_RA(inst) == 0) { pd->f[0] = D_SI(inst); pd->f[1] = D_RT(inst); pd->fn = &pd_op_lis<trace_variant>; return; } pd->f[0] = D_RA0(inst); pd->f[1] = D_SI(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_addis<trace_variant>; return; 	break;  /* D-form */
+	case 0x010: /* 16 */	pd->f[0] = B_BO(inst); pd->f[1] = B_BI(inst); pd->f[2] = B_BD(inst); pd->f[3] = B_AA(inst); pd->f[4] = B_LK(inst); pd->fn = &pd_op_bc<trace_variant>; return; 	break;  /* B-form */
+	case 0x011: /* 17 */	if (SC_XOPC(inst) == 1) { pd->f[0] = SC_LEV(inst); pd->fn = &pd_op_sc<trace_variant>; return; } 	break;  /* SC-form */
+	case 0x012: /* 18 */	pd->f[0] = I_LI(inst); pd->f[1] = I_AA(inst); pd->f[2] = I_LK(inst); pd->fn = &pd_op_b<trace_variant>; return; 	break;  /* I-form */
+	case 0x013: /* 19 */ {
+		switch(XL_XOPC(inst)) {
+			case 0x000: /* 0 */	pd->f[0] = XL_BF(inst); pd->f[1] = XL_BFA(inst); pd->fn = &pd_op_mcrf<trace_variant>; return; 	break;  /* XL-form */
+			case 0x010: /* 16 */	if ((XL_BO(inst) & 0x14) == 0x14 && XL_LK(inst) == 0) { pd->fn = &pd_op_blr<trace_variant>; return; } pd->f[0] = XL_BO(inst); pd->f[1] = XL_BI(inst); pd->f[2] = XL_BH(inst); pd->f[3] = XL_LK(inst); pd->fn = &pd_op_bclr<trace_variant>; return; 	break;  /* XL-form */
+			case 0x021: /* 33 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_crnor<trace_variant>; return; 	break;  /* XL-form */
+			case 0x032: /* 50 */	pd->fn = &pd_op_rfi<trace_variant>; return; 	break;  /* XL-form */
+			case 0x081: /* 129 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_crandc<trace_variant>; return; 	break;  /* XL-form */
+			case 0x096: /* 150 */	pd->fn = &pd_op_isync<trace_variant>; return; 	break;  /* XL-form */
+			case 0x0c1: /* 193 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_crxor<trace_variant>; return; 	break;  /* XL-form */
+			case 0x0e1: /* 225 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_crnand<trace_variant>; return; 	break;  /* XL-form */
+			case 0x101: /* 257 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_crand<trace_variant>; return; 	break;  /* XL-form */
+			case 0x121: /* 289 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_creqv<trace_variant>; return; 	break;  /* XL-form */
+			case 0x1a1: /* 417 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_crorc<trace_variant>; return; 	break;  /* XL-form */
+			case 0x1c1: /* 449 */	pd->f[0] = XL_BT(inst); pd->f[1] = XL_BA(inst); pd->f[2] = XL_BB(inst); pd->fn = &pd_op_cror<trace_variant>; return; 	break;  /* XL-form */
+			case 0x210: /* 528 */	if ((XL_BO(inst) & 0x14) == 0x14 && XL_LK(inst) == 0) { pd->fn = &pd_op_bctr<trace_variant>; return; } pd->f[0] = XL_BO(inst); pd->f[1] = XL_BI(inst); pd->f[2] = XL_BH(inst); pd->f[3] = XL_LK(inst); pd->fn = &pd_op_bcctr<trace_variant>; return; 	break;  /* XL-form */
+			default: break;
+		}
+	} break;
+	case 0x014: /* 20 */	pd->f[0] = M_RA(inst); pd->f[1] = M_RS(inst); pd->f[2] = M_SH(inst); pd->f[3] = M_MB(inst); pd->f[4] = M_ME(inst); pd->f[5] = M_Rc(inst); pd->fn = &pd_op_rlwimi<trace_variant>; return; 	break;  /* M-form */
+	case 0x015: /* 21 */	if (M_MB(inst) == 0 && M_ME(inst) == 31 - M_SH(inst) && M_Rc(inst) == 0) { pd->f[0] = M_RS(inst); pd->f[1] = M_SH(inst); pd->f[2] = M_RA(inst); pd->fn = &pd_op_slwi<trace_variant>; return; } if (M_ME(inst) == 31 && M_SH(inst) + M_MB(inst) == 32 && M_Rc(inst) == 0) { pd->f[0] = M_RS(inst); pd->f[1] = M_MB(inst); pd->f[2] = M_RA(inst); pd->fn = &pd_op_srwi<trace_variant>; return; } if (M_SH(inst) == 0 && M_ME(inst) == 31 && M_Rc(inst) == 0) { pd->f[0] = M_RS(inst); pd->f[1] = M_MB(inst); pd->f[2] = M_RA(inst); pd->fn = &pd_op_clrlwi<trace_variant>; return; } pd->f[0] = M_RS(inst); pd->f[1] = M_SH(inst); pd->f[2] = M_MB(inst); pd->f[3] = M_ME(inst); pd->f[4] = M_RA(inst); pd->f[5] = M_Rc(inst); pd->fn = &pd_op_rlwinm<trace_variant>; return; 	break;  /* M-form */
+	case 0x017: /* 23 */	pd->f[0] = M_RB(inst); pd->f[1] = M_RS(inst); pd->f[2] = M_MB(inst); pd->f[3] = M_ME(inst); pd->f[4] = M_RA(inst); pd->f[5] = M_Rc(inst); pd->fn = &pd_op_rlwnm<trace_variant>; return; 	break;  /* M-form */
+	case 0x018: /* 24 */	if (D_RS(inst) == 0 && D_RA(inst) == 0 && D_UI(inst) == 0) { pd->fn = &pd_op_nop<trace_variant>; return; } pd->f[0] = D_RS(inst); pd->f[1] = D_UI(inst); pd->f[2] = D_RA(inst); pd->fn = &pd_op_ori<trace_variant>; return; 	break;  /* D-form */
+	case 0x019: /* 25 */	pd->f[0] = D_RS(inst); pd->f[1] = D_UI(inst); pd->f[2] = D_RA(inst); pd->fn = &pd_op_oris<trace_variant>; return; 	break;  /* D-form */
+	case 0x01a: /* 26 */	pd->f[0] = D_RS(inst); pd->f[1] = D_UI(inst); pd->f[2] = D_RA(inst); pd->fn = &pd_op_xori<trace_variant>; return; 	break;  /* D-form */
+	case 0x01b: /* 27 */	pd->f[0] = D_RS(inst); pd->f[1] = D_UI(inst); pd->f[2] = D_RA(inst); pd->fn = &pd_op_xoris<trace_variant>; return; 	break;  /* D-form */
+	case 0x01c: /* 28 */	pd->f[0] = D_RS(inst); pd->f[1] = D_UI(inst); pd->f[2] = D_RA(inst); pd->fn = &pd_op_andi_rc<trace_variant>; return; 	break;  /* D-form */
+	case 0x01d: /* 29 */	pd->f[0] = D_RS(inst); pd->f[1] = D_UI(inst); pd->f[2] = D_RA(inst); pd->fn = &pd_op_andis_rc<trace_variant>; return; 	break;  /* D-form */
+	case 0x01f: /* 31 */ {
+		switch(X_XOPC(inst)) {
+			case 0x000: /* 0 */	pd->f[0] = X_BF(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_cmp<trace_variant>; return; 	break;  /* X-form */
+			case 0x004: /* 4 */	pd->f[0] = X_TO(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_tw<trace_variant>; return; 	break;  /* X-form */
+			case 0x008: /* 8 */
+			case 0x208: /* 1032 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_subfc<trace_variant>; return; 	break;  /* XO-form */
+			case 0x00a: /* 10 */
+			case 0x20a: /* 1034 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_addc<trace_variant>; return; 	break;  /* XO-form */
+			case 0x00b: /* 11 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_mulhwu<trace_variant>; return; 	break;  /* X-form */
+			case 0x013: /* 19 */	pd->f[0] = XFX_RT(inst); pd->fn = &pd_op_mfcr<trace_variant>; return; 	break;  /* XFX-form */
+			case 0x014: /* 20 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_EH(inst); pd->f[3] = X_RT(inst); pd->fn = &pd_op_lwarx<trace_variant>; return; 	break;  /* X-form */
+			case 0x016: /* 22 */	pd->f[0] = X_CT(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_icbt<trace_variant>; return; 	break;  /* X-form */
+			case 0x017: /* 23 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lwzx<trace_variant>; return; 	break;  /* X-form */
+			case 0x018: /* 24 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_slw<trace_variant>; return; 	break;  /* X-form */
+			case 0x01a: /* 26 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_cntlzw<trace_variant>; return; 	break;  /* X-form */
+			case 0x01c: /* 28 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_and<trace_variant>; return; 	break;  /* X-form */
+			case 0x020: /* 32 */	pd->f[0] = X_BF(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_cmpl<trace_variant>; return; 	break;  /* X-form */
+			case 0x028: /* 40 */
+			case 0x228: /* 1064 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_subf<trace_variant>; return; 	break;  /* XO-form */
+			case 0x036: /* 54 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->fn = &pd_op_dcbst<trace_variant>; return; 	break;  /* X-form */
+			case 0x037: /* 55 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lwzux<trace_variant>; return; 	break;  /* X-form */
+			case 0x03c: /* 60 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_andc<trace_variant>; return; 	break;  /* X-form */
+			case 0x04b: /* 75 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_mulhw<trace_variant>; return; 	break;  /* X-form */
+			case 0x053: /* 83 */	pd->f[0] = X_RT(inst); pd->fn = &pd_op_mfmsr<trace_variant>; return; 	break;  /* X-form */
+			case 0x056: /* 86 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->fn = &pd_op_dcbf<trace_variant>; return; 	break;  /* X-form */
+			case 0x057: /* 87 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lbzx<trace_variant>; return; 	break;  /* X-form */
+			case 0x068: /* 104 */
+			case 0x268: /* 1128 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RT(inst); pd->f[2] = XO_Rc(inst); pd->f[3] = XO_OE(inst); pd->fn = &pd_op_neg<trace_variant>; return; 	break;  /* XO-form */
+			case 0x077: /* 119 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lbzux<trace_variant>; return; 	break;  /* X-form */
+			case 0x07c: /* 124 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_nor<trace_variant>; return; 	break;  /* X-form */
+			case 0x088: /* 136 */
+			case 0x288: /* 1160 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_subfe<trace_variant>; return; 	break;  /* XO-form */
+			case 0x08a: /* 138 */
+			case 0x28a: /* 1162 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_adde<trace_variant>; return; 	break;  /* XO-form */
+			case 0x090: /* 144 */	pd->f[0] = XFX_FXM(inst); pd->f[1] = XFX_RS(inst); pd->fn = &pd_op_mtcrf<trace_variant>; return; 	break;  /* XFX-form */
+			case 0x092: /* 146 */	pd->f[0] = X_RS(inst); pd->fn = &pd_op_mtmsr<trace_variant>; return; 	break;  /* X-form */
+			case 0x096: /* 150 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stwcx<trace_variant>; return; 	break;  /* X-form */
+			case 0x097: /* 151 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stwx<trace_variant>; return; 	break;  /* X-form */
+			case 0x0b7: /* 183 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stwux<trace_variant>; return; 	break;  /* X-form */
+			case 0x0c8: /* 200 */
+			case 0x2c8: /* 1224 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RT(inst); pd->f[2] = XO_Rc(inst); pd->f[3] = XO_OE(inst); pd->fn = &pd_op_subfze<trace_variant>; return; 	break;  /* XO-form */
+			case 0x0ca: /* 202 */
+			case 0x2ca: /* 1226 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RT(inst); pd->f[2] = XO_Rc(inst); pd->f[3] = XO_OE(inst); pd->fn = &pd_op_addze<trace_variant>; return; 	break;  /* XO-form */
+			case 0x0d2: /* 210 */	pd->f[0] = X_SR(inst); pd->f[1] = X_RS(inst); pd->fn = &pd_op_mtsr<trace_variant>; return; 	break;  /* X-form */
+			case 0x0d7: /* 215 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stbx<trace_variant>; return; 	break;  /* X-form */
+			case 0x0e8: /* 232 */
+			case 0x2e8: /* 1256 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RT(inst); pd->f[2] = XO_Rc(inst); pd->f[3] = XO_OE(inst); pd->fn = &pd_op_subfme<trace_variant>; return; 	break;  /* XO-form */
+			case 0x0ea: /* 234 */
+			case 0x2ea: /* 1258 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RT(inst); pd->f[2] = XO_Rc(inst); pd->f[3] = XO_OE(inst); pd->fn = &pd_op_addme<trace_variant>; return; 	break;  /* XO-form */
+			case 0x0eb: /* 235 */
+			case 0x2eb: /* 1259 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_mullw<trace_variant>; return; 	break;  /* XO-form */
+			case 0x0f2: /* 242 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->fn = &pd_op_mtsrin<trace_variant>; return; 	break;  /* X-form */
+			case 0x0f6: /* 246 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_TH(inst); pd->fn = &pd_op_dcbtst<trace_variant>; return; 	break;  /* X-form */
+			case 0x0f7: /* 247 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stbux<trace_variant>; return; 	break;  /* X-form */
+			case 0x10a: /* 266 */
+			case 0x30a: /* 1290 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_add<trace_variant>; return; 	break;  /* XO-form */
+			case 0x112: /* 274 */	pd->f[0] = X_RB(inst); pd->f[1] = X_L(inst); pd->fn = &pd_op_tlbiel<trace_variant>; return; 	break;  /* X-form */
+			case 0x116: /* 278 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_TH(inst); pd->fn = &pd_op_dcbt<trace_variant>; return; 	break;  /* X-form */
+			case 0x117: /* 279 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lhzx<trace_variant>; return; 	break;  /* X-form */
+			case 0x11c: /* 284 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_eqv<trace_variant>; return; 	break;  /* X-form */
+			case 0x132: /* 306 */	pd->f[0] = X_RB(inst); pd->f[1] = X_L(inst); pd->fn = &pd_op_tlbie<trace_variant>; return; 	break;  /* X-form */
+			case 0x137: /* 311 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lhzux<trace_variant>; return; 	break;  /* X-form */
+			case 0x13c: /* 316 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_xor<trace_variant>; return; 	break;  /* X-form */
+			case 0x153: /* 339 */	pd->f[0] = XFX_spr(inst); pd->f[1] = XFX_RT(inst); pd->fn = &pd_op_mfspr<trace_variant>; return; 	break;  /* XFX-form */
+			case 0x157: /* 343 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lhax<trace_variant>; return; 	break;  /* X-form */
+			case 0x172: /* 370 */	pd->fn = &pd_op_tlbia<trace_variant>; return; 	break;  /* X-form */
+			case 0x173: /* 371 */	pd->f[0] = XFX_spr(inst); pd->f[1] = XFX_RT(inst); pd->fn = &pd_op_mftb<trace_variant>; return; 	break;  /* XFX-form */
+			case 0x177: /* 375 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lhaux<trace_variant>; return; 	break;  /* X-form */
+			case 0x197: /* 407 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_sthx<trace_variant>; return; 	break;  /* X-form */
+			case 0x19c: /* 412 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_orc<trace_variant>; return; 	break;  /* X-form */
+			case 0x1b7: /* 439 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_sthux<trace_variant>; return; 	break;  /* X-form */
+			case 0x1bc: /* 444 */	if (X_RS(inst) == X_RB(inst) && X_Rc(inst) == 0) { pd->f[0] = X_RS(inst); pd->f[1] = X_RA(inst); pd->fn = &pd_op_mr<trace_variant>; return; } pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_or<trace_variant>; return; 	break;  /* X-form */
+			case 0x1cb: /* 459 */
+			case 0x3cb: /* 1483 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_divwu<trace_variant>; return; 	break;  /* XO-form */
+			case 0x1d3: /* 467 */	pd->f[0] = XFX_spr(inst); pd->f[1] = XFX_RS(inst); pd->fn = &pd_op_mtspr<trace_variant>; return; 	break;  /* XFX-form */
+			case 0x1d6: /* 470 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->fn = &pd_op_dcbi<trace_variant>; return; 	break;  /* X-form */
+			case 0x1dc: /* 476 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_nand<trace_variant>; return; 	break;  /* X-form */
+			case 0x1eb: /* 491 */
+			case 0x3eb: /* 1515 */	pd->f[0] = XO_RA(inst); pd->f[1] = XO_RB(inst); pd->f[2] = XO_RT(inst); pd->f[3] = XO_Rc(inst); pd->f[4] = XO_OE(inst); pd->fn = &pd_op_divw<trace_variant>; return; 	break;  /* XO-form */
+			case 0x200: /* 512 */	pd->f[0] = X_BF(inst); pd->fn = &pd_op_mcrxr<trace_variant>; return; 	break;  /* X-form */
+			case 0x215: /* 533 */	pd->f[0] = X_RT(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_lswx<trace_variant>; return; 	break;  /* X-form */
+			case 0x216: /* 534 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lwbrx<trace_variant>; return; 	break;  /* X-form */
+			case 0x217: /* 535 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_FRT(inst); pd->fn = &pd_op_lfsx<trace_variant>; return; 	break;  /* X-form */
+			case 0x218: /* 536 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_srw<trace_variant>; return; 	break;  /* X-form */
+			case 0x236: /* 566 */	pd->fn = &pd_op_tlbsync<trace_variant>; return; 	break;  /* X-form */
+			case 0x237: /* 567 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_FRT(inst); pd->fn = &pd_op_lfsux<trace_variant>; return; 	break;  /* X-form */
+			case 0x253: /* 595 */	pd->f[0] = X_SR(inst); pd->f[1] = X_RT(inst); pd->fn = &pd_op_mfsr<trace_variant>; return; 	break;  /* X-form */
+			case 0x255: /* 597 */	pd->f[0] = X_RT(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_NB(inst); pd->fn = &pd_op_lswi<trace_variant>; return; 	break;  /* X-form */
+			case 0x256: /* 598 */	pd->f[0] = X_L(inst); pd->f[1] = X_E(inst); pd->fn = &pd_op_sync<trace_variant>; return; 	break;  /* X-form */
+			case 0x257: /* 599 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_FRT(inst); pd->fn = &pd_op_lfdx<trace_variant>; return; 	break;  /* X-form */
+			case 0x277: /* 631 */	pd->f[0] = X_RA(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_FRT(inst); pd->fn = &pd_op_lfdux<trace_variant>; return; 	break;  /* X-form */
+			case 0x293: /* 659 */	pd->f[0] = X_RB(inst); pd->f[1] = X_RT(inst); pd->fn = &pd_op_mfsrin<trace_variant>; return; 	break;  /* X-form */
+			case 0x295: /* 661 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stswx<trace_variant>; return; 	break;  /* X-form */
+			case 0x296: /* 662 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stwbrx<trace_variant>; return; 	break;  /* X-form */
+			case 0x297: /* 663 */	pd->f[0] = X_FRS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stfsx<trace_variant>; return; 	break;  /* X-form */
+			case 0x2b7: /* 695 */	pd->f[0] = X_FRS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stfsux<trace_variant>; return; 	break;  /* X-form */
+			case 0x2d5: /* 725 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_NB(inst); pd->fn = &pd_op_stswi<trace_variant>; return; 	break;  /* X-form */
+			case 0x2d7: /* 727 */	pd->f[0] = X_FRS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stfdx<trace_variant>; return; 	break;  /* X-form */
+			case 0x2f6: /* 758 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->fn = &pd_op_dcba<trace_variant>; return; 	break;  /* X-form */
+			case 0x2f7: /* 759 */	pd->f[0] = X_FRS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stfdux<trace_variant>; return; 	break;  /* X-form */
+			case 0x316: /* 790 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RT(inst); pd->fn = &pd_op_lhbrx<trace_variant>; return; 	break;  /* X-form */
+			case 0x318: /* 792 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RB(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_sraw<trace_variant>; return; 	break;  /* X-form */
+			case 0x338: /* 824 */	pd->f[0] = X_RS(inst); pd->f[1] = X_SH(inst); pd->f[2] = X_RA(inst); pd->f[3] = X_Rc(inst); pd->fn = &pd_op_srawi<trace_variant>; return; 	break;  /* X-form */
+			case 0x356: /* 854 */	pd->fn = &pd_op_eieio<trace_variant>; return; 	break;  /* X-form */
+			case 0x396: /* 918 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_sthbrx<trace_variant>; return; 	break;  /* X-form */
+			case 0x39a: /* 922 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_extsh<trace_variant>; return; 	break;  /* X-form */
+			case 0x3ba: /* 954 */	pd->f[0] = X_RS(inst); pd->f[1] = X_RA(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_extsb<trace_variant>; return; 	break;  /* X-form */
+			case 0x3d6: /* 982 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->fn = &pd_op_icbi<trace_variant>; return; 	break;  /* X-form */
+			case 0x3d7: /* 983 */	pd->f[0] = X_FRS(inst); pd->f[1] = X_RA0(inst); pd->f[2] = X_RB(inst); pd->fn = &pd_op_stfiwx<trace_variant>; return; 	break;  /* X-form */
+			case 0x3f6: /* 1014 */	pd->f[0] = X_RA0(inst); pd->f[1] = X_RB(inst); pd->fn = &pd_op_dcbz<trace_variant>; return; 	break;  /* X-form */
+			default: break;
+		}
+	} break;
+	case 0x020: /* 32 */	pd->f[0] = D_RA0(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lwz<trace_variant>; return; 	break;  /* D-form */
+	case 0x021: /* 33 */	pd->f[0] = D_RA(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lwzu<trace_variant>; return; 	break;  /* D-form */
+	case 0x022: /* 34 */	pd->f[0] = D_RA0(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lbz<trace_variant>; return; 	break;  /* D-form */
+	case 0x023: /* 35 */	pd->f[0] = D_RA(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lbzu<trace_variant>; return; 	break;  /* D-form */
+	case 0x024: /* 36 */	pd->f[0] = D_RS(inst); pd->f[1] = D_RA0(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stw<trace_variant>; return; 	break;  /* D-form */
+	case 0x025: /* 37 */	pd->f[0] = D_RS(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stwu<trace_variant>; return; 	break;  /* D-form */
+	case 0x026: /* 38 */	pd->f[0] = D_RS(inst); pd->f[1] = D_RA0(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stb<trace_variant>; return; 	break;  /* D-form */
+	case 0x027: /* 39 */	pd->f[0] = D_RS(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stbu<trace_variant>; return; 	break;  /* D-form */
+	case 0x028: /* 40 */	pd->f[0] = D_RA0(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lhz<trace_variant>; return; 	break;  /* D-form */
+	case 0x029: /* 41 */	pd->f[0] = D_RA(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lhzu<trace_variant>; return; 	break;  /* D-form */
+	case 0x02a: /* 42 */	pd->f[0] = D_RA0(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lha<trace_variant>; return; 	break;  /* D-form */
+	case 0x02b: /* 43 */	pd->f[0] = D_RA(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RT(inst); pd->fn = &pd_op_lhau<trace_variant>; return; 	break;  /* D-form */
+	case 0x02c: /* 44 */	pd->f[0] = D_RS(inst); pd->f[1] = D_RA0(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_sth<trace_variant>; return; 	break;  /* D-form */
+	case 0x02d: /* 45 */	pd->f[0] = D_RS(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_sthu<trace_variant>; return; 	break;  /* D-form */
+	case 0x02e: /* 46 */	pd->f[0] = D_RT(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RA0(inst); pd->fn = &pd_op_lmw<trace_variant>; return; 	break;  /* D-form */
+	case 0x02f: /* 47 */	pd->f[0] = D_RS(inst); pd->f[1] = D_D(inst); pd->f[2] = D_RA0(inst); pd->fn = &pd_op_stmw<trace_variant>; return; 	break;  /* D-form */
+	case 0x030: /* 48 */	pd->f[0] = D_RA0(inst); pd->f[1] = D_D(inst); pd->f[2] = D_FRT(inst); pd->fn = &pd_op_lfs<trace_variant>; return; 	break;  /* D-form */
+	case 0x031: /* 49 */	pd->f[0] = D_RA(inst); pd->f[1] = D_D(inst); pd->f[2] = D_FRT(inst); pd->fn = &pd_op_lfsu<trace_variant>; return; 	break;  /* D-form */
+	case 0x032: /* 50 */	pd->f[0] = D_RA0(inst); pd->f[1] = D_D(inst); pd->f[2] = D_FRT(inst); pd->fn = &pd_op_lfd<trace_variant>; return; 	break;  /* D-form */
+	case 0x033: /* 51 */	pd->f[0] = D_RA(inst); pd->f[1] = D_D(inst); pd->f[2] = D_FRT(inst); pd->fn = &pd_op_lfdu<trace_variant>; return; 	break;  /* D-form */
+	case 0x034: /* 52 */	pd->f[0] = D_FRS(inst); pd->f[1] = D_RA0(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stfs<trace_variant>; return; 	break;  /* D-form */
+	case 0x035: /* 53 */	pd->f[0] = D_FRS(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stfsu<trace_variant>; return; 	break;  /* D-form */
+	case 0x036: /* 54 */	pd->f[0] = D_FRS(inst); pd->f[1] = D_RA0(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stfd<trace_variant>; return; 	break;  /* D-form */
+	case 0x037: /* 55 */	pd->f[0] = D_FRS(inst); pd->f[1] = D_RA(inst); pd->f[2] = D_D(inst); pd->fn = &pd_op_stfdu<trace_variant>; return; 	break;  /* D-form */
+	case 0x03b: /* 59 */ {
+		switch(A_XOPC(inst)) {
+			case 0x012: /* 18 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRB(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fdivs<trace_variant>; return; 	break;  /* A-form */
+			case 0x014: /* 20 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRB(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fsubs<trace_variant>; return; 	break;  /* A-form */
+			case 0x015: /* 21 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRB(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fadds<trace_variant>; return; 	break;  /* A-form */
+			case 0x016: /* 22 */	pd->f[0] = A_FRB(inst); pd->f[1] = A_FRT(inst); pd->f[2] = A_Rc(inst); pd->fn = &pd_op_fsqrts<trace_variant>; return; 	break;  /* A-form */
+			case 0x018: /* 24 */	pd->f[0] = A_FRB(inst); pd->f[1] = A_FRT(inst); pd->f[2] = A_Rc(inst); pd->fn = &pd_op_fres<trace_variant>; return; 	break;  /* A-form */
+			case 0x019: /* 25 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fmuls<trace_variant>; return; 	break;  /* A-form */
+			case 0x01c: /* 28 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fmsubs<trace_variant>; return; 	break;  /* A-form */
+			case 0x01d: /* 29 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fmadds<trace_variant>; return; 	break;  /* A-form */
+			case 0x01e: /* 30 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fnmsubs<trace_variant>; return; 	break;  /* A-form */
+			case 0x01f: /* 31 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fnmadds<trace_variant>; return; 	break;  /* A-form */
+			default: break;
+		}
+	} break;
+	case 0x03f: /* 63 */ {
+		switch(X_XOPC(inst)) {
+			case 0x000: /* 0 */	pd->f[0] = X_FRA(inst); pd->f[1] = X_FRB(inst); pd->f[2] = X_BF(inst); pd->fn = &pd_op_fcmpu<trace_variant>; return; 	break;  /* X-form */
+			case 0x00c: /* 12 */	pd->f[0] = X_FRB(inst); pd->f[1] = X_FRT(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_frsp<trace_variant>; return; 	break;  /* X-form */
+			case 0x00e: /* 14 */	pd->f[0] = X_FRB(inst); pd->f[1] = X_FRT(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_fctiw<trace_variant>; return; 	break;  /* X-form */
+			case 0x00f: /* 15 */	pd->f[0] = X_FRB(inst); pd->f[1] = X_FRT(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_fctiwz<trace_variant>; return; 	break;  /* X-form */
+			case 0x020: /* 32 */	pd->f[0] = X_FRA(inst); pd->f[1] = X_FRB(inst); pd->f[2] = X_BF(inst); pd->fn = &pd_op_fcmpo<trace_variant>; return; 	break;  /* X-form */
+			case 0x026: /* 38 */	pd->f[0] = X_BT(inst); pd->f[1] = X_Rc(inst); pd->fn = &pd_op_mtfsb1<trace_variant>; return; 	break;  /* X-form */
+			case 0x028: /* 40 */	pd->f[0] = X_FRB(inst); pd->f[1] = X_FRT(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_fneg<trace_variant>; return; 	break;  /* X-form */
+			case 0x040: /* 64 */	pd->f[0] = X_BFA(inst); pd->f[1] = X_BF(inst); pd->fn = &pd_op_mcrfs<trace_variant>; return; 	break;  /* X-form */
+			case 0x046: /* 70 */	pd->f[0] = X_BT(inst); pd->f[1] = X_Rc(inst); pd->fn = &pd_op_mtfsb0<trace_variant>; return; 	break;  /* X-form */
+			case 0x048: /* 72 */	pd->f[0] = X_FRB(inst); pd->f[1] = X_FRT(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_fmr<trace_variant>; return; 	break;  /* X-form */
+			case 0x086: /* 134 */	pd->f[0] = X_U(inst); pd->f[1] = X_BF(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_mtfsfi<trace_variant>; return; 	break;  /* X-form */
+			case 0x088: /* 136 */	pd->f[0] = X_FRB(inst); pd->f[1] = X_FRT(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_fnabs<trace_variant>; return; 	break;  /* X-form */
+			case 0x108: /* 264 */	pd->f[0] = X_FRB(inst); pd->f[1] = X_FRT(inst); pd->f[2] = X_Rc(inst); pd->fn = &pd_op_fabs<trace_variant>; return; 	break;  /* X-form */
+			case 0x247: /* 583 */	pd->f[0] = X_FRT(inst); pd->f[1] = X_Rc(inst); pd->fn = &pd_op_mffs<trace_variant>; return; 	break;  /* X-form */
+			case 0x2c7: /* 711 */	pd->f[0] = XFL_FLM(inst); pd->f[1] = XFL_FRB(inst); pd->f[2] = XFL_Rc(inst); pd->fn = &pd_op_mtfsf<trace_variant>; return; 	break;  /* XFL-form */
+			default: break;
+		}
+		switch(A_XOPC(inst)) {
+			case 0x012: /* 18 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRB(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fdiv<trace_variant>; return; 	break;  /* A-form */
+			case 0x014: /* 20 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRB(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fsub<trace_variant>; return; 	break;  /* A-form */
+			case 0x015: /* 21 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRB(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fadd<trace_variant>; return; 	break;  /* A-form */
+			case 0x016: /* 22 */	pd->f[0] = A_FRB(inst); pd->f[1] = A_FRT(inst); pd->f[2] = A_Rc(inst); pd->fn = &pd_op_fsqrt<trace_variant>; return; 	break;  /* A-form */
+			case 0x017: /* 23 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fsel<trace_variant>; return; 	break;  /* A-form */
+			case 0x019: /* 25 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRT(inst); pd->f[3] = A_Rc(inst); pd->fn = &pd_op_fmul<trace_variant>; return; 	break;  /* A-form */
+			case 0x01a: /* 26 */	pd->f[0] = A_FRB(inst); pd->f[1] = A_FRT(inst); pd->f[2] = A_Rc(inst); pd->fn = &pd_op_frsqrte<trace_variant>; return; 	break;  /* A-form */
+			case 0x01c: /* 28 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fmsub<trace_variant>; return; 	break;  /* A-form */
+			case 0x01d: /* 29 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fmadd<trace_variant>; return; 	break;  /* A-form */
+			case 0x01e: /* 30 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fnmsub<trace_variant>; return; 	break;  /* A-form */
+			case 0x01f: /* 31 */	pd->f[0] = A_FRA(inst); pd->f[1] = A_FRC(inst); pd->f[2] = A_FRB(inst); pd->f[3] = A_FRT(inst); pd->f[4] = A_Rc(inst); pd->fn = &pd_op_fnmadd<trace_variant>; return; 	break;  /* A-form */
+			default: break;
+		}
+	} break;
+}
@@ -139,6 +139,16 @@ public:
 		return devs[i].dev->direct_map(addr, map_at);
 	}
 
+	// Which PA a host address from get_direct_map() maps:
+	bool	get_direct_unmap(void *map_at, PA *addr)
+	{
+		for (int i = 0; i < bus_entries; i++) {
+			if (devs[i].dev && devs[i].dev->direct_unmap(map_at, addr))
+				return true;
+		}
+		return false;
+	}
+
 	void	dump()
 	{
 		printf("Bus devices:\n");
@@ -46,6 +46,10 @@ void 	Config::usage(char *prog)
 		"\t-m <MSR> \t Set start MSR value (e.g. 0x40 for high vecs)\n"
                 "\t-G <num> \t Set GPIO inputs (default 0x80000000 for sim)\n"
 		"\t-x <path> \t Save state at exit to file\n"
+		"\t-J <MB> \t Set JIT code cache size (default %d)\n"
+		"\t-H <runs> \t Set JIT threshold, runs interpreted before compiling (default %d)\n"
+		"\t-O <runs> \t Set runs of a JIT block before recompiling as a trace (default %d)\n"
+		"\t-C <path> \t Keep JIT blocks in a cache file, for later runs (default off)\n"
 		"\t-t <trace type> \t Enable trace:\n"
 		"\t\t\tsyscall \t Syscall trace\n"
 		"\t\t\tio \t\t IO trace\n"
@@ -57,13 +61,13 @@ void 	Config::usage(char *prog)
  *
  * -B <address>,<action>	Set breakpoint/action: start disasm, stop disasm, stop sim, dump state
  */
-		, rom_path, SBD_NUM);
+		, rom_path, SBD_NUM, jit_cache_mb, jit_threshold, jit_reopt);
 }
 
 void	Config::setup(int argc, char *argv[])
 {
 	int ch;
-	while ((ch = getopt(argc, argv, "hr:vdl:p:s:L:t:b:m:x:G:")) != -1) {
+	while ((ch = getopt(argc, argv, "hr:vdl:p:s:L:t:b:m:x:G:J:H:O:C:")) != -1) {
 		switch (ch) {
 			case 'r':
 				rom_path = strdup(optarg);	/* Memory leak */
@@ -92,6 +96,18 @@ void	Config::setup(int argc, char *argv[])
 			case 'G':
 				gpio_inputs = strtoull(optarg, NULL, 0);
 				break;
+			case 'J':
+				jit_cache_mb = strtoul(optarg, NULL, 0);
+				break;
+			case 'H':
+				jit_threshold = strtoul(optarg, NULL, 0);
+				break;
+			case 'O':
+				jit_reopt = strtoul(optarg, NULL, 0);
+				break;
+			case 'C':
+				jit_persist_path = strdup(optarg);	/* Memory leak */
+				break;
 			case 'b': {
 				int assigned = 0;
 				for (int i = 0; i < SBD_NUM; i++) {
@@ -49,6 +49,10 @@ public:
 	char		*block_path[SBD_NUM];
 	u32		start_msr;
 	char 		*save_state_path;
+	unsigned int	jit_cache_mb;
+	unsigned int	jit_threshold;
+	unsigned int	jit_reopt;
+	char		*jit_persist_path;
 #if PLATFORM == 3
         u32             gpio_inputs;
 #endif
@@ -70,6 +74,10 @@ public:
 		,jit_trace(false)
 		,start_msr(RESET_MSR_VAL)
 		,save_state_path(0)
+		,jit_cache_mb(4)
+		,jit_threshold(16)
+		,jit_reopt(1000)
+		,jit_persist_path(0)
 #if PLATFORM == 3
                 ,gpio_inputs(0x80000000)
 #endif
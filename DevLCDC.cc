@@ -34,7 +34,7 @@
 #include <stdio.h>
 #ifndef NO_SDL
 #include <SDL.h>
-#include "portable_endian.h"
+#include "ram_order.h"
 #endif
 #include "DevLCDC.h"
 
@@ -182,7 +182,7 @@ void	DevLCDC::write8(PA addr, u8 data)
 void 	DevLCDC::copyLine32bpp(uint32_t *lineout, unsigned int width, unsigned int pscale, uint32_t **in)
 {
 	for (unsigned int x = 0; x < width; x++) {
-		uint32_t pix = be32toh(**in);
+		uint32_t pix = ram_read32((u8 *)*in);
 		(*in)++;
 		for (unsigned int s = 0; s < pscale; s++) {
 			*lineout++ = pix;
@@ -198,7 +198,8 @@ void 	DevLCDC::copyLine16bpp(uint32_t *lineout, unsigned int width, unsigned int
 
 	for (unsigned int x = 0; x < width; x++) {
 		if (!pcount) {
-			opx = **in;	// "fetch" a chunk of pixels
+			// "fetch" a chunk of pixels, in guest memory order
+			opx = htobe32(ram_read32((u8 *)*in));
 			(*in)++;
 			pcount = 2;	// 2x 16BPP pixels per word
 		}
@@ -225,7 +226,7 @@ void 	DevLCDC::copyLineIndexed(unsigned int bpp, uint32_t *lineout, unsigned int
 
 	for (unsigned int x = 0; x < width; x++) {
 		if (!pcount) {
-			opx = **in;
+			opx = htobe32(ram_read32((u8 *)*in));
 			(*in)++;
 			pcount = 32/bpp;	// N pixels per word
 		}
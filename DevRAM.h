@@ -39,16 +39,23 @@
 #endif
 
 #include "log.h"
+#include "ram_order.h"
 
 #define ALIGNMENT_HAX 1
 
+/* Bus accesses give/take data in guest memory order, as other devices do;
+ * with swizzled RAM (see ram_order.h) it's converted here.
+ */
+
 class DevRAM : public Device {
 public:
 	DevRAM(bool actuallyROM = false) : isROM(actuallyROM), mmap_base(0), fnam(0) {}
 
 	u32	read32(PA addr)
 	{
-#ifdef ALIGNMENT_HAX
+#if RAM_SWIZZLED
+		u32 d = htobe32(ram_read32(mmap_base + offset_from_PA(addr)));
+#elif defined(ALIGNMENT_HAX)
 		u32 d = *((u32 *)(mmap_base + offset_from_PA(addr)));
 #else
 		u32 d = ((u32 *)mmap_base)[offset_from_PA(addr) >> 2];
@@ -59,7 +66,9 @@ public:
 
 	u16	read16(PA addr)
 	{
-#ifdef ALIGNMENT_HAX
+#if RAM_SWIZZLED
+		u16 d = htobe16(ram_read16(mmap_base + offset_from_PA(addr)));
+#elif defined(ALIGNMENT_HAX)
 		u16 d = *((u16 *)(mmap_base + offset_from_PA(addr)));
 #else
 		u16 d = ((u16 *)mmap_base)[offset_from_PA(addr) >> 1];
@@ -70,7 +79,7 @@ public:
 
 	u8	read8(PA addr)
 	{
-		u8 d = ((u8 *)mmap_base)[offset_from_PA(addr)];
+		u8 d = ram_read8(mmap_base + offset_from_PA(addr));
 		DEBUG("- R%cM RD[" FMT_PA "] = %02x\n", isROM ? 'O' : 'A', addr, d);
 		return d;
 	}
@@ -79,7 +88,9 @@ public:
 	{
 		DEBUG("- R%cM WR[" FMT_PA "] <= %08x\n", isROM ? 'O' : 'A', addr, data);
 		if (!isROM)
-#ifdef ALIGNMENT_HAX
+#if RAM_SWIZZLED
+			ram_write32(mmap_base + offset_from_PA(addr), be32toh(data));
+#elif defined(ALIGNMENT_HAX)
 			*((u32 *)(mmap_base + offset_from_PA(addr))) = data;
 #else
 			((u32 *)mmap_base)[offset_from_PA(addr) >> 2] = data;
@@ -90,7 +101,9 @@ public:
 	{
 		DEBUG("- R%cM WR[" FMT_PA "] <= %04x\n", isROM ? 'O' : 'A', addr, data);
 		if (!isROM)
-#ifdef ALIGNMENT_HAX
+#if RAM_SWIZZLED
+			ram_write16(mmap_base + offset_from_PA(addr), be16toh(data));
+#elif defined(ALIGNMENT_HAX)
 			*((u16 *)(mmap_base + offset_from_PA(addr))) = data;
 #else
 			((u16 *)mmap_base)[offset_from_PA(addr) >> 1] = data;
@@ -101,7 +114,7 @@ public:
 	{
 		DEBUG("- R%cM WR[" FMT_PA "] <= %02x\n", isROM ? 'O' : 'A', addr, data);
 		if (!isROM)
-			((u8 *)mmap_base)[offset_from_PA(addr)] = data;
+			ram_write8(mmap_base + offset_from_PA(addr), data);
 	}
 
 	void	setProps(PA addr, PA size)
@@ -130,6 +143,16 @@ public:
 		return true;
 	}
 
+	bool	direct_unmap(void *host_addr, PA *out_addr)
+	{
+		u8 *h = (u8 *)host_addr;
+
+		if (h < mmap_base || h >= mmap_base + address_span)
+			return false;
+		*out_addr = base_address + (h - mmap_base);
+		return true;
+	}
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Local functions:
 	// save_to_file.
@@ -169,7 +192,9 @@ public:
 			      address_span, sb.st_size, offset);
 		}
 
-		int r = read(fd, mmap_base + offset, sb.st_size);
+		u8 *buf = ram_dma_buf(mmap_base + offset, sb.st_size);
+		int r = read(fd, buf, sb.st_size);
+		ram_dma_done(mmap_base + offset, buf, sb.st_size, true);
 		if (r < 0) {
 			perror("RAM read:");
 			FATAL("Failed to load RAM contents\n");
@@ -38,6 +38,7 @@
 #include <limits.h>
 
 #include "DevSBD.h"
+#include "ram_order.h"
 
 
 void	DevSBD::init()
@@ -188,10 +189,12 @@ void	DevSBD::doRead(u32 block_start, u32 num, PA to)
 		}
 
 		// Do read:
-		if (pread(fd, ha, num*DEVSBD_BLK_SIZE, block_start*DEVSBD_BLK_SIZE) < 0) {
+		u8 *buf = ram_dma_buf((u8 *)ha, num*DEVSBD_BLK_SIZE);
+		if (pread(fd, buf, num*DEVSBD_BLK_SIZE, block_start*DEVSBD_BLK_SIZE) < 0) {
 			perror("DevSBD::doRead pread");
 			// Then what?  Do nothing?
 		}
+		ram_dma_done((u8 *)ha, buf, num*DEVSBD_BLK_SIZE, true);
 	} else {
 		WARN("DevSbd::doRead: Read block %d, but no image open.\n", block_start);
 		return;
@@ -219,10 +222,12 @@ void	DevSBD::doWrite(u32 block_start, u32 num, PA from)
 		}
 
 		// Do write:
-		if (pwrite(fd, ha, num*DEVSBD_BLK_SIZE, block_start*DEVSBD_BLK_SIZE) < 0) {
+		u8 *buf = ram_dma_buf((u8 *)ha, num*DEVSBD_BLK_SIZE);
+		if (pwrite(fd, buf, num*DEVSBD_BLK_SIZE, block_start*DEVSBD_BLK_SIZE) < 0) {
 			perror("DevSBD::doWrite pwrite");
 			// Then what?  Do nothing?
 		}
+		ram_dma_done((u8 *)ha, buf, num*DEVSBD_BLK_SIZE, false);
 	} else {
 		WARN("DevSbd::doWrite: Write block %d, but no image open.\n", block_start);
 		return;
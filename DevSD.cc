@@ -30,6 +30,7 @@
 
 #include <stdio.h>
 #include "DevSD.h"
+#include "ram_order.h"
 
 #define SD_REG_RB0	0
 #define SD_REG_RB1	1
@@ -289,7 +290,9 @@ void    DevSD::checkForWork()
 
                         uint8_t *base = (uint8_t *)getAddrDMA(regs[SD_REG_DMA_ADDR]);
                         unsigned int err = 0;
-                        bool rx_ok = sdcard->read(base, rx_len, &err);
+                        uint8_t *buf = ram_dma_buf(base, rx_len);
+                        bool rx_ok = sdcard->read(buf, rx_len, &err);
+                        ram_dma_done(base, buf, rx_len, true);
 
                         IOTRACE("DevSD: read to %p, %08x, %d, OK%d/err%d dcfg %08x\n",
                                base, regs[SD_REG_DMA_ADDR],
@@ -310,7 +313,9 @@ void    DevSD::checkForWork()
                 tx_len = (SD_DATACFG_NRBLK(regs[SD_REG_DATACFG])+1)*512;
                 uint8_t *base = (uint8_t *)getAddrDMA(regs[SD_REG_DMA_ADDR]);
 
-                bool tx_ok = sdcard->write(base, tx_len, &err);
+                uint8_t *buf = ram_dma_buf(base, tx_len);
+                bool tx_ok = sdcard->write(buf, tx_len, &err);
+                ram_dma_done(base, buf, tx_len, false);
                 IOTRACE("DevSD: write to %p, %08x, %d, OK%d/err%d dcfg %08x\n",
                         base, regs[SD_REG_DMA_ADDR],
                         tx_len, tx_ok, err, regs[SD_REG_DATACFG]);
@@ -51,6 +51,12 @@ public:
 	{
 		return false;
 	}
+
+	/* ...and so might this, the reverse of direct_map() */
+	virtual bool	direct_unmap(void *host_addr, PA *out_addr)
+	{
+		return false;
+	}
 };
 
 #endif
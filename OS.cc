@@ -22,7 +22,7 @@
  */
 
 #include "OS.h"
-#include <arpa/inet.h> // For htonl
+#include "ram_order.h"
 #include <unistd.h>
 
 static OS	os;
@@ -30,14 +30,14 @@ static OS	os;
 void	OS::push32(u32 val)
 {
 	cur_stack_ptr -= 4;
-	*((u32 *)to_host(cur_stack_ptr)) = htonl(val);
+	ram_write32(to_host(cur_stack_ptr), val);
 	DEBUG("Stack:  %08x = (BE) %08x\n", cur_stack_ptr, val);
 }
 
 void	OS::push8(u8 val)
 {
 	cur_stack_ptr -= 1;
-	*((u8 *)to_host(cur_stack_ptr)) = val;
+	ram_write8(to_host(cur_stack_ptr), val);
 	DEBUG("Stack:  %08x = %02x\n", cur_stack_ptr, val);
 }
 
@@ -140,7 +140,9 @@ void	OS::doSyscall(PPCCPUState *pcs, unsigned int LEV)
 					if (!in_mem(a1) || !in_mem(a1+a2)) {
 						// FIXME: flag EFAULT
 					} else {
-						result = write(1, to_host(a1), a2);
+						u8 *buf = ram_dma_buf(to_host(a1), a2);
+						result = write(1, buf, a2);
+						ram_dma_done(to_host(a1), buf, a2, false);
 					}
 				} break;
 				default:
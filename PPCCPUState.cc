@@ -21,6 +21,9 @@
  * SOFTWARE.
  */
 
+#include <errno.h>
+#include <time.h>
+
 #include "PPCCPUState.h"
 #include "log.h"
 
@@ -32,26 +35,43 @@ PPCCPUState::PPCCPUState()
 	for (int i = 0; i < 32; i++) {
 		gprs[i] = 0;
 	}
+	for (int i = 0; i < 32; i++) {
+		fprs[i] = 0;
+	}
+	fpscr = 0;
 	pc = ctr = lr = 0;
 	xer = 0;
 	cr = 0;
+#if ENABLE_LAZY_FLAGS
+	cr0_pending = false;
+	cr0_result = 0;
+#endif
 	msr = 0;
 	pir = 0;
 	tb = 0;
 	cpu_inst_count = 0;
+	tb_ticks = 0;
+	dec_tb = 0;
+	dec_deadline = 0;
+	run_horizon = 0;
 	hid0 = 0;
 	hid1 = 0;
 	dar = 0;
 	dsisr = 0;
 	dec = 0xffffffff;
 	irqFlag = false;
+	dozing = false;
+	pthread_mutex_init(&doze_lock, NULL);
+	pthread_cond_init(&doze_cond, NULL);
 
 	mmu = 0;
 	exception_jmp = 0;
+	blk_ticks = 0;
 }
 
 void	PPCCPUState::dump()
 {
+	syncCR0();
 #ifdef INSTR_LOG_HUMAN_READABLE
 	LOG("CPU[%d] state:   Icount %016lx\n", pir, cpu_inst_count);
 	LOG(" PC  " FMT_REG "   LR  " FMT_REG
@@ -60,7 +80,7 @@ void	PPCCPUState::dump()
 	    "          MSR %08x   DEC %08x\n",
 	    pc, lr,
 	    ctr,
-	    cr, xer, msr, dec);
+	    cr, xer, msr, getDEC());
 	for (int i = 0; i < 32; i++) {
 		if ((i & 7) == 0)
 			LOG(" ");
@@ -68,6 +88,16 @@ void	PPCCPUState::dump()
 		if ((i & 7) == 7)
 			LOG("\n");
 	}
+#if ENABLE_FPU
+	LOG(" FPSCR %08x\n", fpscr);
+	for (int i = 0; i < 32; i++) {
+		if ((i & 3) == 0)
+			LOG(" ");
+		LOG("f%02d %016lx   ", i, fprs[i]);
+		if ((i & 3) == 3)
+			LOG("\n");
+	}
+#endif
 #else
 	/* This style of log is the same as that output by the
 	 * ppc_trace utility, so can be compared against it
@@ -89,11 +119,12 @@ void	PPCCPUState::render_mr(char *buffer, size_t len)
 	size_t s = len;
 	char *p = buffer;
 
+	syncCR0();
 	r = snprintf(p, s,
 		     "ICOUNT %016llx, PC " FMT_REG ", "
 		     "LR " FMT_REG ", CTR " FMT_REG ", CR " FMT_REG ", "
 		     "XER " FMT_REG ", MSR " FMT_REG ", DEC " FMT_REG ", ",
-		     cpu_inst_count, pc, lr, ctr, cr, xer, msr, dec);
+		     cpu_inst_count, pc, lr, ctr, cr, xer, msr, getDEC());
 	if (r < 0)
 		return;
 	s -= r;
@@ -114,6 +145,74 @@ void	PPCCPUState::render_mr(char *buffer, size_t len)
 	*p = '\0';
 }
 
+void	PPCCPUState::setRunHorizon(u64 t)
+{
+	run_horizon = t;
+	/* An IRQ asserted before this point would have had its cut
+	 * overwritten above, so look again:
+	 */
+	__sync_synchronize();
+	if (irqFlag)
+		cutRun();
+}
+
+/* Returns the number of ticks until a DEC exception becomes deliverable, as
+ * far as is known now (i.e. never if MSR[EE]=0; setting EE cuts the run).
+ */
+u64	PPCCPUState::ticksToDECPending()
+{
+	if (!(msr & MSR_EE))
+		return ~0ULL;
+	if (cpu_inst_count < dec_deadline)
+		return dec_deadline - cpu_inst_count;
+	REG d = getDEC();
+	if (d & 0x80000000)
+		return 1;
+	/* It's decremented all the way round to positive again: */
+	setDECBase(d);
+	return dec_deadline - cpu_inst_count;
+}
+
+void	PPCCPUState::doze()
+{
+	u64 now = cpu_inst_count;
+	u64 ticks = run_horizon > now ? run_horizon - now : 0;
+	struct timespec start, end, deadline;
+
+	if (ticks == 0)
+		return;
+	COUNT(CTR_CPU_DOZE);
+
+	/* Cap it, an interrupt will come along in a bit anyway: */
+	ticks = MIN(ticks, DOZE_TICKS_PER_SEC * 60);
+	u64 ns = ticks * 1000000000ULL / DOZE_TICKS_PER_SEC;
+
+	clock_gettime(CLOCK_REALTIME, &start);
+	deadline.tv_sec = start.tv_sec + (start.tv_nsec + ns) / 1000000000ULL;
+	deadline.tv_nsec = (start.tv_nsec + ns) % 1000000000ULL;
+
+	pthread_mutex_lock(&doze_lock);
+	dozing = true;
+	/* Pairs with assertIRQ(): either it sees dozing, or this sees the IRQ */
+	__sync_synchronize();
+	bool timeout = false;
+	while (!irqFlag && !timeout)
+		timeout = pthread_cond_timedwait(&doze_cond, &doze_lock, &deadline) == ETIMEDOUT;
+	dozing = false;
+	pthread_mutex_unlock(&doze_lock);
+
+	if (!timeout) {
+		/* Woken early, so only the time actually dozed has passed: */
+		clock_gettime(CLOCK_REALTIME, &end);
+		s64 slept = (s64)(end.tv_sec - start.tv_sec) * 1000000000LL +
+			(end.tv_nsec - start.tv_nsec);
+		if (slept < 0)
+			slept = 0;
+		ticks = MIN(ticks, (u64)slept * DOZE_TICKS_PER_SEC / 1000000000ULL);
+	}
+	CPUTick(ticks);
+}
+
 /* This fn munges MSR and PC, SRR0/1, to deliver exception e.
  * It assumes that exception-related regs like DSISR/DAR are set up
  * already.
@@ -132,8 +231,8 @@ void	PPCCPUState::takeException(exception_t e, REG new_srr1)
 	msr = msr & MSR_IP; // FIXME will be OK for now, but will break little endian!
 	pc = ((msr & MSR_IP) ? 0xfff00000 : 0) + (PA)e;
 
-	/* Update MMU's view of IR/DR: */
-	mmu->setIRDR(getMSR() & MSR_IR, getMSR() & MSR_DR);
+	/* Update MMU's view of PR/IR/DR: */
+	mmu->setMode(isPrivileged(), getMSR() & MSR_IR, getMSR() & MSR_DR);
 
 	/* "A little hacky, but..."  If JIT, then break out of the current
 	 * block.  Return from here to the start of the runloop:
@@ -255,6 +354,14 @@ void	PPCCPUState::raisePROGException(u32 reason)
 	takeException(EXC_PROG, (getMSR() & 0x8000ffff) | reason);
 }
 
+void	PPCCPUState::raiseFPUnavailException()
+{
+	COUNT(CTR_EXCEPTION_FPUN);
+
+	EXCTRACE("Delivering FP unavailable exception\n");
+	takeException(EXC_FPUN, getMSR());
+}
+
 void	PPCCPUState::raiseSCException()
 {
 	COUNT(CTR_EXCEPTION_SC);
@@ -25,10 +25,13 @@
 #define PPCCPUSTATE_H
 
 #include <setjmp.h>
+#include <pthread.h>
 #include <cstddef>
 
 #include "types.h"
 #include "utility.h"
+#include "portable_endian.h"
+#include "ram_order.h"
 #include "PPCMMU.h"
 
 #define RESET_MSR_VAL	0x0
@@ -36,6 +39,11 @@
 /* TB increments by 1 every 4 instructions: */
 #define TB_SHIFT	2
 
+/* Instructions aren't executed whilst dozing, but time still passes; this
+ * is how many ticks pass per second of host time:
+ */
+#define DOZE_TICKS_PER_SEC	100000000ULL
+
 class PPCCPUState {
 public:
         PPCCPUState();
@@ -73,14 +81,50 @@ public:
 	void	setPC(REG v)				{ pc = v; }
 	void	setCTR(REG v)				{ ctr = v; }
 	void	setLR(REG v)				{ lr = v; }
-	void	setXER(REG32 v)				{ xer = v & 0xe000007f; }
-	void    setXER_SO(bool v)			{ xer = (xer & ~XER_SO); if (v) { xer |= XER_SO; } }
+	/* (A lazy CR0 samples SO, so must be resolved before SO changes.) */
+	void	setXER(REG32 v)				{ syncCR0(); xer = v & 0xe000007f; }
+	void    setXER_SO(bool v)			{ syncCR0(); xer = (xer & ~XER_SO); if (v) { xer |= XER_SO; } }
 	void    setXER_OV(bool v)			{ xer = (xer & ~XER_OV); if (v) { xer |= XER_OV; } }
 	void    setXER_CA(bool v)			{ xer = (xer & ~XER_CA); if (v) { xer |= XER_CA; } }
-	void	setCR(REG32 v)				{ cr = v; }
-	void	setMSR(REG32 v)				{ msr = v; }
+	void	setCR(REG32 v)
+	{
+#if ENABLE_LAZY_FLAGS
+		cr0_pending = false;
+#endif
+		cr = v;
+	}
+	/* Set CR0 from comparing a result to 0 (and XER.SO).  With
+	 * LAZY_FLAGS this just stashes the result, and CR0 is worked out
+	 * when CR is next read; it's frequently overwritten before then.
+	 */
+	void	setCR0Result(REG32 r)
+	{
+#if ENABLE_LAZY_FLAGS
+		cr0_result = r;
+		cr0_pending = true;
+#else
+		cr = (cr & 0x0fffffff) | (cmp0(r) << 28);
+#endif
+	}
+	void	setMSR(REG32 v)
+	{
+		/* Enabling EE might make a DEC/IRQ deliverable now, and
+		 * setting POW means the run loop has to doze:
+		 */
+		if ((v & ~msr) & (MSR_EE | MSR_POW))
+			cutRun();
+		msr = v;
+	}
 	void	setPIR(REG32 v)				{ pir = v; }
-	void	setTB(u64 t)				{ tb = t << TB_SHIFT; }
+	void	setTB(u64 t)
+	{
+		REG d = getDEC();
+		tb = t << TB_SHIFT;
+		tb_ticks = cpu_inst_count;
+		/* DEC carries on from where it was, against the new TB: */
+		setDECBase(d);
+		cutRun();
+	}
 	void	setHID0(u32 v)				{ hid0 = v; }
 	void	setHID1(u32 v)				{ hid1 = v; }
 	void	setSPRG0(REG v)				{ sprg0 = v; }
@@ -92,21 +136,37 @@ public:
 	void	setSRR1(REG v)				{ srr1 = v; }
 	void	setDAR(REG v)				{ dar = v; }
 	void	setDSISR(REG v)				{ dsisr = v; }
-	void	setDEC(REG v)				{ dec = v; }
+	void	setDEC(REG v)				{ setDECBase(v); cutRun(); }
+	/* FPRs hold raw doubles, so that e.g. SNaNs survive moves: */
+	void	setFPR(unsigned int r, u64 d)		{ ASSERT(r < 32); fprs[r] = d; }
+	void	setFPSCR(u32 v)				{ fpscr = v; }
 
 	// Get accessors
        	REG	getPC()					{ return pc; }
 	REG32	getMSR()				{ return msr; }
 	REG	getGPR(unsigned int r)			{ ASSERT(r < 32); return gprs[r]; }
+	/* Bulk transfer of n GPRs from r, to/from aligned RAM (for lmw/stmw): */
+	void	setGPRsRAM(unsigned int r, unsigned int n, const u8 *src)
+	{
+		ASSERT(r + n <= 32);
+		for (unsigned int i = 0; i < n; i++)
+			ram_load(src + i*4, &gprs[r + i]);
+	}
+	void	getGPRsRAM(unsigned int r, unsigned int n, u8 *dest)
+	{
+		ASSERT(r + n <= 32);
+		for (unsigned int i = 0; i < n; i++)
+			ram_store(dest + i*4, (u32)gprs[r + i]);
+	}
 	REG	getCTR()				{ return ctr; }
 	REG	getLR()					{ return lr; }
 	REG32	getXER()				{ return xer; }
 	u32	getXER_SO()				{ return (xer & XER_SO) ? 1 : 0; }
 	u32	getXER_OV()				{ return (xer & XER_OV) ? 1 : 0; }
 	u32	getXER_CA()				{ return (xer & XER_CA) ? 1 : 0; }
-	REG32	getCR()					{ return cr; }
+	REG32	getCR()					{ syncCR0(); return cr; }
 	u32	getPIR()				{ return pir; }
-	u64	getTB()					{ return (tb >> TB_SHIFT); }
+	u64	getTB()					{ return getTBRaw() >> TB_SHIFT; }
 	u32	getHID0()				{ return hid0; }
 	u32	getHID1()				{ return hid1; }
 	REG	getSPRG0()				{ return sprg0; }
@@ -118,27 +178,81 @@ public:
 	REG	getSRR1()				{ return srr1; }
 	REG	getDAR()				{ return dar; }
 	REG	getDSISR()				{ return dsisr; }
-	REG	getDEC()				{ return dec; }
+	REG	getDEC()				{ return dec - (REG)(getTB() - dec_tb); }
+	u64	getFPR(unsigned int r)			{ ASSERT(r < 32); return fprs[r]; }
+	u32	getFPSCR()				{ return fpscr; }
 
 	bool	isPrivileged()				{ return !(msr & MSR_PR); }
 	bool	isHyp()					{ return false; }
 
 	// Misc
-	void	CPUTick(unsigned int t = 1)
+	/* This just counts instructions; TB and DEC are worked out from the
+	 * count when they're read (see getTBRaw()).
+	 */
+	void	CPUTick(u64 t = 1)			{ cpu_inst_count += t; }
+
+	u64	getCPUTicks()				{ return cpu_inst_count; }
+
+	/* A run loop executes instructions until the tick count reaches the
+	 * "horizon", the next point at which it needs to do something (e.g.
+	 * deliver a DEC exception, or poll a device), without checking
+	 * anything else per instruction.  Events that invalidate the horizon
+	 * (an IRQ, possibly from another thread, MSR[EE] being set, DEC
+	 * written, etc.) cut the run short.
+	 */
+	void	setRunHorizon(u64 t);
+	bool	runHorizonReached()			{ return cpu_inst_count >= run_horizon; }
+	/* Will the next tick reach it? */
+	bool	runHorizonImminent()			{ return cpu_inst_count + 1 >= run_horizon; }
+	u64	ticksToHorizon()			{ return run_horizon > cpu_inst_count ? run_horizon - cpu_inst_count : 0; }
+	void	cutRun()				{ run_horizon = 0; }
+	/* The guest is idle until the next event, so warp there; the
+	 * instruction that's just been executed ticks the rest of the way:
+	 */
+	void	skipToHorizon()
 	{
-		cpu_inst_count += t;
-		tb += t;
-		if ((tb & ((1 << TB_SHIFT) - 1)) == 0)
-			dec--;
+		u64 h = run_horizon;
+		if (h > cpu_inst_count + 1 && h != ~0ULL)
+			cpu_inst_count = h - 1;
 	}
+	u64	ticksToDECPending();
 
-	u64	getCPUTicks()				{ return cpu_inst_count; }
+	/* JIT blocks tick the count at their exits, so before calling a
+	 * handler (which mightn't return, if it takes an exception) a block
+	 * notes how many of its instructions have been done, including that
+	 * one.  The runloop ticks them after an exception.
+	 */
+	void	setBlockTicks(u32 t)			{ blk_ticks = t; }
+	u32	getBlockTicks()				{ return blk_ticks; }
+
+	/* MSR[POW] (whichever HID0 power-saving mode is selected) stops the
+	 * CPU until an interrupt.  Without EE nothing could wake it, so it's
+	 * ignored.  doze() blocks the calling thread until the run horizon's
+	 * worth of time has passed, or an IRQ is asserted, and moves the tick
+	 * count on accordingly.
+	 */
+	bool	isDozing()				{ return (msr & (MSR_POW | MSR_EE)) == (MSR_POW | MSR_EE); }
+	void	doze();
 
-	void	assertIRQ(bool status = true)		{ irqFlag = status; }
+	void	assertIRQ(bool status = true)
+	{
+		irqFlag = status;
+		if (status) {
+			/* Pairs with setRunHorizon() and doze() */
+			__sync_synchronize();
+			cutRun();
+			if (dozing) {
+				pthread_mutex_lock(&doze_lock);
+				pthread_cond_signal(&doze_cond);
+				pthread_mutex_unlock(&doze_lock);
+			}
+		}
+	}
 
 	bool	isDecrementerPending()
 	{
-		return (msr & MSR_EE) && (dec & 0x80000000);
+		return (msr & MSR_EE) && cpu_inst_count >= dec_deadline &&
+			(getDEC() & 0x80000000);
 	}
 
 	bool	isIRQPending()
@@ -156,6 +270,7 @@ public:
 	void	raiseDECException();
 	void	raisePROGException(u32 reason);
 	void	raiseSCException();
+	void	raiseFPUnavailException();
         void	raiseMemException(bool RnW, bool InD, VA addr, PPCMMU::fault_t fault, u32 inst);
 
 	static size_t    getPCoffset()
@@ -163,6 +278,49 @@ public:
 		return (uint8_t *)&((PPCCPUState *)0)->pc - (uint8_t *)((PPCCPUState *)0);
 	}
 
+	/* For the JIT's native code (see blockgen.cc): */
+	static size_t    getGPRoffset(unsigned int r)
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->gprs[r] - (uint8_t *)((PPCCPUState *)0);
+	}
+
+	static size_t    getCRoffset()
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->cr - (uint8_t *)((PPCCPUState *)0);
+	}
+
+	static size_t    getXERoffset()
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->xer - (uint8_t *)((PPCCPUState *)0);
+	}
+
+	static size_t    getTicksOffset()
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->cpu_inst_count - (uint8_t *)((PPCCPUState *)0);
+	}
+
+	static size_t    getRunHorizonOffset()
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->run_horizon - (uint8_t *)((PPCCPUState *)0);
+	}
+
+	static size_t    getBlockTicksOffset()
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->blk_ticks - (uint8_t *)((PPCCPUState *)0);
+	}
+
+#if ENABLE_LAZY_FLAGS
+	static size_t    getCR0PendingOffset()
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->cr0_pending - (uint8_t *)((PPCCPUState *)0);
+	}
+
+	static size_t    getCR0ResultOffset()
+	{
+		return (uint8_t *)&((PPCCPUState *)0)->cr0_result - (uint8_t *)((PPCCPUState *)0);
+	}
+#endif
+
 private:
 	// Other objects:
 	PPCMMU *mmu;
@@ -171,14 +329,55 @@ private:
 	// Private functions:
 	void	takeException(exception_t e, REG new_srr1);
 
+	/* CR-style LT/GT/EQ/SO nybble for comparing r to 0: */
+	u32	cmp0(REG32 r)
+	{
+		return ((s32)r < 0 ? 8 : ((s32)r > 0 ? 4 : 2)) | getXER_SO();
+	}
+
+	void	syncCR0()
+	{
+#if ENABLE_LAZY_FLAGS
+		if (cr0_pending) {
+			cr = (cr & 0x0fffffff) | (cmp0(cr0_result) << 28);
+			cr0_pending = false;
+		}
+#endif
+	}
+
+	/* TB (scaled by 1 << TB_SHIFT) advances once per instruction from
+	 * where it was last written:
+	 */
+	u64	getTBRaw()				{ return tb + (cpu_inst_count - tb_ticks); }
+
+	/* DEC decrements whenever TB crosses a multiple of 1 << TB_SHIFT,
+	 * so is kept as its value when TB was dec_tb.  dec_deadline is the
+	 * tick count at which it next goes negative (or now, if it is).
+	 */
+	void	setDECBase(REG v)
+	{
+		dec = v;
+		dec_tb = getTB();
+		if (dec & 0x80000000)
+			dec_deadline = cpu_inst_count;
+		else
+			/* dec+1 more decrements make it negative: */
+			dec_deadline = tb_ticks + ((dec_tb + (u32)dec + 1) << TB_SHIFT) - tb;
+	}
+
 	// User state:
 	REG	gprs[32];
-	// No FPRs
+	u64	fprs[32];	/* Unused without ENABLE_FPU */
+	u32	fpscr;
 	REG	pc;
 	REG	ctr;
 	REG	lr;
 	REG32	xer;		// Is this ever 32?
 	REG32	cr;
+#if ENABLE_LAZY_FLAGS
+	bool	cr0_pending;	/* CR0 is stale; cr0_result holds its source */
+	REG32	cr0_result;
+#endif
 
 	// OS state:
 	REG32	msr;
@@ -198,15 +397,23 @@ private:
 	REG32	hid0;
 	REG32	hid1;
 
-	bool	irqFlag;
+	volatile bool	irqFlag;
 
 	// CPU number
 	REG32	pir;
 
-	u64	tb;
+	u64	tb;			/* At tb_ticks, scaled by 1 << TB_SHIFT */
+	u64	dec_tb;			/* TB when DEC was last set */
 
 	// Sim state
 	u64	cpu_inst_count;
+	u64	tb_ticks;		/* cpu_inst_count when TB last set */
+	u64	dec_deadline;
+	volatile u64 run_horizon;
+	u32	blk_ticks;
+	volatile bool	dozing;
+	pthread_mutex_t	doze_lock;
+	pthread_cond_t	doze_cond;
 };
 
 #endif
@@ -27,6 +27,7 @@
 static __attribute__((unused)) unsigned int 	getOpcode(u32 i)		{ return (i >> 26) & 0x3f; }
 static __attribute__((unused)) unsigned int 	X_XOPC(u32 i)			{ return (i >> 1) & 0x3ff; }
 static __attribute__((unused)) unsigned int 	XL_XOPC(u32 i)			{ return (i >> 1) & 0x3ff; }
+static __attribute__((unused)) unsigned int 	A_XOPC(u32 i)			{ return (i >> 1) & 0x1f; }
 
 static __attribute__((unused)) unsigned int 	getLI(u32 i)			{ return (i >> 2) & 0xffffff; }
 
@@ -53,6 +54,8 @@ static __attribute__((unused)) u32		D_UI(u32 i)			{ return (u16)(i & 0xffff); }
 static __attribute__((unused)) s32		D_D(u32 i)			{ return (s16)(i & 0xffff); }
 static __attribute__((unused)) unsigned int 	D_BF(u32 i)			{ return (i >> 23) & 0x7; }
 static __attribute__((unused)) unsigned int 	D_L(u32 i)			{ return (i >> 21) & 1; }
+static __attribute__((unused)) unsigned int 	D_FRT(u32 i)			{ return (i >> 21) & 0x1f; }
+static __attribute__((unused)) unsigned int 	D_FRS(u32 i)			{ return (i >> 21) & 0x1f; }
 
 static __attribute__((unused)) unsigned int 	X_BF(u32 i)			{ return (i >> 23) & 7; }
 static __attribute__((unused)) unsigned int 	X_RT(u32 i)			{ return (i >> 21) & 0x1f; }
@@ -70,6 +73,13 @@ static __attribute__((unused)) unsigned int 	X_Rc(u32 i)			{ return i & 1; }
 static __attribute__((unused)) unsigned int 	X_TH(u32 i)			{ return (i >> 21) & 0x1f; }
 static __attribute__((unused)) unsigned int 	X_CT(u32 i)			{ return (i >> 21) & 0xf; }
 static __attribute__((unused)) unsigned int 	X_SR(u32 i)			{ return (i >> 16) & 0xf; }
+static __attribute__((unused)) unsigned int 	X_FRT(u32 i)			{ return (i >> 21) & 0x1f; }
+static __attribute__((unused)) unsigned int 	X_FRS(u32 i)			{ return (i >> 21) & 0x1f; }
+static __attribute__((unused)) unsigned int 	X_FRA(u32 i)			{ return (i >> 16) & 0x1f; }
+static __attribute__((unused)) unsigned int 	X_FRB(u32 i)			{ return (i >> 11) & 0x1f; }
+static __attribute__((unused)) unsigned int 	X_BT(u32 i)			{ return (i >> 21) & 0x1f; }
+static __attribute__((unused)) unsigned int 	X_BFA(u32 i)			{ return (i >> 18) & 0x7; }
+static __attribute__((unused)) unsigned int 	X_U(u32 i)			{ return (i >> 12) & 0xf; }
 
 static __attribute__((unused)) unsigned int 	XL_BT(u32 i)			{ return (i >> 21) & 0x1f; }
 static __attribute__((unused)) unsigned int 	XL_BO(u32 i)			{ return (i >> 21) & 0x1f; }
@@ -92,6 +102,16 @@ static __attribute__((unused)) unsigned int 	XO_RB(u32 i)			{ return (i >> 11) &
 static __attribute__((unused)) unsigned int 	XO_OE(u32 i)			{ return (i >> 10) & 1; }	/* Don't need to mask, used as bool */
 static __attribute__((unused)) unsigned int 	XO_Rc(u32 i)			{ return i & 1; }
 
+static __attribute__((unused)) unsigned int 	XFL_FLM(u32 i)			{ return (i >> 17) & 0xff; }
+static __attribute__((unused)) unsigned int 	XFL_FRB(u32 i)			{ return (i >> 11) & 0x1f; }
+static __attribute__((unused)) unsigned int 	XFL_Rc(u32 i)			{ return i & 1; }
+
+static __attribute__((unused)) unsigned int 	A_FRT(u32 i)			{ return (i >> 21) & 0x1f; }
+static __attribute__((unused)) unsigned int 	A_FRA(u32 i)			{ return (i >> 16) & 0x1f; }
+static __attribute__((unused)) unsigned int 	A_FRB(u32 i)			{ return (i >> 11) & 0x1f; }
+static __attribute__((unused)) unsigned int 	A_FRC(u32 i)			{ return (i >> 6) & 0x1f; }
+static __attribute__((unused)) unsigned int 	A_Rc(u32 i)			{ return i & 1; }
+
 static __attribute__((unused)) unsigned int 	M_RA(u32 i)			{ return (i >> 16) & 0x1f; }
 static __attribute__((unused)) unsigned int 	M_RB(u32 i)			{ return (i >> 11) & 0x1f; }
 static __attribute__((unused)) unsigned int 	M_RS(u32 i)			{ return (i >> 21) & 0x1f; }
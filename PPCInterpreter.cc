@@ -21,7 +21,32 @@
  * SOFTWARE.
  */
 
+#include <stdlib.h>
+
 #include "PPCInterpreter.h"
+#include "log.h"
+
+PPCInterpreter::PPCInterpreter() :
+		 want_break(false)
+		,mem_access_fault(PPCMMU::FAULT_NONE)
+		,exc_generation_count(0)
+		,mem_sidefx(0)
+		,idle_iters(0)
+		,bulk_pc(0)
+		,bulk_ctr(0)
+		,bulk_iters(0)
+{
+	memset(&idle_state, 0, sizeof(idle_state));
+#if ENABLE_PREDECODE
+	/* ~20MB, but only pages that get used get touched: */
+	pd_pages = (pd_page_t *)calloc(PD_NR_PAGES, sizeof(pd_page_t));
+	if (!pd_pages)
+		FATAL("Can't allocate predecode cache\n");
+	pd_cur = 0;
+	pd_va = PD_VA_INVALID;
+	pd_trace_variant = false;
+#endif
+}
 
 void	*PPCInterpreter::op_unk(u32 inst)
 {
@@ -36,8 +61,146 @@ void	*PPCInterpreter::op_unk(u32 inst)
 	return 0;
 }
 
+/* A short backwards branch has been taken (to the loop head).  If nothing's
+ * changed since the last time round, the guest is idle until an interrupt
+ * so skip straight to the next event.  Registers are only snapshotted (and
+ * compared the next time round) once the loop's been going a while without
+ * stores etc., as that's not free.
+ */
+void	PPCInterpreter::idle_loop_check()
+{
+	idle_state_t s;
+
+	if (idle_state.pc != pc || idle_state.sidefx != mem_sidefx ||
+	    idle_state.excgen != exc_generation_count) {
+		idle_state.pc = pc;
+		idle_state.sidefx = mem_sidefx;
+		idle_state.excgen = exc_generation_count;
+		idle_iters = 0;
+		return;
+	}
+	if (++idle_iters < IDLE_LOOP_ITERS)
+		return;
+	if (!(cpus->getMSR() & MSR_EE)) {
+		/* Hung, not idle! */
+		idle_iters = 0;
+		return;
+	}
+
+	memset(&s, 0, sizeof(s));
+	s.pc = pc;
+	s.sidefx = mem_sidefx;
+	s.excgen = exc_generation_count;
+	for (int i = 0; i < 32; i++)
+		s.gpr[i] = cpus->getGPR(i);
+	s.ctr = cpus->getCTR();
+	s.lr = cpus->getLR();
+	s.cr = cpus->getCR();
+	s.xer = cpus->getXER();
+	s.msr = cpus->getMSR();
+#if ENABLE_FPU
+	for (int i = 0; i < 32; i++)
+		s.fpr[i] = cpus->getFPR(i);
+	s.fpscr = cpus->getFPSCR();
+#endif
+
+	if (idle_iters == IDLE_LOOP_ITERS) {
+		idle_state = s;
+		return;
+	}
+	if (!memcmp(&s, &idle_state, sizeof(s))) {
+		COUNT(CTR_IDLE_SKIP);
+		cpus->skipToHorizon();
+	}
+	/* Otherwise, something's changing; try again in a while */
+	idle_iters = 0;
+}
+
 void    PPCInterpreter::WRITE_MSR(REG32 val)
 {
 	cpus->setMSR(val);
-	mmu->setIRDR(val & MSR_IR, val & MSR_DR);
+	mmu->setMode(!(val & MSR_PR), val & MSR_IR, val & MSR_DR);
 }
+
+#if ENABLE_PREDECODE
+/* Find the predecode page for the given PC, making it current.  Returns a
+ * fault if the PC can't be fetched from.  If the PC isn't in RAM, the page
+ * isn't cached and pd_cur is NULL; the caller falls back to a plain fetch.
+ */
+PPCMMU::fault_t	PPCInterpreter::pd_setPage(VA pc)
+{
+	u64 pa = 0;
+	PPCMMU::fault_t fault;
+
+	COUNT(CTR_PREDECODE_PAGE_LOOKUP);
+	pd_cur = 0;
+	pd_va = PD_VA_INVALID;
+
+	if (!mmu->translateAddr(pc, &pa, true, true, cpus->isPrivileged(), &fault))
+		return fault;
+	if (pa & PPCMMU_HVA_IO_BIT)
+		return PPCMMU::FAULT_NONE;
+
+	u64 host_page = pa & ~(u64)PD_PAGE_MASK;
+	pd_page_t *p = &pd_pages[PD_PAGE_IDX(host_page)];
+
+	if (p->host_page != host_page) {
+		/* Evict whatever was here.  Bumping the tag invalidates all
+		 * of its entries in one go; tag 0 is never valid.
+		 */
+		COUNT(CTR_PREDECODE_PAGE_NEW);
+		if (++p->tag == 0) {
+			memset(p->insts, 0, sizeof(p->insts));
+			p->tag = 1;
+		}
+		p->host_page = host_page;
+		mmu->watchCodePage(host_page);
+	}
+
+	pd_cur = p;
+	pd_va = pc & ~PD_PAGE_MASK;
+	pd_gencount = mmu->getGenCount();
+	pd_msr = cpus->getMSR() & (MSR_IR | MSR_PR);
+	return PPCMMU::FAULT_NONE;
+}
+
+/* Drop every predecoded instruction, e.g. when the thunks they point to
+ * change.  Bumping the tags means the pages stay put.
+ */
+void	PPCInterpreter::pd_flush()
+{
+	for (unsigned int i = 0; i < PD_NR_PAGES; i++) {
+		pd_page_t *p = &pd_pages[i];
+
+		if (!p->host_page)
+			continue;
+		if (++p->tag == 0) {
+			memset(p->insts, 0, sizeof(p->insts));
+			p->tag = 1;
+		}
+	}
+}
+
+/* Called by the MMU on stores to pages we've cached, and by icbi.  Only the
+ * affected instructions are invalidated, so data sharing a page with code
+ * doesn't cause the rest of the page to be re-decoded.
+ */
+void	PPCInterpreter::invalidateHostRange(u64 host_addr, unsigned int len)
+{
+	u64 start = host_addr & ~3ULL;
+
+#if ENABLE_FUSION
+	/* The instruction before might be fused with the first one written: */
+	if (start & PD_PAGE_MASK)
+		start -= 4;
+#endif
+	for (u64 a = start; a < host_addr + len; a += 4) {
+		pd_page_t *p = &pd_pages[PD_PAGE_IDX(a)];
+
+		if (p->host_page == (a & ~(u64)PD_PAGE_MASK)) {
+			p->insts[(a & PD_PAGE_MASK) >> 2].tag = 0;
+			COUNT(CTR_PREDECODE_INVAL);
+		}
+	}
+}
+#endif
@@ -27,10 +27,12 @@
 #include <cstddef>
 
 #include "AbstractPPCDecoder.h"
+#include "AbstractCodeCache.h"
 #include "PPCCPUState.h"
 #include "PPCMMU.h"
 #include "stats.h"
 #include "inst_utility.h"
+#include "portable_endian.h"
 
 
 #define INTERP_RETURN	do { return 0; } while(0)  // Return value = ?
@@ -43,15 +45,87 @@
 		}								\
 	} while(0)
 
+#if ENABLE_PREDECODE
+/* Predecoded instructions are cached per (host) page of guest RAM: */
+#define PD_PAGE_SIZE	4096
+#define PD_PAGE_MASK	(PD_PAGE_SIZE-1)
+#define PD_PAGE_INSTS	(PD_PAGE_SIZE/4)
+#define PD_NR_PAGES	512
+#define PD_PAGE_IDX(x)	(((x) >> 12) & (PD_NR_PAGES-1))
+#define PD_VA_INVALID	1	/* Never matches a page-aligned VA */
+/* Max instructions per threaded chain.  With -O3 the handlers tail-call each
+ * other, but at -O0 this bounds the stack depth.
+ */
+#define PD_MAX_CHAIN	4096
+#endif
+/* Taken backwards branches shorter than this are checked for idle loops,
+ * once they've gone round IDLE_LOOP_ITERS times without side effects:
+ */
+#define IDLE_LOOP_MAX_BYTES	64
+#define IDLE_LOOP_ITERS		32
+/* bdnz loops up to this long are checked for bulk copy/set, once they've
+ * gone round BULK_LOOP_ITERS times, and if at least BULK_LOOP_MIN_ITERS are
+ * left.  One iteration mustn't store more than BULK_LOOP_MAX_STRIDE bytes:
+ */
+#define BULK_LOOP_MAX_BYTES	128
+#define BULK_LOOP_ITERS		4
+#define BULK_LOOP_MIN_ITERS	4
+#define BULK_LOOP_MAX_STRIDE	256
+
+/* The op_xxx() handlers are templates (on trace_variant, see log.h); each
+ * PPCInterpreter_<Class>.cc instantiates both variants of its handlers with
+ * this:
+ */
+#include "PPCInterpreter_instantiate.h"
+#define INSTANTIATE_OPS(c)	INSTANTIATE_OPS_##c(true) INSTANTIATE_OPS_##c(false)
+
 class PPCInterpreter : public AbstractPPCDecoder<PPCInterpreter>
+#if ENABLE_PREDECODE
+		     , public AbstractCodeCache
+#endif
 {
 public:
-        PPCInterpreter() : want_break(false)
-		,mem_access_fault(PPCMMU::FAULT_NONE)
-		,exc_generation_count(0)
-	{};
+        PPCInterpreter();
 
+	/* Returns whether the tracing variant of the handlers should be run,
+	 * i.e. the trace_variant to pass to execute() and friends.  Predecoded
+	 * instructions refer to one variant, so are flushed when this changes.
+	 */
+	bool		traceVariant()
+	{
+		bool t = LOG_INTERP_TRACING;
+#if ENABLE_PREDECODE
+		if (unlikely(t != pd_trace_variant)) {
+			pd_flush();
+			pd_trace_variant = t;
+		}
+#endif
+		return t;
+	}
+
+	template <bool trace_variant>
 	void		execute()
+	{
+#if ENABLE_THREADED
+		/* One instruction; the thunk's pd_next() stops there. */
+		pd_budget = 1;
+		pd_dispatch<trace_variant>();
+#else
+#if ENABLE_PREDECODE
+		predecoded_t *pd = pd_fetch<trace_variant>();
+		if (likely(pd)) {
+			void *ret = pd->fn(this, pd);
+			(void)ret;
+			COUNT(CTR_INST_EXECUTED);
+			return;
+		}
+#endif
+		execute_uncached<trace_variant>();
+#endif
+	}
+
+	template <bool trace_variant>
+	void		execute_uncached()
 	{
 		void *ret;	// What's the return value for, in the interpreter?
 	fetch:
@@ -61,13 +135,69 @@ public:
                         cpus->raiseMemException(true, true, pc, fault, 0);
 			goto fetch;
 		}
-		ret = decode(inst);
+		ret = decode<trace_variant>(inst);
 		(void)ret;
 		COUNT(CTR_INST_EXECUTED);
 	}
 
+#if ENABLE_THREADED
+	/* Execute a chain of instructions, where each handler dispatches the
+	 * next directly, until the CPU's run horizon is reached (or PD_MAX_CHAIN
+	 * instructions).  Unlike execute(), this does CPUTick() for each
+	 * instruction.
+	 */
+	template <bool trace_variant>
+	void		execute_threaded()
+	{
+		pd_budget = PD_MAX_CHAIN;
+		pd_dispatch<trace_variant>();
+		if (pd_budget == 0) {
+			/* pd_next() doesn't tick the last one: */
+			cpus->CPUTick();
+		}
+	}
+
+	/* Called by the thunks after an instruction completes: */
+	template <bool trace_variant>
+	__attribute__((always_inline))
+	RET_TYPE	pd_next()
+	{
+		if (--pd_budget == 0)
+			return 0;
+		cpus->CPUTick();
+		if (unlikely(cpus->runHorizonReached()))
+			return 0;
+		return pd_dispatch<trace_variant>();
+	}
+
+	template <bool trace_variant>
+	__attribute__((always_inline))
+	RET_TYPE	pd_dispatch()
+	{
+		predecoded_t *pd = pd_fetch<trace_variant>();
+		if (unlikely(!pd))
+			return pd_dispatch_uncached<trace_variant>();
+		COUNT(CTR_INST_EXECUTED);
+		return pd->fn(this, pd);
+	}
+
+	template <bool trace_variant>
+	__attribute__((noinline))
+	RET_TYPE	pd_dispatch_uncached()
+	{
+		execute_uncached<trace_variant>();
+		return pd_next<trace_variant>();
+	}
+#endif
+
 	void 		setCPUState(PPCCPUState *c)	{ cpus = c; }
-	void 		setMMU(PPCMMU *m)		{ mmu = m; }
+	void 		setMMU(PPCMMU *m)
+	{
+		mmu = m;
+#if ENABLE_PREDECODE
+		mmu->setCodeCache(this);
+#endif
+	}
 
 	bool		breakRequested()		{ return want_break; }
 	void		breakRequest()			{ want_break = true; }
@@ -77,7 +207,19 @@ public:
 		return (uint8_t *)&((PPCInterpreter *)0)->cpus - (uint8_t *)((PPCInterpreter *)0);
 	}
 
+	static size_t   getMMUoffset()
+	{
+		return (uint8_t *)&((PPCInterpreter *)0)->mmu - (uint8_t *)((PPCInterpreter *)0);
+	}
+
         void            setPCInst(REG p, u32 i)         { pc = p; inst = i; }
+
+#if ENABLE_PREDECODE
+	/* AbstractCodeCache: */
+	bool		isCodePage(u64 host_page)	{ return pd_pages[PD_PAGE_IDX(host_page)].host_page == host_page; }
+	void		invalidateHostRange(u64 host_addr, unsigned int len);
+	void		invalidateAll()			{ pd_flush(); }
+#endif
 #if DUMMY_MEM_ACCESS == 1
         u32             read_data;
 #endif
@@ -98,6 +240,94 @@ private:
 
 	bool		want_break;
 
+#if ENABLE_PREDECODE
+	typedef struct {
+		u64		host_page;	/* Host VA, or 0 if unused */
+		u32		tag;		/* insts[] with this tag are valid */
+		predecoded_t	insts[PD_PAGE_INSTS];
+	} pd_page_t;
+
+	pd_page_t	*pd_pages;
+
+	/* The page currently being executed from, and the context it was
+	 * looked up in:
+	 */
+	pd_page_t	*pd_cur;
+	VA		pd_va;
+	unsigned int	pd_gencount;
+	REG32		pd_msr;
+	bool		pd_trace_variant;
+
+	PPCMMU::fault_t	pd_setPage(VA pc);
+	void		pd_flush();
+#if ENABLE_THREADED
+	unsigned int	pd_budget;
+#endif
+
+	/* Returns the predecoded instruction at the PC (having taken any
+	 * ISI), or NULL if the PC isn't in RAM.  Sets pc/inst.
+	 */
+	template <bool trace_variant>
+	predecoded_t	*pd_fetch()
+	{
+		predecoded_t *pd;
+	fetch:
+		pc 		= cpus->getPC();
+		/* The current page stays valid while execution stays within
+		 * it, and the translation context is unchanged:
+		 */
+		if (unlikely((pc & ~PD_PAGE_MASK) != pd_va ||
+			     mmu->getGenCount() != pd_gencount ||
+			     (cpus->getMSR() & (MSR_IR | MSR_PR)) != pd_msr)) {
+			PPCMMU::fault_t	fault = pd_setPage(pc);
+			if (fault != PPCMMU::FAULT_NONE) {
+				cpus->raiseMemException(true, true, pc, fault, 0);
+				goto fetch;
+			}
+			if (!pd_cur)	/* Not RAM, so not cached */
+				return 0;
+		}
+		pd = &pd_cur->insts[(pc & PD_PAGE_MASK) >> 2];
+		if (unlikely(pd->tag != pd_cur->tag)) {
+			predecode<trace_variant>(ram_read32((u8 *)(pd_cur->host_page + (pc & PD_PAGE_MASK))), pd);
+			pd->tag = pd_cur->tag;
+			COUNT(CTR_PREDECODE_FILL);
+#if ENABLE_FUSION
+			pd_fuse<trace_variant>(pd);
+#endif
+		}
+		inst = pd->inst;
+		return pd;
+	}
+
+#if ENABLE_FUSION
+	/* Pairs of instructions done by one predecoded entry (see
+	 * PPCInterpreter_Fusion.cc):
+	 */
+	template <bool trace_variant>
+	void		pd_fuse(predecoded_t *pd);
+	bool		fuse_next(const predecoded_t *pd);
+
+	template <bool trace_variant, int cmp_kind>
+	RET_TYPE	fuse_cmp_bc(const predecoded_t *pd);
+	template <bool trace_variant>
+	RET_TYPE	fuse_addic_rc_bc(const predecoded_t *pd);
+	template <bool trace_variant, bool is_addi>
+	RET_TYPE	fuse_lis_imm(const predecoded_t *pd);
+	template <bool trace_variant>
+	RET_TYPE	fuse_mflr_stw(const predecoded_t *pd);
+
+	template <bool trace_variant, int cmp_kind>
+	static RET_TYPE	pd_fuse_cmp_bc(PPCInterpreter *t, const predecoded_t *pd);
+	template <bool trace_variant>
+	static RET_TYPE	pd_fuse_addic_rc_bc(PPCInterpreter *t, const predecoded_t *pd);
+	template <bool trace_variant, bool is_addi>
+	static RET_TYPE	pd_fuse_lis_imm(PPCInterpreter *t, const predecoded_t *pd);
+	template <bool trace_variant>
+	static RET_TYPE	pd_fuse_mflr_stw(PPCInterpreter *t, const predecoded_t *pd);
+#endif
+#endif
+
 	/* A bit of a grim way of doing it, but this gets set to a fault value
 	 * when a LOADx/STOREx helper is called.  This must be checked by an
 	 * instr implementation function by calling MFCHECK() (which deals
@@ -116,6 +346,65 @@ private:
 	VA		reservation_address;	/* Should be a PA!!! */
 	unsigned long	reservation_gencount;
 
+	/* Idle loop detection:  a short loop that goes round without any
+	 * stores, IO (or anything else that might go through the slow memory
+	 * path) or rfi, and with all registers unchanged, will spin until an
+	 * interrupt.  idle_state is a snapshot at a short backwards branch,
+	 * and mem_sidefx counts the memory accesses that might have had an
+	 * effect.
+	 */
+	typedef struct {
+		VA		pc;
+		unsigned long	sidefx;
+		unsigned long	excgen;
+		REG		gpr[32];
+		REG		ctr;
+		REG		lr;
+		REG32		cr;
+		REG32		xer;
+		REG32		msr;
+#if ENABLE_FPU
+		u64		fpr[32];
+		u32		fpscr;
+#endif
+	} idle_state_t;
+
+	unsigned long	mem_sidefx;
+	idle_state_t	idle_state;
+	unsigned int	idle_iters;
+
+	void		idle_loop_check();
+
+	/* Called by branches that are taken: */
+	void		idle_branch(VA dest)
+	{
+		if (unlikely(dest <= pc && pc - dest < IDLE_LOOP_MAX_BYTES))
+			idle_loop_check();
+	}
+
+	/* Bulk loops:  a bdnz loop that just copies or sets memory (e.g.
+	 * clear_page with dcbz, copy_page, memset/memcpy word loops) is done
+	 * with host memcpy()/memset() rather than an instruction at a time.
+	 * bulk_pc/bulk_ctr spot the same loop going round again.  (The
+	 * branch's address is passed in, as the JIT doesn't keep pc up to
+	 * date.)
+	 */
+	VA		bulk_pc;
+	REG		bulk_ctr;
+	unsigned int	bulk_iters;
+
+	void		bulk_loop_check(VA from, VA head);
+	bool		bulk_loop(VA from, VA head);
+
+	/* Called by a taken bdnz: */
+	void		bulk_branch(VA from, VA dest)
+	{
+#if ENABLE_BULK_LOOPS
+		if (unlikely(dest < from && from - dest <= BULK_LOOP_MAX_BYTES))
+			bulk_loop_check(from, dest);
+#endif
+	}
+
 	/************************* Register access ***********************/
 	REG		READ_GPR_OZ(unsigned int roz)	{ return roz ? cpus->getGPR(roz) : 0; }
 	REG		READ_GPR(unsigned int reg)	{ return cpus->getGPR(reg); }
@@ -123,67 +412,55 @@ private:
 	REG32		READ_CR()			{ return cpus->getCR(); }
 	bool		getCRb(unsigned int bit)	{ return !!((cpus->getCR() >> (31-bit)) & 1); }
 	REG32		READ_MSR()			{ return cpus->getMSR(); }
+	u64		READ_FPR(unsigned int reg)	{ return cpus->getFPR(reg); }
 
 	void		WRITE_GPR(unsigned int reg, REG val)	{ cpus->setGPR(reg, val); }
 	void            WRITE_CA(bool ca)               { cpus->setXER_CA(ca); }
 	void            WRITE_CR(REG32 val)             { cpus->setCR(val); }
 	void            WRITE_MSR(REG32 val);
+	void		WRITE_FPR(unsigned int reg, u64 val)	{ cpus->setFPR(reg, val); }
 
 	void		incPC()				{ cpus->setPC(cpus->getPC() + 4); }
 	REG		getPC()				{ return cpus->getPC(); }
 
 	/************************* Memory access *************************/
 #if DUMMY_MEM_ACCESS == 0
-	REG		LOAD8(ADR addr)
-	{
-		u8	val;
-		mem_access_fault = mmu->load8(addr, (u8 *)&val, cpus->isPrivileged());
-		if (mem_access_fault != PPCMMU::FAULT_NONE)
-			mem_access_addr = addr;
-		return val;
-	}
-
-	REG		LOAD16(ADR addr)
+	/* Try the MMU's inline fast path first, then the full accessor: */
+	template <typename T>
+	REG		LOADx(ADR addr)
 	{
-		u16	val;
-		mem_access_fault = mmu->load16(addr, (u16 *)&val, cpus->isPrivileged());
-		if (mem_access_fault != PPCMMU::FAULT_NONE)
-			mem_access_addr = addr;
-		return val;
-	}
+		T	val;
 
-	REG		LOAD32(ADR addr)
-	{
-		u32	val;
-		mem_access_fault = mmu->load32(addr, (u32 *)&val, cpus->isPrivileged());
+		if (likely(mmu->fastLoad(addr, &val))) {
+			mem_access_fault = PPCMMU::FAULT_NONE;
+			return val;
+		}
+		mem_sidefx++;
+		mem_access_fault = mmu->load(addr, &val, cpus->isPrivileged());
 		if (mem_access_fault != PPCMMU::FAULT_NONE)
 			mem_access_addr = addr;
 		return val;
 	}
 
-	void		STORE8(ADR addr, uint8_t val)
+	template <typename T>
+	void		STOREx(ADR addr, T val)
 	{
-		mem_access_fault = mmu->store8(addr, val, cpus->isPrivileged());
-
-		if (mem_access_fault != PPCMMU::FAULT_NONE)
-			mem_access_addr = addr;
-	}
-
-	void		STORE16(ADR addr, uint16_t val)
-	{
-		mem_access_fault = mmu->store16(addr, val, cpus->isPrivileged());
-
+		mem_sidefx++;
+		if (likely(mmu->fastStore(addr, val))) {
+			mem_access_fault = PPCMMU::FAULT_NONE;
+			return;
+		}
+		mem_access_fault = mmu->store(addr, val, cpus->isPrivileged());
 		if (mem_access_fault != PPCMMU::FAULT_NONE)
 			mem_access_addr = addr;
 	}
 
-	void		STORE32(ADR addr, uint32_t val)
-	{
-		mem_access_fault = mmu->store32(addr, val, cpus->isPrivileged());
-
-		if (mem_access_fault != PPCMMU::FAULT_NONE)
-			mem_access_addr = addr;
-	}
+	REG		LOAD8(ADR addr)			{ return LOADx<u8>(addr); }
+	REG		LOAD16(ADR addr)		{ return LOADx<u16>(addr); }
+	REG		LOAD32(ADR addr)		{ return LOADx<u32>(addr); }
+	void		STORE8(ADR addr, uint8_t val)	{ STOREx<u8>(addr, val); }
+	void		STORE16(ADR addr, uint16_t val)	{ STOREx<u16>(addr, val); }
+	void		STORE32(ADR addr, uint32_t val)	{ STOREx<u32>(addr, val); }
 #else
 	REG		LOAD8(ADR addr)
 	{
@@ -213,6 +490,23 @@ private:
 	}
 #endif
 
+	/* Doublewords (for FP) are two words, and stop at the first fault: */
+	u64		LOAD64(ADR addr)
+	{
+		u64 hi = LOAD32(addr);
+
+		if (mem_access_fault != PPCMMU::FAULT_NONE)
+			return 0;
+		return (hi << 32) | LOAD32(addr + 4);
+	}
+
+	void		STORE64(ADR addr, u64 val)
+	{
+		STORE32(addr, val >> 32);
+		if (mem_access_fault == PPCMMU::FAULT_NONE)
+			STORE32(addr + 4, (u32)val);
+	}
+
 	/************************* Miscellaneous *************************/
 	void	       *UNDEFINED()			{ return op_unk(inst); }
 	void	       	NOP()				{ }
@@ -225,9 +519,31 @@ private:
 	{
 		LOG("+++ EXIT request, value = %08x\n", returncode);
 		want_break = true;
+		cpus->cutRun();
 	}
 
 	void		blow_reservation()		{ exc_generation_count++; }
+
+	template <bool trace_variant>
+	RET_TYPE	bc_cond(int BO, int BI, int BD, int AA, int LK, bool cr_bit);
+
+	/* Multiple/string ops go a page at a time (PPCInterpreter_Memory.cc): */
+	u8	       *bulk_translate(ADR addr, bool RnW, unsigned int len);
+	bool		string_load(ADR addr, unsigned int nb, int reg);
+	bool		string_store(ADR addr, unsigned int nb, int reg);
+
+	/* FP helpers (PPCInterpreter_Float.cc): */
+	template <int fp_op, bool single>
+	RET_TYPE	fp_arith(int FRT, int FRA, int FRC, int FRB, int Rc);
+	RET_TYPE	fp_load(ADR ea, int FRT, bool single, int RA);
+	RET_TYPE	fp_store(ADR ea, int FRS, int kind, int RA);
+	RET_TYPE	fp_move(int FRT, u64 val, int Rc);
+	RET_TYPE	fp_compare(int BF, int FRA, int FRB, bool ordered);
+	RET_TYPE	fp_convert(int FRT, int FRB, bool to_zero, int Rc);
+	RET_TYPE	fp_set_fpscr(u32 val, u32 mask, int Rc);
+	bool		fp_update(u32 exc, bool inexact, bool rounds = true);
+	void		fp_set_fprf(double r);
+	RET_TYPE	fp_done(int Rc);
 };
 
 #endif
@@ -25,6 +25,7 @@
 
 /********************* Arithmetic *********************/
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_divw(int RA, int RB, int RT, int Rc, int OE)
 {
 	// Inputs 'RA,RB', implicit inputs ''
@@ -61,6 +62,7 @@ RET_TYPE PPCInterpreter::op_divw(int RA, int RB, int RT, int Rc, int OE)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_divwu(int RA, int RB, int RT, int Rc, int OE)
 {
 	// Inputs 'RA,RB', implicit inputs ''
@@ -93,3 +95,5 @@ RET_TYPE PPCInterpreter::op_divwu(int RA, int RB, int RT, int Rc, int OE)
 	INTERP_RETURN;
 }
 
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(Arithmetic)
@@ -27,6 +27,7 @@
 
 static uint32_t branch_count = 0;
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_b(uint32_t LI, int AA, int LK)
 {
 	const char *opc[] = { "b", "bl", "ba", "bla" };
@@ -37,11 +38,12 @@ RET_TYPE PPCInterpreter::op_b(uint32_t LI, int AA, int LK)
 	else
 		dest = cpus->getPC() + offset;
 
-	if (dest == cpus->getPC()) {
-		// Todo: And, IRQs disabled (including HV...)
+	if (dest == cpus->getPC() && !(cpus->getMSR() & MSR_EE)) {
+		// Todo: HV...
 		LOG("\n\nBranch to self, quitting.\n");
 		SIM_QUIT(0);
 	}
+	idle_branch(dest);
 
 	if (LK)
 		cpus->setLR(cpus->getPC() + 4);
@@ -55,12 +57,20 @@ RET_TYPE PPCInterpreter::op_b(uint32_t LI, int AA, int LK)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_bc(int BO, int BI, int BD, int AA, int LK)
 {
-	const char *opc[] = { "bc", "bcl", "bca", "bcla" };
-
 	// bi is cr bit to test (top-down)
-	bool	cr_bit 	= getCRb(BI);
+	return bc_cond<trace_variant>(BO, BI, BD, AA, LK, getCRb(BI));
+}
+
+/* The guts of bc, given the value of CR bit BI (which fused compare-and-branch
+ * ops already have to hand):
+ */
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::bc_cond(int BO, int BI, int BD, int AA, int LK, bool cr_bit)
+{
+	const char *opc[] = { "bc", "bcl", "bca", "bcla" };
 
 	bool	eq	= BO & 0x02;	// If true, test ctr == 0 else != 0
 	bool	n_ctr	= BO & 0x04;	// If true, don't touch or test ctr
@@ -89,7 +99,12 @@ RET_TYPE PPCInterpreter::op_bc(int BO, int BI, int BD, int AA, int LK)
 	}
 
 	if (branch) {
+		VA from = cpus->getPC();
+		idle_branch(dest);
 		cpus->setPC(dest);
+		/* bdnz (whatever the hint bits): */
+		if (!trace_variant && (BO & 0x16) == 0x10 && !LK)
+			bulk_branch(from, dest);
 	} else {
 		incPC();
 	}
@@ -106,6 +121,7 @@ RET_TYPE PPCInterpreter::op_bc(int BO, int BI, int BD, int AA, int LK)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_bclr(int BO, int BI, int BH, int LK)
 {
 	// bi is cr bit to test (top-down)
@@ -147,6 +163,7 @@ RET_TYPE PPCInterpreter::op_bclr(int BO, int BI, int BH, int LK)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_bcctr(int BO, int BI, int BH, int LK)
 {
 	// bi is cr bit to test (top-down)
@@ -185,3 +202,36 @@ RET_TYPE PPCInterpreter::op_bcctr(int BO, int BI, int BH, int LK)
 	INTERP_RETURN;
 }
 
+/* Idioms of bclr/bcctr (see tools/PPC.csv):  branch always, no link. */
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_blr()
+{
+	VA	dest = cpus->getLR() & ~3;
+
+	cpus->setPC(dest);
+
+	DISASS("%08x   %08x  blr\t\t 0x%08x\n", pc, inst, dest);
+	BRTRACE("+++ %08x  Branch dest %08x\n", branch_count++, cpus->getPC()); /* Trace state after branch */
+
+	COUNT(CTR_INST_BLR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_bctr()
+{
+	VA	dest = cpus->getCTR() & ~3;
+
+	cpus->setPC(dest);
+
+	DISASS("%08x   %08x  bctr\t\t 0x%08x\n", pc, inst, dest);
+	BRTRACE("+++ %08x  Branch dest %08x\n", branch_count++, cpus->getPC()); /* Trace state after branch */
+
+	COUNT(CTR_INST_BCTR);
+	INTERP_RETURN;
+}
+
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(Branch)
+template RET_TYPE PPCInterpreter::bc_cond<true>(int BO, int BI, int BD, int AA, int LK, bool cr_bit);
+template RET_TYPE PPCInterpreter::bc_cond<false>(int BO, int BI, int BD, int AA, int LK, bool cr_bit);
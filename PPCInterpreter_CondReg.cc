@@ -25,6 +25,7 @@
 
 /********************* CondReg *********************/
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mcrf(int BF, int BFA)
 {
         uint32_t val_CR = READ_CR();
@@ -38,6 +39,7 @@ RET_TYPE PPCInterpreter::op_mcrf(int BF, int BFA)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mcrxr(int BF)
 {
         uint32_t val_CR = READ_CR();
@@ -52,6 +54,7 @@ RET_TYPE PPCInterpreter::op_mcrxr(int BF)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mfcr(int RT)
 {
         // Inputs '', implicit inputs 'CR'
@@ -70,6 +73,7 @@ RET_TYPE PPCInterpreter::op_mfcr(int RT)
         INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mtcrf(int FXM, int RS)
 {
 	// Inputs 'FXM,RS', implicit inputs ''
@@ -96,3 +100,5 @@ RET_TYPE PPCInterpreter::op_mtcrf(int FXM, int RS)
 	INTERP_RETURN;
 }
 
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(CondReg)
@@ -0,0 +1,958 @@
+/* Copyright 2016-2022 Matt Evans
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+#include <fenv.h>
+#include <string.h>
+
+#include "PPCInterpreter.h"
+
+/********************* Float *********************/
+
+/* FP ops are done with the host's doubles.  The host's exception flags give
+ * OX, UX, ZX and XX/FI; invalid operations are picked out from the operands
+ * beforehand, because the FPSCR records why, and NaNs are propagated the
+ * PowerPC way rather than the host's.  FR is always 0, and results of
+ * enabled overflow/underflow exceptions aren't exponent-adjusted.
+ *
+ * The MR CPU doesn't have an FPU, so without ENABLE_FPU these are all
+ * undefined (the guest's FP emulator catches the program check), as before.
+ */
+
+#if ENABLE_FPU
+#define CHECK_FP()							\
+	do {								\
+		if (unlikely(!(cpus->getMSR() & MSR_FP))) {		\
+			cpus->raiseFPUnavailException();		\
+			INTERP_RETURN;					\
+		}							\
+	} while (0)
+#else
+#define CHECK_FP()	do { return op_unk(inst); } while (0)
+#endif
+
+#define FP_EXP_MASK	0x7ff0000000000000ULL
+#define FP_FRAC_MASK	0x000fffffffffffffULL
+#define FP_QUIET	0x0008000000000000ULL
+#define FP_DEFAULT_QNAN	0x7ff8000000000000ULL
+#define FP_SIGN		0x8000000000000000ULL
+/* What fctiw[z] and mffs put in the upper word (as the 750 does): */
+#define FP_INT_UPPER	0xfff8000000000000ULL
+
+/* Arithmetic ops, for fp_arith(): */
+enum {
+	FPOP_ADD,
+	FPOP_SUB,
+	FPOP_MUL,
+	FPOP_DIV,
+	FPOP_SQRT,
+	FPOP_MADD,
+	FPOP_MSUB,
+	FPOP_NMADD,
+	FPOP_NMSUB,
+	FPOP_RES,
+	FPOP_RSQRTE,
+	FPOP_RSP,
+};
+
+/* Stores, for fp_store(): */
+enum {
+	FPST_SINGLE,
+	FPST_DOUBLE,
+	FPST_IW,
+};
+
+static inline double	u2d(u64 v)	{ double d; memcpy(&d, &v, sizeof(d)); return d; }
+static inline u64	d2u(double d)	{ u64 v; memcpy(&v, &d, sizeof(v)); return v; }
+
+static inline bool	is_nan(u64 v)	{ return (v & ~FP_SIGN) > FP_EXP_MASK; }
+static inline bool	is_snan(u64 v)	{ return is_nan(v) && !(v & FP_QUIET); }
+
+/* A NaN rounded to single precision keeps the top of its fraction: */
+static inline u64	nan_to_single(u64 v)	{ return v & ~0x1fffffffULL; }
+
+/* lfs:  exact, so the host does it, except that it'd quieten SNaNs. */
+static u64	single_to_double(u32 w)
+{
+	if ((w & 0x7f800000) == 0x7f800000)
+		return ((u64)(w & 0x80000000) << 32) | FP_EXP_MASK |
+			((u64)(w & 0x007fffff) << 29);
+
+	float f;
+	memcpy(&f, &w, sizeof(f));
+	return d2u((double)f);
+}
+
+/* stfs:  selects bits, rather than rounding (PEM appendix D.7). */
+static u32	double_to_single(u64 d)
+{
+	unsigned int exp = (d >> 52) & 0x7ff;
+
+	if (exp > 896 || (d & ~FP_SIGN) == 0)
+		return ((d >> 32) & 0xc0000000) | ((d >> 29) & 0x3fffffff);
+	if (exp >= 874) {
+		/* Denormalise; exp is 2^-149 to 2^-127 */
+		u64 frac = (d & FP_FRAC_MASK) | (1ULL << 52);
+		frac >>= 1 + 896 - exp;
+		return ((d >> 32) & 0x80000000) | ((frac >> 29) & 0x7fffff);
+	}
+	/* Undefined; too small */
+	return (d >> 32) & 0x80000000;
+}
+
+/* fmadds & co:  a double FMA cast to float would round twice.  Instead,
+ * round to odd in double (truncate, then set the LSB if anything was lost),
+ * which rounds correctly again to a single's 24 bits.  Exact results are
+ * redone in the real mode, which decides the sign of a zero.
+ */
+static double	fma_single(double a, double c, double b, int rmode)
+{
+	volatile double va = a, vb = b, vc = c;
+	volatile double t;
+	volatile float r;
+
+	fesetround(FE_TOWARDZERO);
+	feclearexcept(FE_INEXACT);
+	t = fma(va, vc, vb);
+	bool lost = fetestexcept(FE_INEXACT);
+	fesetround(rmode);
+	if (lost)
+		t = u2d(d2u(t) | 1);
+	else
+		t = fma(va, vc, vb);
+	/* Only the narrowing's flags count; r keeps it after the clear: */
+	feclearexcept(FE_ALL_EXCEPT);
+	r = t;
+	return r;
+}
+
+/* Work out VX and FEX from the rest: */
+static u32	fp_summarise(u32 f)
+{
+	f &= ~(FPSCR_VX | FPSCR_FEX);
+	if (f & FPSCR_VX_ALL)
+		f |= FPSCR_VX;
+	/* Each enable is 22 bits below its exception: */
+	if (f & (f << 22) & (FPSCR_VX | FPSCR_OX | FPSCR_UX | FPSCR_ZX | FPSCR_XX))
+		f |= FPSCR_FEX;
+	return f;
+}
+
+/* Which invalid operation, if any, the (non-NaN) operands make: */
+template <int fp_op>
+static u32	fp_invalid(double a, double b, double c)
+{
+	switch (fp_op) {
+		case FPOP_ADD:
+			return (isinf(a) && isinf(b) && signbit(a) != signbit(b)) ? FPSCR_VXISI : 0;
+		case FPOP_SUB:
+			return (isinf(a) && isinf(b) && signbit(a) == signbit(b)) ? FPSCR_VXISI : 0;
+		case FPOP_MUL:
+			return ((isinf(a) && c == 0) || (a == 0 && isinf(c))) ? FPSCR_VXIMZ : 0;
+		case FPOP_DIV:
+			if (isinf(a) && isinf(b))
+				return FPSCR_VXIDI;
+			return (a == 0 && b == 0) ? FPSCR_VXZDZ : 0;
+		case FPOP_SQRT:
+		case FPOP_RSQRTE:
+			return (b < 0) ? FPSCR_VXSQRT : 0;
+		case FPOP_MADD:
+		case FPOP_MSUB:
+		case FPOP_NMADD:
+		case FPOP_NMSUB:
+			if ((isinf(a) && c == 0) || (a == 0 && isinf(c)))
+				return FPSCR_VXIMZ;
+			if ((isinf(a) || isinf(c)) && isinf(b)) {
+				bool sub = (fp_op == FPOP_MSUB || fp_op == FPOP_NMSUB);
+				bool psign = signbit(a) != signbit(c);
+
+				if ((psign != (bool)signbit(b)) != sub)
+					return FPSCR_VXISI;
+			}
+			return 0;
+		default:
+			return 0;
+	}
+}
+
+/* Accumulate this op's exceptions into the FPSCR.  Returns true if one is
+ * enabled and should cause a program check.
+ */
+bool	PPCInterpreter::fp_update(u32 exc, bool inexact, bool rounds)
+{
+	u32 f = cpus->getFPSCR();
+
+	if (exc & ~f & FPSCR_EXC_ALL)
+		f |= FPSCR_FX;
+	f |= exc;
+	if (rounds) {
+		f &= ~(FPSCR_FR | FPSCR_FI);
+		if (inexact)
+			f |= FPSCR_FI;
+	}
+	f = fp_summarise(f);
+	cpus->setFPSCR(f);
+
+	if (exc & FPSCR_VX_ALL)
+		exc |= FPSCR_VX;
+	return (exc & (f << 22) & (FPSCR_VX | FPSCR_OX | FPSCR_UX | FPSCR_ZX | FPSCR_XX)) &&
+		(cpus->getMSR() & (MSR_FE0 | MSR_FE1));
+}
+
+void	PPCInterpreter::fp_set_fprf(double r)
+{
+	u32 c;
+	bool neg = signbit(r);
+
+	switch (fpclassify(r)) {
+		case FP_NAN:		c = 0x11;			break;
+		case FP_INFINITE:	c = neg ? 0x09 : 0x05;		break;
+		case FP_ZERO:		c = neg ? 0x12 : 0x02;		break;
+		case FP_SUBNORMAL:	c = neg ? 0x18 : 0x14;		break;
+		default:		c = neg ? 0x08 : 0x04;		break;
+	}
+	cpus->setFPSCR((cpus->getFPSCR() & ~FPSCR_FPRF) | (c << FPSCR_FPRF_SHIFT));
+}
+
+/* Finish an op, with CR1 = FX,FEX,VX,OX if Rc: */
+RET_TYPE	PPCInterpreter::fp_done(int Rc)
+{
+	if (Rc) {
+		REG32 cr = READ_CR();
+		WRITE_CR_FIELD(cr, 1, cpus->getFPSCR() >> 28);
+		WRITE_CR(cr);
+	}
+	incPC();
+	INTERP_RETURN;
+}
+
+template <int fp_op, bool single>
+RET_TYPE	PPCInterpreter::fp_arith(int FRT, int FRA, int FRC, int FRB, int Rc)
+{
+	static const int rmodes[4] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+	const bool uses_a = (fp_op != FPOP_SQRT && fp_op != FPOP_RES &&
+			     fp_op != FPOP_RSQRTE && fp_op != FPOP_RSP);
+	const bool uses_b = (fp_op != FPOP_MUL);
+	const bool uses_c = (fp_op == FPOP_MUL || (fp_op >= FPOP_MADD && fp_op <= FPOP_NMSUB));
+	const bool negate = (fp_op == FPOP_NMADD || fp_op == FPOP_NMSUB);
+
+	CHECK_FP();
+
+	u64	a = READ_FPR(FRA);
+	u64	b = READ_FPR(FRB);
+	u64	c = READ_FPR(FRC);
+	u64	r;
+	u32	exc = 0;
+	bool	inexact = false;
+
+	if ((uses_a && is_snan(a)) || (uses_b && is_snan(b)) || (uses_c && is_snan(c)))
+		exc |= FPSCR_VXSNAN;
+
+	if ((uses_a && is_nan(a)) || (uses_b && is_nan(b)) || (uses_c && is_nan(c))) {
+		/* The first NaN of A, B, C, quietened: */
+		r = (uses_a && is_nan(a)) ? a : ((uses_b && is_nan(b)) ? b : c);
+		r |= FP_QUIET;
+		if (single)
+			r = nan_to_single(r);
+	} else if ((exc = fp_invalid<fp_op>(u2d(a), u2d(b), u2d(c)))) {
+		r = FP_DEFAULT_QNAN;
+	} else {
+		int rn = cpus->getFPSCR() & FPSCR_RN;
+
+		if (unlikely(rn))
+			fesetround(rmodes[rn]);
+		feclearexcept(FE_ALL_EXCEPT);
+
+		/* The volatiles keep the op between the flag accesses: */
+		volatile double va = u2d(a), vb = u2d(b), vc = u2d(c);
+		volatile double vr;
+		double res;
+
+		switch (fp_op) {
+			case FPOP_ADD:		res = va + vb;				break;
+			case FPOP_SUB:		res = va - vb;				break;
+			case FPOP_MUL:		res = va * vc;				break;
+			case FPOP_DIV:		res = va / vb;				break;
+			case FPOP_SQRT:		res = sqrt(vb);				break;
+			case FPOP_MADD:
+			case FPOP_NMADD:
+				res = single ? fma_single(va, vc, vb, rmodes[rn]) : fma(va, vc, vb);
+				break;
+			case FPOP_MSUB:
+			case FPOP_NMSUB:
+				res = single ? fma_single(va, vc, -vb, rmodes[rn]) : fma(va, vc, -vb);
+				break;
+			case FPOP_RES:		res = 1.0 / vb;				break;
+			case FPOP_RSQRTE:	res = 1.0 / sqrt(vb);			break;
+			default:		res = vb;				break;
+		}
+		if (single)
+			res = (float)res;	/* Exact for the FMAs */
+		/* Rounded before negation: */
+		vr = negate ? -res : res;
+
+		int fe = fetestexcept(FE_OVERFLOW | FE_UNDERFLOW | FE_DIVBYZERO | FE_INEXACT);
+
+		if (unlikely(rn))
+			fesetround(FE_TONEAREST);
+
+		if (fe & FE_OVERFLOW)
+			exc |= FPSCR_OX;
+		if (fe & FE_UNDERFLOW)
+			exc |= FPSCR_UX;
+		if (fe & FE_DIVBYZERO)
+			exc |= FPSCR_ZX;
+		if (fe & FE_INEXACT) {
+			exc |= FPSCR_XX;
+			inexact = true;
+		}
+		r = d2u(vr);
+	}
+
+	bool	enabled = fp_update(exc, inexact);
+	u32	f = cpus->getFPSCR();
+
+	/* Enabled invalid/zero-divide exceptions leave FRT alone: */
+	if (!((exc & FPSCR_VX_ALL) && (f & FPSCR_VE)) && !((exc & FPSCR_ZX) && (f & FPSCR_ZE))) {
+		WRITE_FPR(FRT, r);
+		fp_set_fprf(u2d(r));
+	}
+	if (enabled) {
+		cpus->raisePROGException(0x100000);
+		INTERP_RETURN;
+	}
+	return fp_done(Rc);
+}
+
+/* RA is written with the EA for update forms, or is -1: */
+RET_TYPE	PPCInterpreter::fp_load(ADR ea, int FRT, bool single, int RA)
+{
+	u64 val;
+
+	CHECK_FP();
+
+	if (single)
+		val = single_to_double(LOAD32(ea));
+	else
+		val = LOAD64(ea);
+	MFCHECK(1);
+
+	WRITE_FPR(FRT, val);
+	if (RA >= 0)
+		WRITE_GPR(RA, ea);
+	incPC();
+	INTERP_RETURN;
+}
+
+RET_TYPE	PPCInterpreter::fp_store(ADR ea, int FRS, int kind, int RA)
+{
+	u64 val = READ_FPR(FRS);
+
+	CHECK_FP();
+
+	if (kind == FPST_SINGLE)
+		STORE32(ea, double_to_single(val));
+	else if (kind == FPST_IW)
+		STORE32(ea, (u32)val);
+	else
+		STORE64(ea, val);
+	MFCHECK(0);
+
+	if (RA >= 0)
+		WRITE_GPR(RA, ea);
+	incPC();
+	INTERP_RETURN;
+}
+
+/* Moves don't touch the FPSCR: */
+RET_TYPE	PPCInterpreter::fp_move(int FRT, u64 val, int Rc)
+{
+	CHECK_FP();
+
+	WRITE_FPR(FRT, val);
+	return fp_done(Rc);
+}
+
+RET_TYPE	PPCInterpreter::fp_compare(int BF, int FRA, int FRB, bool ordered)
+{
+	CHECK_FP();
+
+	u64	a = READ_FPR(FRA);
+	u64	b = READ_FPR(FRB);
+	u32	c;
+	u32	exc = 0;
+
+	if (is_nan(a) || is_nan(b)) {
+		c = 1;
+		if (is_snan(a) || is_snan(b)) {
+			exc |= FPSCR_VXSNAN;
+			if (ordered && !(cpus->getFPSCR() & FPSCR_VE))
+				exc |= FPSCR_VXVC;
+		} else if (ordered) {
+			exc |= FPSCR_VXVC;
+		}
+	} else {
+		double da = u2d(a), db = u2d(b);
+		c = (da < db) ? 8 : ((da > db) ? 4 : 2);
+	}
+
+	bool enabled = fp_update(exc, false, false);
+	cpus->setFPSCR((cpus->getFPSCR() & ~FPSCR_FPCC) | (c << FPSCR_FPCC_SHIFT));
+
+	REG32 cr = READ_CR();
+	WRITE_CR_FIELD(cr, BF, c);
+	WRITE_CR(cr);
+
+	if (enabled) {
+		cpus->raisePROGException(0x100000);
+		INTERP_RETURN;
+	}
+	incPC();
+	INTERP_RETURN;
+}
+
+/* fctiw[z]; saturates, and FPRF is left alone (it's undefined) */
+RET_TYPE	PPCInterpreter::fp_convert(int FRT, int FRB, bool to_zero, int Rc)
+{
+	CHECK_FP();
+
+	u64	b = READ_FPR(FRB);
+	u32	i;
+	u32	exc = 0;
+	bool	inexact = false;
+
+	if (is_nan(b)) {
+		i = 0x80000000;
+		exc = FPSCR_VXCVI | (is_snan(b) ? FPSCR_VXSNAN : 0);
+	} else {
+		double d = u2d(b), r;
+
+		switch (to_zero ? 1 : (cpus->getFPSCR() & FPSCR_RN)) {
+			case 0:		r = nearbyint(d);	break;
+			case 1:		r = trunc(d);		break;
+			case 2:		r = ceil(d);		break;
+			default:	r = floor(d);		break;
+		}
+		if (r > 2147483647.0) {
+			i = 0x7fffffff;
+			exc = FPSCR_VXCVI;
+		} else if (r < -2147483648.0) {
+			i = 0x80000000;
+			exc = FPSCR_VXCVI;
+		} else {
+			i = (s32)r;
+			inexact = (r != d);
+			if (inexact)
+				exc = FPSCR_XX;
+		}
+	}
+
+	bool enabled = fp_update(exc, inexact);
+
+	if (!((exc & FPSCR_VX_ALL) && (cpus->getFPSCR() & FPSCR_VE)))
+		WRITE_FPR(FRT, FP_INT_UPPER | i);
+	if (enabled) {
+		cpus->raisePROGException(0x100000);
+		INTERP_RETURN;
+	}
+	return fp_done(Rc);
+}
+
+/* mtfs*:  FEX and VX can't be written, they're summaries. */
+RET_TYPE	PPCInterpreter::fp_set_fpscr(u32 val, u32 mask, int Rc)
+{
+	CHECK_FP();
+
+	u32 f = (cpus->getFPSCR() & ~mask) | (val & mask);
+	cpus->setFPSCR(fp_summarise(f));
+	return fp_done(Rc);
+}
+
+/* Loads */
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfs(int RA0, s16 D, int FRT)
+{
+	DISASS("%08x   %08x  lfs\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA0, /* in */ D);
+	COUNT(CTR_INST_LFS);
+	return fp_load(READ_GPR_OZ(RA0) + D, FRT, true, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfsu(int RA, s16 D, int FRT)
+{
+	DISASS("%08x   %08x  lfsu\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA, /* in */ D);
+	COUNT(CTR_INST_LFSU);
+	return fp_load(READ_GPR(RA) + D, FRT, true, RA);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfsx(int RA0, int RB, int FRT)
+{
+	DISASS("%08x   %08x  lfsx\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA0, /* in */ RB);
+	COUNT(CTR_INST_LFSX);
+	return fp_load(READ_GPR_OZ(RA0) + READ_GPR(RB), FRT, true, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfsux(int RA, int RB, int FRT)
+{
+	DISASS("%08x   %08x  lfsux\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA, /* in */ RB);
+	COUNT(CTR_INST_LFSUX);
+	return fp_load(READ_GPR(RA) + READ_GPR(RB), FRT, true, RA);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfd(int RA0, s16 D, int FRT)
+{
+	DISASS("%08x   %08x  lfd\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA0, /* in */ D);
+	COUNT(CTR_INST_LFD);
+	return fp_load(READ_GPR_OZ(RA0) + D, FRT, false, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfdu(int RA, s16 D, int FRT)
+{
+	DISASS("%08x   %08x  lfdu\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA, /* in */ D);
+	COUNT(CTR_INST_LFDU);
+	return fp_load(READ_GPR(RA) + D, FRT, false, RA);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfdx(int RA0, int RB, int FRT)
+{
+	DISASS("%08x   %08x  lfdx\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA0, /* in */ RB);
+	COUNT(CTR_INST_LFDX);
+	return fp_load(READ_GPR_OZ(RA0) + READ_GPR(RB), FRT, false, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lfdux(int RA, int RB, int FRT)
+{
+	DISASS("%08x   %08x  lfdux\t %d,  %d, %d \n", pc, inst, /* out */ FRT, /* in */ RA, /* in */ RB);
+	COUNT(CTR_INST_LFDUX);
+	return fp_load(READ_GPR(RA) + READ_GPR(RB), FRT, false, RA);
+}
+
+/* Stores */
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfs(int FRS, int RA0, s16 D)
+{
+	DISASS("%08x   %08x  stfs\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA0, /* in */ D);
+	COUNT(CTR_INST_STFS);
+	return fp_store(READ_GPR_OZ(RA0) + D, FRS, FPST_SINGLE, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfsu(int FRS, int RA, s16 D)
+{
+	DISASS("%08x   %08x  stfsu\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA, /* in */ D);
+	COUNT(CTR_INST_STFSU);
+	return fp_store(READ_GPR(RA) + D, FRS, FPST_SINGLE, RA);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfsx(int FRS, int RA0, int RB)
+{
+	DISASS("%08x   %08x  stfsx\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA0, /* in */ RB);
+	COUNT(CTR_INST_STFSX);
+	return fp_store(READ_GPR_OZ(RA0) + READ_GPR(RB), FRS, FPST_SINGLE, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfsux(int FRS, int RA, int RB)
+{
+	DISASS("%08x   %08x  stfsux\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA, /* in */ RB);
+	COUNT(CTR_INST_STFSUX);
+	return fp_store(READ_GPR(RA) + READ_GPR(RB), FRS, FPST_SINGLE, RA);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfd(int FRS, int RA0, s16 D)
+{
+	DISASS("%08x   %08x  stfd\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA0, /* in */ D);
+	COUNT(CTR_INST_STFD);
+	return fp_store(READ_GPR_OZ(RA0) + D, FRS, FPST_DOUBLE, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfdu(int FRS, int RA, s16 D)
+{
+	DISASS("%08x   %08x  stfdu\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA, /* in */ D);
+	COUNT(CTR_INST_STFDU);
+	return fp_store(READ_GPR(RA) + D, FRS, FPST_DOUBLE, RA);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfdx(int FRS, int RA0, int RB)
+{
+	DISASS("%08x   %08x  stfdx\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA0, /* in */ RB);
+	COUNT(CTR_INST_STFDX);
+	return fp_store(READ_GPR_OZ(RA0) + READ_GPR(RB), FRS, FPST_DOUBLE, -1);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfdux(int FRS, int RA, int RB)
+{
+	DISASS("%08x   %08x  stfdux\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA, /* in */ RB);
+	COUNT(CTR_INST_STFDUX);
+	return fp_store(READ_GPR(RA) + READ_GPR(RB), FRS, FPST_DOUBLE, RA);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stfiwx(int FRS, int RA0, int RB)
+{
+	DISASS("%08x   %08x  stfiwx\t %d, %d, %d \n", pc, inst, /* in */ FRS, /* in */ RA0, /* in */ RB);
+	COUNT(CTR_INST_STFIWX);
+	return fp_store(READ_GPR_OZ(RA0) + READ_GPR(RB), FRS, FPST_IW, -1);
+}
+
+/* Arithmetic */
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fadd(int FRA, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fadd%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FADD);
+	return fp_arith<FPOP_ADD, false>(FRT, FRA, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fadds(int FRA, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fadds%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FADDS);
+	return fp_arith<FPOP_ADD, true>(FRT, FRA, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fsub(int FRA, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fsub%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FSUB);
+	return fp_arith<FPOP_SUB, false>(FRT, FRA, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fsubs(int FRA, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fsubs%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FSUBS);
+	return fp_arith<FPOP_SUB, true>(FRT, FRA, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fmul(int FRA, int FRC, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fmul%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC);
+	COUNT(CTR_INST_FMUL);
+	return fp_arith<FPOP_MUL, false>(FRT, FRA, FRC, 0, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fmuls(int FRA, int FRC, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fmuls%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC);
+	COUNT(CTR_INST_FMULS);
+	return fp_arith<FPOP_MUL, true>(FRT, FRA, FRC, 0, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fdiv(int FRA, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fdiv%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FDIV);
+	return fp_arith<FPOP_DIV, false>(FRT, FRA, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fdivs(int FRA, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fdivs%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FDIVS);
+	return fp_arith<FPOP_DIV, true>(FRT, FRA, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fsqrt(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fsqrt%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FSQRT);
+	return fp_arith<FPOP_SQRT, false>(FRT, 0, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fsqrts(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fsqrts%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FSQRTS);
+	return fp_arith<FPOP_SQRT, true>(FRT, 0, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fmadd(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fmadd%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FMADD);
+	return fp_arith<FPOP_MADD, false>(FRT, FRA, FRC, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fmadds(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fmadds%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FMADDS);
+	return fp_arith<FPOP_MADD, true>(FRT, FRA, FRC, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fmsub(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fmsub%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FMSUB);
+	return fp_arith<FPOP_MSUB, false>(FRT, FRA, FRC, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fmsubs(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fmsubs%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FMSUBS);
+	return fp_arith<FPOP_MSUB, true>(FRT, FRA, FRC, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fnmadd(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fnmadd%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FNMADD);
+	return fp_arith<FPOP_NMADD, false>(FRT, FRA, FRC, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fnmadds(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fnmadds%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FNMADDS);
+	return fp_arith<FPOP_NMADD, true>(FRT, FRA, FRC, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fnmsub(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fnmsub%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FNMSUB);
+	return fp_arith<FPOP_NMSUB, false>(FRT, FRA, FRC, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fnmsubs(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fnmsubs%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FNMSUBS);
+	return fp_arith<FPOP_NMSUB, true>(FRT, FRA, FRC, FRB, Rc);
+}
+
+/* The estimates are exact, which is within the required precision. */
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fres(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fres%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FRES);
+	return fp_arith<FPOP_RES, true>(FRT, 0, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_frsqrte(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  frsqrte%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FRSQRTE);
+	return fp_arith<FPOP_RSQRTE, false>(FRT, 0, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fsel(int FRA, int FRC, int FRB, int FRT, int Rc)
+{
+	/* NaN isn't >= 0, and -0 is: */
+	u64 val = (u2d(READ_FPR(FRA)) >= 0.0) ? READ_FPR(FRC) : READ_FPR(FRB);
+
+	DISASS("%08x   %08x  fsel%s\t %d,  %d, %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRA, /* in */ FRC, /* in */ FRB);
+	COUNT(CTR_INST_FSEL);
+	return fp_move(FRT, val, Rc);
+}
+
+/* Moves and conversions */
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fmr(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fmr%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FMR);
+	return fp_move(FRT, READ_FPR(FRB), Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fneg(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fneg%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FNEG);
+	return fp_move(FRT, READ_FPR(FRB) ^ FP_SIGN, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fabs(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fabs%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FABS);
+	return fp_move(FRT, READ_FPR(FRB) & ~FP_SIGN, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fnabs(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fnabs%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FNABS);
+	return fp_move(FRT, READ_FPR(FRB) | FP_SIGN, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_frsp(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  frsp%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FRSP);
+	return fp_arith<FPOP_RSP, true>(FRT, 0, 0, FRB, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fctiw(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fctiw%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FCTIW);
+	return fp_convert(FRT, FRB, false, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fctiwz(int FRB, int FRT, int Rc)
+{
+	DISASS("%08x   %08x  fctiwz%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ FRT, /* in */ FRB);
+	COUNT(CTR_INST_FCTIWZ);
+	return fp_convert(FRT, FRB, true, Rc);
+}
+
+/* Compares */
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fcmpu(int FRA, int FRB, int BF)
+{
+	DISASS("%08x   %08x  fcmpu\t %d,  %d, %d \n", pc, inst, /* out */ BF, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FCMPU);
+	return fp_compare(BF, FRA, FRB, false);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_fcmpo(int FRA, int FRB, int BF)
+{
+	DISASS("%08x   %08x  fcmpo\t %d,  %d, %d \n", pc, inst, /* out */ BF, /* in */ FRA, /* in */ FRB);
+	COUNT(CTR_INST_FCMPO);
+	return fp_compare(BF, FRA, FRB, true);
+}
+
+/* FPSCR */
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mffs(int FRT, int Rc)
+{
+	DISASS("%08x   %08x  mffs%s\t %d [FPSCR = %08x]\n", pc, inst, (Rc ? "." : ""), /* out */ FRT, cpus->getFPSCR());
+	COUNT(CTR_INST_MFFS);
+	return fp_move(FRT, FP_INT_UPPER | cpus->getFPSCR(), Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mtfsf(int FLM, int FRB, int Rc)
+{
+	u32 mask = 0;
+
+	for (int i = 0; i < 8; i++)
+		if (FLM & (0x80 >> i))
+			mask |= 0xf0000000 >> (i * 4);
+
+	DISASS("%08x   %08x  mtfsf%s\t %02x, %d \n", pc, inst, (Rc ? "." : ""), /* in */ FLM, /* in */ FRB);
+	COUNT(CTR_INST_MTFSF);
+	return fp_set_fpscr((u32)READ_FPR(FRB), mask, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mtfsfi(int U, int BF, int Rc)
+{
+	DISASS("%08x   %08x  mtfsfi%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ BF, /* in */ U);
+	COUNT(CTR_INST_MTFSFI);
+	return fp_set_fpscr((u32)U << (28 - BF * 4), 0xf0000000 >> (BF * 4), Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mtfsb0(int BT, int Rc)
+{
+	DISASS("%08x   %08x  mtfsb0%s\t %d \n", pc, inst, (Rc ? "." : ""), /* out */ BT);
+	COUNT(CTR_INST_MTFSB0);
+	return fp_set_fpscr(0, 0x80000000 >> BT, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mtfsb1(int BT, int Rc)
+{
+	u32 bit = 0x80000000 >> BT;
+
+	DISASS("%08x   %08x  mtfsb1%s\t %d \n", pc, inst, (Rc ? "." : ""), /* out */ BT);
+	COUNT(CTR_INST_MTFSB1);
+	/* Setting an exception bit sets FX too: */
+	if (bit & FPSCR_EXC_ALL & ~cpus->getFPSCR())
+		bit |= FPSCR_FX;
+	return fp_set_fpscr(bit, bit, Rc);
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mcrfs(int BFA, int BF)
+{
+	DISASS("%08x   %08x  mcrfs\t %d, %d \n", pc, inst, /* out */ BF, /* in */ BFA);
+	COUNT(CTR_INST_MCRFS);
+
+	CHECK_FP();
+
+	u32 f = cpus->getFPSCR();
+	u32 field = 0xf0000000 >> (BFA * 4);
+
+	REG32 cr = READ_CR();
+	WRITE_CR_FIELD(cr, BF, (f & field) >> (28 - BFA * 4));
+	WRITE_CR(cr);
+
+	/* The exception bits copied are cleared: */
+	f &= ~(field & (FPSCR_FX | FPSCR_EXC_ALL));
+	cpus->setFPSCR(fp_summarise(f));
+
+	incPC();
+	INTERP_RETURN;
+}
+
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(Float)
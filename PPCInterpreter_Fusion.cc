@@ -0,0 +1,256 @@
+/* Copyright 2016-2022 Matt Evans
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "PPCInterpreter.h"
+
+/********************* Fusion *********************/
+
+#if ENABLE_FUSION
+/* Some pairs of instructions nearly always appear together (compare then
+ * branch, lis then ori, etc.).  When the first of a pair is predecoded, its
+ * entry's thunk is swapped for one that does both:  the second instruction
+ * is the next entry in the page, whose fields are used as normal.  A branch
+ * straight to the second instruction still finds its own (unfused) entry.
+ *
+ * Exceptions stay precise because the halves are still done in order, and
+ * the second only happens once the first has completed normally (see
+ * fuse_next()).  A store to the second instruction also invalidates the
+ * first (see invalidateHostRange()).
+ *
+ * The fused handlers don't do disassembly, so only the non-tracing variant
+ * fuses anything.
+ */
+
+enum {
+	FUSE_CMP,
+	FUSE_CMPI,
+	FUSE_CMPL,
+	FUSE_CMPLI,
+};
+
+/* Called between the halves of a fused pair, once the first has been done.
+ * Returns false if the second shouldn't be done:  the first didn't carry on
+ * to the next instruction (e.g. took an exception), or the run horizon is
+ * reached.  Either way, the second is then run from its own entry.
+ * Otherwise the first is ticked here, and the caller ticks the second as
+ * usual.
+ */
+bool	PPCInterpreter::fuse_next(const predecoded_t *pd)
+{
+	if (cpus->getPC() != pc + 4 || cpus->runHorizonImminent())
+		return false;
+	cpus->CPUTick();
+	COUNT(CTR_INST_EXECUTED);
+	pc += 4;
+	inst = pd[1].inst;
+	return true;
+}
+
+/* cmp[l][i] crN, ... ; bc ..., crN[x], ...
+ * The branch tests the field just computed, so doesn't need to read CR back.
+ */
+template <bool trace_variant, int cmp_kind>
+RET_TYPE PPCInterpreter::fuse_cmp_bc(const predecoded_t *pd)
+{
+	int	BF = pd->f[0];
+	REG	a = READ_GPR(pd->f[1]);
+	u32	c;
+
+	switch (cmp_kind) {
+		case FUSE_CMP:
+			c = CMP(a, READ_GPR(pd->f[2]));
+			COUNT(CTR_INST_CMP);
+			break;
+		case FUSE_CMPI:
+			c = CMP(a, (s16)pd->f[2]);
+			COUNT(CTR_INST_CMPI);
+			break;
+		case FUSE_CMPL:
+			c = CMPu(a, READ_GPR(pd->f[2]));
+			COUNT(CTR_INST_CMPL);
+			break;
+		default:
+			c = CMPu(a, (u16)pd->f[2]);
+			COUNT(CTR_INST_CMPLI);
+			break;
+	}
+	REG32 cr = READ_CR();
+	WRITE_CR_FIELD(cr, BF, c);
+	WRITE_CR(cr);
+	incPC();
+
+	if (!fuse_next(pd))
+		INTERP_RETURN;
+
+	const predecoded_t *b = &pd[1];
+	int BI = b->f[1];
+	return bc_cond<trace_variant>(b->f[0], BI, b->f[2], b->f[3], b->f[4], (c >> (3 - (BI & 3))) & 1);
+}
+
+/* addic. rT, ... ; bc ..., cr0[x], ...
+ * CR0 is left for SET_CR0's lazy evaluation; the branch uses the result.
+ */
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::fuse_addic_rc_bc(const predecoded_t *pd)
+{
+	op_addic_rc<trace_variant>(pd->f[0], pd->f[1], pd->f[2]);
+
+	if (!fuse_next(pd))
+		INTERP_RETURN;
+
+	const predecoded_t *b = &pd[1];
+	int BI = b->f[1];
+	u32 c = CMP(READ_GPR(pd->f[2]), 0);
+	return bc_cond<trace_variant>(b->f[0], BI, b->f[2], b->f[3], b->f[4], (c >> (3 - BI)) & 1);
+}
+
+/* lis rT, hi ; ori/addi rX, rT, lo */
+template <bool trace_variant, bool is_addi>
+RET_TYPE PPCInterpreter::fuse_lis_imm(const predecoded_t *pd)
+{
+	REG	hi = (REG)pd->f[0] << 16;
+
+	WRITE_GPR(pd->f[1], hi);
+	incPC();
+	COUNT(CTR_INST_LIS);
+
+	if (!fuse_next(pd))
+		INTERP_RETURN;
+
+	const predecoded_t *n = &pd[1];
+	if (is_addi) {
+		WRITE_GPR(n->f[2], hi + (REG)n->f[1]);
+		COUNT(CTR_INST_ADDI);
+	} else {
+		WRITE_GPR(n->f[2], hi | (REG)n->f[1]);
+		COUNT(CTR_INST_ORI);
+	}
+	incPC();
+	INTERP_RETURN;
+}
+
+/* mflr rT ; stw rS, d(rA) */
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::fuse_mflr_stw(const predecoded_t *pd)
+{
+	WRITE_GPR(pd->f[1], cpus->getLR());
+	incPC();
+	COUNT(CTR_INST_MFSPR);
+
+	if (!fuse_next(pd))
+		INTERP_RETURN;
+
+	const predecoded_t *n = &pd[1];
+	return op_stw<trace_variant>(n->f[0], n->f[1], n->f[2]);
+}
+
+/* Thunks for the fused entries: */
+template <bool trace_variant, int cmp_kind>
+RET_TYPE PPCInterpreter::pd_fuse_cmp_bc(PPCInterpreter *t, const predecoded_t *pd)
+{
+	PD_CALL(t, (t->fuse_cmp_bc<trace_variant, cmp_kind>(pd)));
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::pd_fuse_addic_rc_bc(PPCInterpreter *t, const predecoded_t *pd)
+{
+	PD_CALL(t, t->fuse_addic_rc_bc<trace_variant>(pd));
+}
+
+template <bool trace_variant, bool is_addi>
+RET_TYPE PPCInterpreter::pd_fuse_lis_imm(PPCInterpreter *t, const predecoded_t *pd)
+{
+	PD_CALL(t, (t->fuse_lis_imm<trace_variant, is_addi>(pd)));
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::pd_fuse_mflr_stw(PPCInterpreter *t, const predecoded_t *pd)
+{
+	PD_CALL(t, t->fuse_mflr_stw<trace_variant>(pd));
+}
+
+/* pd has just been predecoded; if it's the first of a pair that can be
+ * fused, point it at the fused thunk.  The next instruction is predecoded
+ * too, if need be (and might itself be the first of another pair).
+ */
+template <bool trace_variant>
+void	PPCInterpreter::pd_fuse(predecoded_t *pd)
+{
+	typedef RET_TYPE (*pd_fn_t)(PPCInterpreter *t, const predecoded_t *pd);
+	pd_fn_t	fn = pd->fn;
+	pd_fn_t	fused = 0;
+
+	if (trace_variant)
+		return;
+	if (fn != &pd_op_cmp<trace_variant> && fn != &pd_op_cmpi<trace_variant> &&
+	    fn != &pd_op_cmpl<trace_variant> && fn != &pd_op_cmpli<trace_variant> &&
+	    fn != &pd_op_addic_rc<trace_variant> && fn != &pd_op_lis<trace_variant> &&
+	    !(fn == &pd_op_mfspr<trace_variant> && pd->f[0] == SPR_LR))
+		return;
+
+	unsigned int idx = pd - pd_cur->insts;
+	if (idx == PD_PAGE_INSTS - 1)
+		return;
+
+	predecoded_t *n = &pd[1];
+	if (n->tag != pd_cur->tag) {
+		predecode<trace_variant>(ram_read32((u8 *)(pd_cur->host_page + (idx + 1) * 4)), n);
+		n->tag = pd_cur->tag;
+		COUNT(CTR_PREDECODE_FILL);
+		pd_fuse<trace_variant>(n);
+	}
+
+	if (n->fn == &pd_op_bc<trace_variant>) {
+		unsigned int BI = n->f[1];
+
+		if ((unsigned int)pd->f[0] == BI >> 2) {
+			if (fn == &pd_op_cmp<trace_variant>)
+				fused = &pd_fuse_cmp_bc<trace_variant, FUSE_CMP>;
+			else if (fn == &pd_op_cmpi<trace_variant>)
+				fused = &pd_fuse_cmp_bc<trace_variant, FUSE_CMPI>;
+			else if (fn == &pd_op_cmpl<trace_variant>)
+				fused = &pd_fuse_cmp_bc<trace_variant, FUSE_CMPL>;
+			else if (fn == &pd_op_cmpli<trace_variant>)
+				fused = &pd_fuse_cmp_bc<trace_variant, FUSE_CMPLI>;
+		}
+		if (fn == &pd_op_addic_rc<trace_variant> && BI < 4)
+			fused = &pd_fuse_addic_rc_bc<trace_variant>;
+	} else if (fn == &pd_op_lis<trace_variant>) {
+		/* ori's RS, or addi's RA (which isn't 0, else it'd be li): */
+		if (n->fn == &pd_op_ori<trace_variant> && n->f[0] == pd->f[1])
+			fused = &pd_fuse_lis_imm<trace_variant, false>;
+		else if (n->fn == &pd_op_addi<trace_variant> && n->f[0] == pd->f[1])
+			fused = &pd_fuse_lis_imm<trace_variant, true>;
+	} else if (fn == &pd_op_mfspr<trace_variant> && n->fn == &pd_op_stw<trace_variant>) {
+		fused = &pd_fuse_mflr_stw<trace_variant>;
+	}
+
+	if (fused) {
+		pd->fn = fused;
+		COUNT(CTR_PREDECODE_FUSED);
+	}
+}
+
+template void	PPCInterpreter::pd_fuse<true>(predecoded_t *pd);
+template void	PPCInterpreter::pd_fuse<false>(predecoded_t *pd);
+#endif
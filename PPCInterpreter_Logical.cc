@@ -25,6 +25,7 @@
 
 /********************* Logical *********************/
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_cntlzw(int RS, int RA, int Rc)
 {
 	// Inputs 'RS', implicit inputs ''
@@ -55,6 +56,7 @@ static u32 mkmask(int MB, int ME)
 		( (0xffffffff << (31-ME)) | ~(0xfffffffeu << (31-MB)));
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_rlwimi(int RA, int RS, int SH, int MB, int ME, int Rc)
 {
 	// Inputs 'RA,RS,SH,MB,ME', implicit inputs ''
@@ -77,6 +79,7 @@ RET_TYPE PPCInterpreter::op_rlwimi(int RA, int RS, int SH, int MB, int ME, int R
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_rlwinm(int RS, int SH, int MB, int ME, int RA, int Rc)
 {
 	// Inputs 'RS,SH,MB,ME', implicit inputs ''
@@ -99,6 +102,7 @@ RET_TYPE PPCInterpreter::op_rlwinm(int RS, int SH, int MB, int ME, int RA, int R
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_rlwnm(int RB, int RS, int MB, int ME, int RA, int Rc)
 {
 	// Inputs 'RB,RS,MB,ME', implicit inputs ''
@@ -123,6 +127,7 @@ RET_TYPE PPCInterpreter::op_rlwnm(int RB, int RS, int MB, int ME, int RA, int Rc
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_sraw(int RS, int RB, int RA, int Rc)
 {
 	// Inputs 'RS,RB', implicit inputs ''
@@ -154,6 +159,7 @@ RET_TYPE PPCInterpreter::op_sraw(int RS, int RB, int RA, int Rc)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_srawi(int RS, int SH, int RA, int Rc)
 {
 	// Inputs 'RS,SH', implicit inputs ''
@@ -178,3 +184,5 @@ RET_TYPE PPCInterpreter::op_srawi(int RS, int SH, int RA, int Rc)
 	INTERP_RETURN;
 }
 
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(Logical)
@@ -27,6 +27,454 @@
 
 /********************* Memory *********************/
 
+/* Multiple/string ops are translated once per page touched, rather than per
+ * word.  Returns a host pointer for len bytes from addr (which mustn't cross a
+ * page), or 0 if it's not RAM (use normal accesses) or faults (in which case
+ * mem_access_fault is set).  Faults come out for the same accesses as when
+ * going a word at a time:  the first access in the faulting page.
+ */
+u8	*PPCInterpreter::bulk_translate(ADR addr, bool RnW, unsigned int len)
+{
+	mem_sidefx++;
+	mem_access_fault = PPCMMU::FAULT_NONE;
+#if FLAT_MEM == 0 && DUMMY_MEM_ACCESS == 0
+	u64 pa = 0;
+	PPCMMU::fault_t fault;
+
+	if (!mmu->translateAddr(addr, &pa, false, RnW, cpus->isPrivileged(), &fault, len)) {
+		mem_access_fault = fault;
+		mem_access_addr = addr;
+		return 0;
+	}
+	if (!(pa & PPCMMU_HVA_IO_BIT))
+		return (u8 *)pa;
+#endif
+	return 0;
+}
+
+/* Load nb bytes into registers from reg upwards (wrapping r31 to r0), a byte
+ * at a time into the MSBs first, zero-filling the last register.
+ */
+bool	PPCInterpreter::string_load(ADR addr, unsigned int nb, int reg)
+{
+	u32 v = 0;
+	unsigned int i = 0;
+
+	while (i < nb) {
+		ADR a = addr + i;
+		unsigned int len = MIN(nb - i, PPCMMU_PAGE_SIZE - (a & PPCMMU_PAGE_OFFS));
+		u8 *h = bulk_translate(a, true, len);
+
+		if (mem_access_fault != PPCMMU::FAULT_NONE)
+			return false;
+		for (unsigned int j = 0; j < len; j++, i++) {
+			if (h) {
+				v = (v << 8) | ram_read8(h + j);
+			} else {
+				v = (v << 8) | LOAD8(a + j);
+				if (mem_access_fault != PPCMMU::FAULT_NONE)
+					return false;
+			}
+			if ((i & 3) == 3) {
+				DISASS("\tr%d = LD[%08x] = %08x\n", reg, addr + i - 3, v);
+				WRITE_GPR(reg, v);
+				reg = (reg + 1) & 0x1f;
+				v = 0;
+			}
+		}
+	}
+	if (nb & 3) {
+		v <<= 8 * (4 - (nb & 3));
+		DISASS("\tr%d = LD[%08x] = %08x (%d bytes)\n", reg, addr + (nb & ~3), v, nb & 3);
+		WRITE_GPR(reg, v);
+	}
+	return true;
+}
+
+/* Store nb bytes from registers from reg upwards, MSB first: */
+bool	PPCInterpreter::string_store(ADR addr, unsigned int nb, int reg)
+{
+	unsigned int i = 0;
+
+	while (i < nb) {
+		ADR a = addr + i;
+		unsigned int len = MIN(nb - i, PPCMMU_PAGE_SIZE - (a & PPCMMU_PAGE_OFFS));
+		u8 *h = bulk_translate(a, false, len);
+
+		if (mem_access_fault != PPCMMU::FAULT_NONE)
+			return false;
+		for (unsigned int j = 0; j < len; j++, i++) {
+			u8 b = READ_GPR((reg + i/4) & 0x1f) >> (24 - 8*(i & 3));
+			if (h) {
+				ram_write8(h + j, b);
+			} else {
+				STORE8(a + j, b);
+				if (mem_access_fault != PPCMMU::FAULT_NONE)
+					return false;
+			}
+		}
+	}
+	return true;
+}
+
+#if ENABLE_BULK_LOOPS
+/* A taken bdnz (at from) back to head.  If it's the same loop going round
+ * again, and has done so a few times, see whether it can be done in bulk.
+ */
+void	PPCInterpreter::bulk_loop_check(VA from, VA head)
+{
+	REG ctr = cpus->getCTR();
+
+	if (bulk_pc != from || ctr + 1 != bulk_ctr) {
+		bulk_pc = from;
+		bulk_iters = 0;
+	}
+	bulk_ctr = ctr;
+	/* A loop that isn't suitable is only looked at once: */
+	if (++bulk_iters != BULK_LOOP_ITERS)
+		return;
+	if (bulk_loop(from, head)) {
+		bulk_ctr = cpus->getCTR();
+		bulk_iters = 0;
+	}
+}
+
+/* Roles of registers in a bulk loop body: */
+#define BR_PTR		1	/* Stepped by addi or an update form */
+#define BR_LBASE	2	/* Base of loads */
+#define BR_SBASE	4	/* Base of stores/dcbz */
+#define BR_DATA		8	/* Loaded into */
+#define BR_VAL		16	/* Stored, or dcbz index:  must be invariant */
+
+/* Where each byte stored by one iteration comes from: */
+enum { BB_NONE = 0, BB_ZERO, BB_CONST, BB_SRC };
+
+/* The PC is at head, having taken the bdnz at from.  The loop body is
+ * interpreted once, symbolically, from the current registers:  it must be
+ * just loads and stores (of any size, including update forms), addi to
+ * step pointers, dcbz and dcbt/dcbtst, loading through at most one pointer
+ * and storing through another, each stepped by the same stride.  If
+ * each iteration stores exactly one stride's worth of bytes, either all the
+ * same (zero or a constant) or a straight copy of what was loaded, the
+ * remaining iterations are done as memset()/memcpy().
+ *
+ * This is only done while both ranges are RAM that's accessible without a
+ * fault, the ranges don't overlap, and all accesses are aligned; iterations
+ * stop short of the run horizon, so events happen at the same point as if
+ * the loop were run normally.  Otherwise, it's left to run normally (and,
+ * e.g., fault normally).  Registers, CTR, PC and the instruction count end up
+ * as if the iterations done had run.  Returns true if any were done.
+ */
+bool	PPCInterpreter::bulk_loop(VA from, VA head)
+{
+	unsigned int	len = (from - head) / 4;
+	REG		n = cpus->getCTR();
+	bool		priv = cpus->isPrivileged();
+
+	s32		delta[32];
+	u8		role[32];
+	s32		load_off[32];
+	u8		load_size[32];
+	bool		loaded[32];
+	int		lbase = -1, sbase = -1;
+	s32		lmin = INT32_MAX, lmax = INT32_MIN;
+	unsigned int	amax = 1;
+
+	struct {
+		u8	kind;
+		u8	size;
+		u8	ra, rb;		/* dcbz */
+		s32	off;		/* From the store base (dcbz: see below) */
+		u32	val;		/* BB_CONST */
+		s32	src;		/* BB_SRC, from the load base */
+	} w[BULK_LOOP_MAX_BYTES / 4];
+	unsigned int	nw = 0;
+
+	if (n < BULK_LOOP_MIN_ITERS)
+		return false;
+
+	memset(delta, 0, sizeof(delta));
+	memset(role, 0, sizeof(role));
+	memset(loaded, 0, sizeof(loaded));
+
+	for (unsigned int i = 0; i < len; i++) {
+		u32 in;
+		if (mmu->loadInst32(head + i*4, &in, priv) != PPCMMU::FAULT_NONE)
+			return false;
+
+		unsigned int op = getOpcode(in);
+		unsigned int rt = D_RT(in);
+		unsigned int ra = D_RA(in);
+		s32 d = D_D(in);
+		unsigned int size;
+		bool update;
+
+		switch (op) {
+			case 14:	/* addi rX, rX, SI */
+				if (ra == 0 || rt != ra)
+					return false;
+				role[ra] |= BR_PTR;
+				delta[ra] += d;
+				break;
+
+			case 32: case 33:	/* lwz[u] */
+			case 34: case 35:	/* lbz[u] */
+			case 40: case 41:	/* lhz[u] */
+				size = op < 34 ? 4 : op < 40 ? 1 : 2;
+				update = op & 1;
+				if (ra == 0 || rt == ra || (lbase >= 0 && (unsigned int)lbase != ra))
+					return false;
+				lbase = ra;
+				role[ra] |= BR_LBASE;
+				role[rt] |= BR_DATA;
+				if ((cpus->getGPR(ra) + delta[ra] + d) & (size - 1))
+					return false;
+				load_off[rt] = delta[ra] + d;
+				load_size[rt] = size;
+				loaded[rt] = true;
+				lmin = MIN(lmin, load_off[rt]);
+				lmax = MAX(lmax, load_off[rt] + (s32)size);
+				amax = MAX(amax, size);
+				if (update) {
+					role[ra] |= BR_PTR;
+					delta[ra] += d;
+				}
+				break;
+
+			case 36: case 37:	/* stw[u] */
+			case 38: case 39:	/* stb[u] */
+			case 44: case 45:	/* sth[u] */
+				size = op < 38 ? 4 : op < 44 ? 1 : 2;
+				update = op & 1;
+				if (ra == 0 || (sbase >= 0 && (unsigned int)sbase != ra) ||
+				    nw == BULK_LOOP_MAX_BYTES / 4)
+					return false;
+				sbase = ra;
+				role[ra] |= BR_SBASE;
+				if ((cpus->getGPR(ra) + delta[ra] + d) & (size - 1))
+					return false;
+				w[nw].size = size;
+				w[nw].off = delta[ra] + d;
+				if (role[rt] & BR_DATA) {
+					/* The low bytes of what was loaded: */
+					if (!loaded[rt] || load_size[rt] < size)
+						return false;
+					w[nw].kind = BB_SRC;
+					w[nw].src = load_off[rt] + load_size[rt] - size;
+				} else {
+					role[rt] |= BR_VAL;
+					w[nw].kind = BB_CONST;
+					w[nw].val = cpus->getGPR(rt);
+				}
+				nw++;
+				amax = MAX(amax, size);
+				if (update) {
+					role[ra] |= BR_PTR;
+					delta[ra] += d;
+				}
+				break;
+
+			case 31:
+				switch (X_XOPC(in)) {
+					case 1014:	/* dcbz */
+						/* Resolved below, once it's known which is the pointer: */
+						if (nw == BULK_LOOP_MAX_BYTES / 4)
+							return false;
+						w[nw].kind = BB_ZERO;
+						w[nw].size = 32;
+						w[nw].ra = X_RA0(in);
+						w[nw].rb = X_RB(in);
+						w[nw].off = delta[w[nw].ra] + delta[w[nw].rb];
+						nw++;
+						break;
+					case 278:	/* dcbt */
+					case 246:	/* dcbtst */
+						break;
+					default:
+						return false;
+				}
+				break;
+
+			default:
+				return false;
+		}
+	}
+
+	/* The dcbz pointer is whichever of RA/RB is stepped; the other is
+	 * an invariant index (or RA is 0):
+	 */
+	for (unsigned int i = 0; i < nw; i++) {
+		if (w[i].kind != BB_ZERO)
+			continue;
+
+		unsigned int p, x;
+		if (role[w[i].rb] & BR_PTR) {
+			p = w[i].rb;
+			x = w[i].ra;
+		} else {
+			p = w[i].ra;
+			x = w[i].rb;
+		}
+		if (p == 0 || (sbase >= 0 && (unsigned int)sbase != p) || (x && (role[x] & BR_PTR)))
+			return false;
+		sbase = p;
+		role[p] |= BR_SBASE;
+		if (x)
+			role[x] |= BR_VAL;
+
+		/* The block is relative to the pointer at the start of the iteration: */
+		VA ea = cpus->getGPR(p) + w[i].off + (x ? cpus->getGPR(x) : 0);
+		w[i].off = (s32)((ea & ~31) - cpus->getGPR(p));
+		amax = MAX(amax, 32);
+	}
+
+	if (sbase < 0 || lbase == sbase)
+		return false;
+	for (int r = 0; r < 32; r++) {
+		if ((role[r] & BR_PTR) && (role[r] & (BR_DATA | BR_VAL)))
+			return false;
+		if ((role[r] & BR_DATA) && (role[r] & ~BR_DATA))
+			return false;
+		if ((role[r] & BR_VAL) && (role[r] & ~BR_VAL))
+			return false;
+	}
+
+	s32 stride = delta[sbase];
+	if (stride <= 0 || stride > BULK_LOOP_MAX_STRIDE || (stride % amax) ||
+	    (lbase >= 0 && delta[lbase] != stride))
+		return false;
+
+	/* What one iteration stores, from the lowest address stored: */
+	u8	bkind[BULK_LOOP_MAX_STRIDE];
+	u8	bval[BULK_LOOP_MAX_STRIDE];
+	s32	bsrc[BULK_LOOP_MAX_STRIDE];
+	s32	wmin = INT32_MAX, wmax = INT32_MIN;
+
+	for (unsigned int i = 0; i < nw; i++) {
+		wmin = MIN(wmin, w[i].off);
+		wmax = MAX(wmax, w[i].off + (s32)w[i].size);
+	}
+	if (wmax - wmin != stride)
+		return false;
+	memset(bkind, BB_NONE, sizeof(bkind));
+	for (unsigned int i = 0; i < nw; i++) {
+		for (unsigned int j = 0; j < w[i].size; j++) {
+			unsigned int b = w[i].off - wmin + j;
+			bkind[b] = w[i].kind;
+			if (w[i].kind == BB_ZERO)
+				bval[b] = 0;
+			else if (w[i].kind == BB_CONST)
+				bval[b] = w[i].val >> (8 * (w[i].size - 1 - j));
+			else
+				bsrc[b] = w[i].src + j;
+		}
+	}
+
+	/* Either all one byte value, or a straight copy: */
+	bool	set = bkind[0] != BB_SRC;
+	u8	set_val = set ? bval[0] : 0;
+	s32	src_off = set ? 0 : bsrc[0] - wmin;
+
+	for (s32 b = 0; b < stride; b++) {
+		if (bkind[b] == BB_NONE)
+			return false;
+		if (set && (bkind[b] == BB_SRC || bval[b] != set_val))
+			return false;
+		if (!set && (bkind[b] != BB_SRC || bsrc[b] - b - wmin != src_off))
+			return false;
+	}
+
+	/* How many iterations can be done before the horizon (this bdnz
+	 * hasn't ticked yet):
+	 */
+	u64 ticks = cpus->ticksToHorizon();
+	u64 k = ticks ? (ticks - 1) / (len + 1) : 0;
+	k = MIN(k, (u64)n);
+	if (k < BULK_LOOP_MIN_ITERS)
+		return false;
+
+	/* The (whole) ranges written and read mustn't overlap or wrap: */
+	u64 dst = (u64)cpus->getGPR(sbase) + wmin;
+	u64 dst_end = dst + k * stride;
+	u64 lsrc = 0;
+	s32 lspan = 0;
+	if (lbase >= 0) {
+		lsrc = (u64)cpus->getGPR(lbase) + lmin;
+		lspan = lmax - lmin;
+		u64 lsrc_end = lsrc + (k - 1) * stride + lspan;
+		if (lsrc_end > 0x100000000ULL || (lsrc < dst_end && dst < lsrc_end))
+			return false;
+	}
+	if (dst_end > 0x100000000ULL)
+		return false;
+
+	/* A page (of each) at a time: */
+	u64	done = 0;
+	u8	*last_hl = 0;
+	u64	last_m = 0;
+
+	while (done < k) {
+		VA d = dst + done * stride;
+		u8 *hl = 0;
+		u64 m = MIN(k - done, (PPCMMU_PAGE_SIZE - (d & PPCMMU_PAGE_OFFS)) / stride);
+		if (lbase >= 0) {
+			VA l = lsrc + done * stride;
+			u32 room = PPCMMU_PAGE_SIZE - (l & PPCMMU_PAGE_OFFS);
+			m = (u32)lspan > room ? 0 : MIN(m, (room - lspan) / stride + 1);
+		}
+		if (m == 0)
+			break;
+
+		if (lbase >= 0) {
+			hl = bulk_translate(lsrc + done * stride, true, (m - 1) * stride + lspan);
+			if (!hl)
+				break;
+		}
+		u8 *hd = bulk_translate(d, false, m * stride);
+		if (!hd)
+			break;
+
+		if (set)
+			ram_memset(hd, set_val, m * stride);
+		else
+			ram_memcpy(hd, hl + wmin + src_off - lmin, m * stride);
+		done += m;
+		last_hl = hl;
+		last_m = m;
+	}
+	/* Not RAM, or a fault:  the rest's left to run normally. */
+	mem_access_fault = PPCMMU::FAULT_NONE;
+	if (done == 0)
+		return false;
+
+	/* Loaded registers hold what the last iteration loaded, which was
+	 * from the last chunk:
+	 */
+	for (int r = 0; r < 32; r++) {
+		if (role[r] & BR_DATA) {
+			const u8 *h = last_hl + (last_m - 1) * stride + load_off[r] - lmin;
+			if (load_size[r] == 4)
+				WRITE_GPR(r, ram_read32(h));
+			else if (load_size[r] == 2)
+				WRITE_GPR(r, ram_read16(h));
+			else
+				WRITE_GPR(r, ram_read8(h));
+		}
+	}
+	for (int r = 0; r < 32; r++) {
+		if (role[r] & BR_PTR)
+			WRITE_GPR(r, cpus->getGPR(r) + done * delta[r]);
+	}
+	cpus->setCTR(n - done);
+	if (done == n)
+		cpus->setPC(from + 4);
+	cpus->CPUTick(done * (len + 1));
+	COUNT(CTR_BULK_LOOP);
+	return true;
+}
+#endif
+
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_lmw(int RT, int16_t D, int RA0)
 {
 	REG val_RA0 = READ_GPR_OZ(RA0);
@@ -34,12 +482,31 @@ RET_TYPE PPCInterpreter::op_lmw(int RT, int16_t D, int RA0)
 	DISASS("%08x   %08x  lmw\t %d, %d(%d) \n", pc, inst, /* in */ RT, /* in */ D, /* in */ RA0);
 
 	ADR base = val_RA0 + D;
+	unsigned int n = RT;
 
-	for (int n = RT; n < 32; n++) {
-		u32 v = LOAD32(base);
-		MFCHECK(1);
-		WRITE_GPR(n, v);
-		base += 4;
+	/* Unaligned ones are rare, and fiddly at page boundaries, so go a
+	 * word at a time; otherwise, a page at a time:
+	 */
+	while (n < 32) {
+		unsigned int nw = 1;
+		u8 *h = 0;
+
+		if (!(base & 3)) {
+			nw = MIN(32 - n, (PPCMMU_PAGE_SIZE - (base & PPCMMU_PAGE_OFFS)) / 4);
+			h = bulk_translate(base, true, nw * 4);
+			MFCHECK(1);
+		}
+		if (h) {
+			cpus->setGPRsRAM(n, nw, h);
+		} else {
+			for (unsigned int i = 0; i < nw; i++) {
+				u32 v = LOAD32(base + i*4);
+				MFCHECK(1);
+				WRITE_GPR(n + i, v);
+			}
+		}
+		n += nw;
+		base += nw * 4;
 	}
 
 	incPC();
@@ -47,6 +514,7 @@ RET_TYPE PPCInterpreter::op_lmw(int RT, int16_t D, int RA0)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_lwarx(int RA0, int RB, int EH, int RT)
 {
 	// Inputs 'RA0,RB,EH', implicit inputs ''
@@ -71,6 +539,7 @@ RET_TYPE PPCInterpreter::op_lwarx(int RA0, int RB, int EH, int RT)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_stmw(int RS, int16_t D, int RA0)
 {
 	REG val_RA0 = READ_GPR_OZ(RA0);
@@ -78,11 +547,28 @@ RET_TYPE PPCInterpreter::op_stmw(int RS, int16_t D, int RA0)
 	DISASS("%08x   %08x  stmw\t %d, %d(%d) \n", pc, inst, /* in */ RS, /* in */ D, /* in */ RA0);
 
 	ADR base = val_RA0 + D;
+	unsigned int n = RS;
 
-	for (int n = RS; n < 32; n++) {
-		STORE32(base, READ_GPR(n));
-		MFCHECK(0);
-		base += 4;
+	/* As lmw: */
+	while (n < 32) {
+		unsigned int nw = 1;
+		u8 *h = 0;
+
+		if (!(base & 3)) {
+			nw = MIN(32 - n, (PPCMMU_PAGE_SIZE - (base & PPCMMU_PAGE_OFFS)) / 4);
+			h = bulk_translate(base, false, nw * 4);
+			MFCHECK(0);
+		}
+		if (h) {
+			cpus->getGPRsRAM(n, nw, h);
+		} else {
+			for (unsigned int i = 0; i < nw; i++) {
+				STORE32(base + i*4, READ_GPR(n + i));
+				MFCHECK(0);
+			}
+		}
+		n += nw;
+		base += nw * 4;
 	}
 
 	incPC();
@@ -90,6 +576,7 @@ RET_TYPE PPCInterpreter::op_stmw(int RS, int16_t D, int RA0)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_stwcx(int RS, int RA0, int RB)
 {
 	REG val_RA0 = READ_GPR_OZ(RA0);
@@ -145,6 +632,7 @@ RET_TYPE PPCInterpreter::op_stwcx(int RS, int RA0, int RB)
  *
  * Might do these in PALcode...
  */
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_lswi(int RT, int RA0, int NB)
 {
         REG val_RA0 = READ_GPR_OZ(RA0);
@@ -164,38 +652,21 @@ RET_TYPE PPCInterpreter::op_lswi(int RT, int RA0, int NB)
 	if (NB & 3)
 		COUNT(CTR_INST_STRING_LD_ODD);
 
-	int reg = RT;
-
 	if (RT == RA0) {
 		/* FIXME: Invalid instruction. Also need to check if RA is in
 		 * range of instrs to be loaded.
 		 */
 	}
 
-	for (int n = 0; n < NB; n += 4) {
-		u32 v = LOAD32(base + n);
+	if (!string_load(base, NB, RT))
 		MFCHECK(1);
-		/* If last word loaded, if there weren't a /4 number of bytes
-		 * then we loaded an odd numner and LSBs need masking:
-		 */
-		if ((NB - n) < 4) {
-			u32 mask = (0xffffffff >> (8*(NB-n)));
-			v = v & mask;
-			DISASS("\tr%d = LD[%08x] = %08x (mask %08x)\n",
-			       reg, base + n, v, mask);
-		} else {
-			DISASS("\tr%d = LD[%08x] = %08x\n",
-			       reg, base + n, v);
-		}
-		WRITE_GPR(reg, v);
-		reg = (reg + 1) & 0x1f;
-	}
 
         incPC();
         COUNT(CTR_INST_LSWI);
         INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_lswx(int RT, int RA0, int RB)
 {
         REG val_RA0 = READ_GPR_OZ(RA0);
@@ -224,32 +695,15 @@ RET_TYPE PPCInterpreter::op_lswx(int RT, int RA0, int RB)
 	if (numbytes & 3)
 		COUNT(CTR_INST_STRING_LD_ODD);
 
-	int reg = RT;
-
-	for (int n = 0; n < numbytes; n += 4) {
-		u32 v = LOAD32(base + n);
+	if (!string_load(base, numbytes, RT))
 		MFCHECK(1);
-		/* If last word loaded, if there weren't a /4 number of bytes
-		 * then we loaded an odd numner and LSBs need masking:
-		 */
-		if ((numbytes - n) < 4) {
-			u32 mask = (0xffffffff >> (8*(numbytes-n)));
-			v = v & mask;
-			DISASS("\tr%d = LD[%08x] = %08x (mask %08x)\n",
-			       reg, base + n, v, mask);
-		} else {
-			DISASS("\tr%d = LD[%08x] = %08x\n",
-			       reg, base + n, v);
-		}
-		WRITE_GPR(reg, v);
-		reg = (reg + 1) & 0x1f;
-	}
 
         incPC();
         COUNT(CTR_INST_LSWX);
         INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_stswi(int RS, int RA0, int NB)
 {
         REG val_RA0 = READ_GPR_OZ(RA0);
@@ -266,35 +720,15 @@ RET_TYPE PPCInterpreter::op_stswi(int RS, int RA0, int NB)
 	if (NB & 3)
 		COUNT(CTR_INST_STRING_ST_ODD);
 
-	int reg = RS;
-
-	for (int n = 0; n < NB; n += 4) {
-		REG v = READ_GPR(reg);
-
-		/* If < one word to store, store individual bytes */
-		if ((NB - n) < 4) {
-			for (int i = 0; i < (NB - n); i++) {
-				u8 b = (v >> (24 - (i*8))) & 0xff;
-				DISASS("\tST[%08x] = r%d(%d) = %02x\n",
-				       base + n + i, reg, 3-i, b);
-				STORE32(base + n + i, v);
-				MFCHECK(0);
-			}
-		} else {
-			DISASS("\tST[%08x] = r%d = %08x\n",
-			       base + n, reg, v);
-			STORE32(base + n, v);
-			MFCHECK(0);
-		}
-		WRITE_GPR(reg, v);
-		reg = (reg + 1) & 0x1f;
-	}
+	if (!string_store(base, NB, RS))
+		MFCHECK(0);
 
         incPC();
         COUNT(CTR_INST_STSWI);
         INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_stswx(int RS, int RA0, int RB)
 {
         REG val_RA0 = READ_GPR_OZ(RA0);
@@ -311,31 +745,13 @@ RET_TYPE PPCInterpreter::op_stswx(int RS, int RA0, int RB)
 	if (numbytes & 3)
 		COUNT(CTR_INST_STRING_ST_ODD);
 
-	int reg = RS;
-
-	for (int n = 0; n < numbytes; n += 4) {
-		REG v = READ_GPR(reg);
-
-		/* If < one word to store, store individual bytes */
-		if ((numbytes - n) < 4) {
-			for (int i = 0; i < (numbytes - n); i++) {
-				u8 b = (v >> (24 - (i*8))) & 0xff;
-				DISASS("\tST[%08x] = r%d(%d) = %02x\n",
-				       base + n + i, reg, 3-i, b);
-				STORE32(base + n + i, v);
-				MFCHECK(0);
-			}
-		} else {
-			DISASS("\tST[%08x] = r%d = %08x\n",
-			       base + n, reg, v);
-			STORE32(base + n, v);
-			MFCHECK(0);
-		}
-		WRITE_GPR(reg, v);
-		reg = (reg + 1) & 0x1f;
-	}
+	if (!string_store(base, numbytes, RS))
+		MFCHECK(0);
 
         incPC();
         COUNT(CTR_INST_STSWX);
         INTERP_RETURN;
 }
+
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(Memory)
@@ -28,6 +28,7 @@
 
 /********************* Special *********************/
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_eieio()
 {
 	DISASS("%08x   %08x  eieio\t  \n", pc, inst);
@@ -39,6 +40,7 @@ RET_TYPE PPCInterpreter::op_eieio()
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_isync()
 {
 	DISASS("%08x   %08x  isync\t  \n", pc, inst);
@@ -54,6 +56,7 @@ RET_TYPE PPCInterpreter::op_isync()
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mfspr(int spr, int RT)
 {
 	// Inputs 'spr', implicit inputs ''
@@ -203,6 +206,7 @@ void PPCInterpreter::helper_DEBUG(REG val)
         }
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mftb(int spr, int RT)
 {
 	REG val_RT = 0;
@@ -230,6 +234,7 @@ RET_TYPE PPCInterpreter::op_mftb(int spr, int RT)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mtspr(int spr, int RS)
 {
 	// Inputs 'spr,RS', implicit inputs ''
@@ -514,10 +519,8 @@ RET_TYPE PPCInterpreter::op_mtspr(int spr, int RS)
 	case SPR_IC_INV_SET:
 		DISASS("%08x   %08x  mtspr\t DC_INV_SET, r%d\t[%08x]\n", pc, inst, RS, val_RS);
 		CHECK_YOUR_PRIVILEGE();
-		/* Interpreter can ignore this, but JIT needs to heed this! */
-#if ENABLE_JIT != 0
-		FATAL("Need to implement I$ invalidate for JIT\n");
-#endif
+		/* Code caches see stores, but not DMA, so drop everything: */
+		mmu->invalidateAllCode();
 		break;
 
 	default:
@@ -530,6 +533,7 @@ RET_TYPE PPCInterpreter::op_mtspr(int spr, int RS)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_rfi()
 {
 	VA	new_pc = cpus->getSRR0() & ~3;
@@ -550,6 +554,7 @@ RET_TYPE PPCInterpreter::op_rfi()
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_sync(int L, int E)
 {
 	/* Barrier:  For the purposes of this ISS, this does nothing. */
@@ -571,6 +576,7 @@ RET_TYPE PPCInterpreter::op_sync(int L, int E)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mfsr(int SR, int RT)
 {
 	// Inputs 'SR', implicit inputs ''
@@ -590,6 +596,7 @@ RET_TYPE PPCInterpreter::op_mfsr(int SR, int RT)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mfsrin(int RB, int RT)
 {
 	// Inputs 'RB', implicit inputs ''
@@ -610,6 +617,7 @@ RET_TYPE PPCInterpreter::op_mfsrin(int RB, int RT)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mtsr(int SR, int RS)
 {
 	// Inputs 'SR,RS', implicit inputs ''
@@ -626,6 +634,7 @@ RET_TYPE PPCInterpreter::op_mtsr(int SR, int RS)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_mtsrin(int RS, int RB)
 {
 	// Inputs 'RS,RB', implicit inputs ''
@@ -643,6 +652,7 @@ RET_TYPE PPCInterpreter::op_mtsrin(int RS, int RB)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_tlbie(int RB, int L)
 {
 	DISASS("%08x   %08x  tlbie	r%d, %d\n", pc, inst, RB, L);
@@ -655,6 +665,7 @@ RET_TYPE PPCInterpreter::op_tlbie(int RB, int L)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_tlbiel(int RB, int L)
 {
 	DISASS("%08x   %08x  tlbiel	r%d, %d\n", pc, inst, RB, L);
@@ -672,6 +683,7 @@ RET_TYPE PPCInterpreter::op_tlbiel(int RB, int L)
  * r0 = 0;  exit
  * r0 = 1;  putch(r3)
  */
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_DEBUG(int RA)
 {
 	// Inputs 'RA', implicit inputs r0, r3, etc.
@@ -703,6 +715,8 @@ RET_TYPE PPCInterpreter::op_DEBUG(int RA)
 			printf("Tracing on\n");
 			CFG(dump_state_period) = 1;
 			log_enables_mask |= LOG_FLAG_DISASS;
+			/* Switch to the tracing variant: */
+			cpus->cutRun();
 			break;
 
 		default:
@@ -714,6 +728,7 @@ RET_TYPE PPCInterpreter::op_DEBUG(int RA)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_icbi(int RA0, int RB)
 {
 	REG val_RA0 = READ_GPR_OZ(RA0);
@@ -721,23 +736,25 @@ RET_TYPE PPCInterpreter::op_icbi(int RA0, int RB)
 
 	DISASS("%08x   %08x  icbi\t r%d, r%d\n", pc, inst, /* in */ RA0, /* in */ RB);
 
-	/* FIXME: Inform blockstore and get it to clear itself, translating VA
-	 * to PA first.
-	 *
-	 * This will probably need to stash that and then action that after the
-	 * block completes.  (Don't want to reset blockstore whilst executing
-	 * out of it!)
+	/* Whichever code cache is in use (predecoded instructions, or JIT
+	 * blocks) drops what it has from the line.  Stores to cached code are
+	 * already seen, so this only matters for code written by DMA.
 	 */
-	u64 pa;
+	u64 pa = 0;
 	VA va = val_RA0+val_RB;
 	PPCMMU::fault_t fault;
 	if (!mmu->translateAddr(va, &pa, false, true, cpus->isPrivileged(), &fault)) {
                 cpus->raiseMemException(true, false, va, fault, 0);
 		INTERP_RETURN;
 	}
-	/* FIXME: blockstore_invalidate_range(pa, pa+32); */
+	if (!(pa & PPCMMU_HVA_IO_BIT))
+		mmu->invalidateCode(pa & ~31ULL, 32);
 
 	incPC();
 	COUNT(CTR_INST_ICBI);
 	INTERP_RETURN;
 }
+
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(Special)
+INSTANTIATE_OPS(Cache)
@@ -26,6 +26,7 @@
 
 /********************* Trap *********************/
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_sc(uint8_t LEV)
 {
 	DISASS("%08x   %08x  sc\t %d \n", pc, inst, /* in */ LEV);
@@ -52,6 +53,7 @@ static bool does_trap(int TO, s32 a, s32 b)
 		((TO & 0x01) && ((u32)a > (u32)b));
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_tw(int TO, int RA, int RB)
 {
 	// Inputs 'TO,RA,RB', implicit inputs ''
@@ -75,6 +77,7 @@ RET_TYPE PPCInterpreter::op_tw(int TO, int RA, int RB)
 	INTERP_RETURN;
 }
 
+template <bool trace_variant>
 RET_TYPE PPCInterpreter::op_twi(int TO, int RA, int16_t SI)
 {
 	// Inputs 'TO,RA,SI', implicit inputs ''
@@ -97,3 +100,5 @@ RET_TYPE PPCInterpreter::op_twi(int TO, int RA, int16_t SI)
 	INTERP_RETURN;
 }
 
+/* Tracing and non-tracing variants of the above: */
+INSTANTIATE_OPS(Trap)
@@ -0,0 +1,2445 @@
+#include "PPCInterpreter.h"
+
+/*****************************************************************************/
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_add(int RA, int RB, int RT, int Rc, int OE)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  add%s%s\t %d,  %d, %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* . means write cr0; o means write XER.OV. This is on top of outimpl. */
+
+	ADD_OV(val_RT, val_OV, val_RA, val_RB);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_ADD);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_addc(int RA, int RB, int RT, int Rc, int OE)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+	int val_CA;
+	int val_OV;
+
+	DISASS("%08x   %08x  addc%s%s\t %d,  %d, %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* And these implicitly always write XER.CA, conditionally write XER.SO, CR0 */
+
+	ADD_OV_CO(val_RT, val_OV, val_CA, val_RA, val_RB);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_ADDC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_adde(int RA, int RB, int RT, int Rc, int OE)
+{
+	// Inputs 'RA,RB', implicit inputs 'CA'
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	int val_CA = READ_CA();
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  adde%s%s\t %d,  %d, %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	ADD_OV_CO_CI(val_RT, val_OV, val_CA, val_RA, val_RB, val_CA);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_ADDE);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_addi(int RA0, s16 SI, int RT)
+{
+	// Inputs 'RA0,SI', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RT;
+
+	DISASS("%08x   %08x  addi\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ SI);
+
+	val_RT = val_RA0 + SI;
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_ADDI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_li(s16 SI, int RT)
+{
+	// Inputs 'SI', implicit inputs ''
+	REG val_RT;
+
+	DISASS("%08x   %08x  li\t %d,  %d \n", pc, inst, /* out */ RT, /* in */ SI);
+
+	val_RT = SI;
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_addis(int RA0, s16 SI, int RT)
+{
+	// Inputs 'RA0,SI', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RT;
+
+	DISASS("%08x   %08x  addis\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ SI);
+
+	val_RT = val_RA0 + ((REG)SI<<16);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_ADDIS);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lis(s16 SI, int RT)
+{
+	// Inputs 'SI', implicit inputs ''
+	REG val_RT;
+
+	DISASS("%08x   %08x  lis\t %d,  %d \n", pc, inst, /* out */ RT, /* in */ SI);
+
+	val_RT = (REG)SI << 16;
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LIS);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_addic(int RA, s16 SI, int RT)
+{
+	// Inputs 'RA,SI', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+	int val_CA;
+
+	DISASS("%08x   %08x  addic\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ SI);
+
+	ADD_CO(val_RT, val_CA, val_RA, SI);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	incPC();
+	COUNT(CTR_INST_ADDIC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_addic_rc(int RA, s16 SI, int RT)
+{
+	// Inputs 'RA,SI', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+	int val_CA;
+
+	DISASS("%08x   %08x  addic_rc.\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ SI);
+
+	ADD_CO(val_RT, val_CA, val_RA, SI);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	SET_CR0(val_RT); // Copies XER.SO
+	incPC();
+	COUNT(CTR_INST_ADDIC_RC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_addme(int RA, int RT, int Rc, int OE)
+{
+	// Inputs 'RA', implicit inputs 'CA'
+	REG val_RA = READ_GPR(RA);
+	int val_CA = READ_CA();
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  addme%s%s\t %d,  %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA);
+
+	ADD_OV_CO_CI(val_RT, val_OV, val_CA, val_RA, -1, val_CA);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_ADDME);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_addze(int RA, int RT, int Rc, int OE)
+{
+	// Inputs 'RA', implicit inputs 'CA'
+	REG val_RA = READ_GPR(RA);
+	int val_CA = READ_CA();
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  addze%s%s\t %d,  %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA);
+
+	ADD_OV_CO(val_RT, val_OV, val_CA, val_RA, val_CA);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_ADDZE);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mulhw(int RA, int RB, int RT, int Rc)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  mulhw%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* High 32. NOTE: XO w/o OE! Hack, said it’s X. */
+
+	val_RT = ((s64)(s32)val_RA * (s64)(s32)val_RB)>>32;
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_MULHW);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mulhwu(int RA, int RB, int RT, int Rc)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  mulhwu%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* High 32 unsigned. NOTE: XO, no OE, said X. */
+
+	val_RT = ((u64)val_RA * (u64)val_RB)>>32;
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_MULHWU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mulli(int RA, s16 SI, int RT)
+{
+	// Inputs 'RA,SI', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+
+	DISASS("%08x   %08x  mulli\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ SI);
+
+	/* ?? 64-bit instruction set? */
+
+	val_RT = val_RA * SI;
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_MULLI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mullw(int RA, int RB, int RT, int Rc, int OE)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  mullw%s%s\t %d,  %d, %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* Lower 32 */
+
+	u64 x = (s64)(s32)val_RA * (s64)(s32)val_RB;
+	val_RT = x;
+	val_OV = ((x >> 32) != 0 && (x >> 31) != 0x1ffffffff) || (((SIGN(val_RA) ^ SIGN(val_RB)) != SIGN(x)) && x);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_MULLW);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_subf(int RA, int RB, int RT, int Rc, int OE)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  subf%s%s\t %d,  %d, %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	ADD_OV_CI(val_RT, val_OV, ~val_RA, val_RB, 1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_SUBF);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_subfc(int RA, int RB, int RT, int Rc, int OE)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+	int val_CA;
+	int val_OV;
+
+	DISASS("%08x   %08x  subfc%s%s\t %d,  %d, %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	ADD_OV_CO_CI(val_RT, val_OV, val_CA, ~val_RA, val_RB, 1);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_SUBFC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_subfe(int RA, int RB, int RT, int Rc, int OE)
+{
+	// Inputs 'RA,RB', implicit inputs 'CA'
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	int val_CA = READ_CA();
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  subfe%s%s\t %d,  %d, %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA, /* in */ RB);
+
+	ADD_OV_CO_CI(val_RT, val_OV, val_CA, ~val_RA, val_RB, val_CA);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_SUBFE);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_subfic(int RA, s16 SI, int RT)
+{
+	// Inputs 'RA,SI', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+	int val_CA;
+
+	DISASS("%08x   %08x  subfic\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ SI);
+
+	ADD_CO_CI(val_RT, val_CA, ~val_RA, SI, 1);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	incPC();
+	COUNT(CTR_INST_SUBFIC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_subfme(int RA, int RT, int Rc, int OE)
+{
+	// Inputs 'RA', implicit inputs 'CA'
+	REG val_RA = READ_GPR(RA);
+	int val_CA = READ_CA();
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  subfme%s%s\t %d,  %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA);
+
+	/* check ??? */
+
+	ADD_OV_CO_CI(val_RT, val_OV, val_CA, ~val_RA, -1, val_CA);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_SUBFME);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_subfze(int RA, int RT, int Rc, int OE)
+{
+	// Inputs 'RA', implicit inputs 'CA'
+	REG val_RA = READ_GPR(RA);
+	int val_CA = READ_CA();
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  subfze%s%s\t %d,  %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA);
+
+	ADD_OV_CO_CI(val_RT, val_OV, val_CA, ~val_RA, 0, val_CA);
+
+	// Outputs 'RT', implicit outputs 'CA'
+	WRITE_GPR(RT, val_RT);
+	WRITE_CA(val_CA);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_SUBFZE);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_dcba(int RA0, int RB)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  dcba\t %d, %d \n", pc, inst, /* in */ RA0, /* in */ RB);
+
+	/* NOP */
+
+	NOP();
+	(void)val_RA0;
+	(void)val_RB;
+	;
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_DCBA);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_dcbi(int RA0, int RB)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  dcbi\t %d, %d \n", pc, inst, /* in */ RA0, /* in */ RB);
+
+	/* Invalidate R0. Supervisor only.  Needs write perms; DSI */
+
+	CHECK_YOUR_PRIVILEGE();
+
+	LOAD8(val_RA0+val_RB);
+	MFCHECK(1);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_DCBI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_dcbf(int RA0, int RB)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  dcbf\t %d, %d \n", pc, inst, /* in */ RA0, /* in */ RB);
+
+	/* Clean/inv R0.  Needs R perms.  Note L field not represented yet. */
+
+	LOAD8(val_RA0+val_RB);
+	MFCHECK(1);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_DCBF);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_dcbt(int RA0, int RB, int TH)
+{
+	// Inputs 'RA0,RB,TH', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  dcbt\t %d, %d, %d \n", pc, inst, /* in */ RA0, /* in */ RB, /* in */ TH);
+
+	/* Prefetch.  No fault. */
+
+	NOP();
+	(void)val_RA0;
+	(void)val_RB;
+	;
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_DCBT);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_dcbst(int RA0, int RB)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  dcbst\t %d, %d \n", pc, inst, /* in */ RA0, /* in */ RB);
+
+	/* Clean R0. Needs RPerm. Can invoke DSI */
+
+	LOAD8(val_RA0+val_RB);
+	MFCHECK(1);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_DCBST);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_dcbtst(int RA0, int RB, int TH)
+{
+	// Inputs 'RA0,RB,TH', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  dcbtst\t %d, %d, %d \n", pc, inst, /* in */ RA0, /* in */ RB, /* in */ TH);
+
+	/* Prefetch for store.  No fault. */
+
+	NOP();
+	(void)val_RA0;
+	(void)val_RB;
+	;
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_DCBTST);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_dcbz(int RA0, int RB)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  dcbz\t %d, %d \n", pc, inst, /* in */ RA0, /* in */ RB);
+
+	/* DSI address will probably be wrong here…  FIXME: Round down address when reporting it, e.g. in WB? */
+
+	for (int i = 0;
+	i < 8;
+	i++) { STORE32(((val_RA0+val_RB) & ~31)+(i*4), 0);
+	MFCHECK(0);
+	};
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_DCBZ);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_icbt(int CT, int RA0, int RB)
+{
+	// Inputs 'CT,RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  icbt\t %d, %d, %d \n", pc, inst, /* in */ CT, /* in */ RA0, /* in */ RB);
+
+	/* NOP */
+
+	NOP();
+	(void)val_RA0;
+	(void)val_RB;
+	;
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_ICBT);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_cmp(int BF, int RA, int RB)
+{
+	// Inputs 'BF,RA,RB', implicit inputs 'CR'
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  cmp\t %d, %d, %d \n", pc, inst, /* in */ BF, /* in */ RA, /* in */ RB);
+
+	/* Writes CRn */
+
+	WRITE_CR_FIELD(val_CR, BF, CMP(val_RA, val_RB));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CMP);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_cmpi(int BF, int RA, s16 SI)
+{
+	// Inputs 'BF,RA,SI', implicit inputs 'CR'
+	REG val_RA = READ_GPR(RA);
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  cmpi\t %d, %d, %d \n", pc, inst, /* in */ BF, /* in */ RA, /* in */ SI);
+
+	WRITE_CR_FIELD(val_CR, BF, CMP(val_RA, SI));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CMPI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_cmpl(int BF, int RA, int RB)
+{
+	// Inputs 'BF,RA,RB', implicit inputs 'CR'
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  cmpl\t %d, %d, %d \n", pc, inst, /* in */ BF, /* in */ RA, /* in */ RB);
+
+	WRITE_CR_FIELD(val_CR, BF, CMPu(val_RA, val_RB));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CMPL);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_cmpli(int BF, int RA, u16 UI)
+{
+	// Inputs 'BF,RA,UI', implicit inputs 'CR'
+	REG val_RA = READ_GPR(RA);
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  cmpli\t %d, %d, %d \n", pc, inst, /* in */ BF, /* in */ RA, /* in */ UI);
+
+	WRITE_CR_FIELD(val_CR, BF, CMPu(val_RA, UI));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CMPLI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_crand(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  crand\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, RBIT(val_CR, BA) & RBIT(val_CR, BB));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CRAND);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_crandc(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  crandc\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, RBIT(val_CR, BA) & ~RBIT(val_CR, BB));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CRANDC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_creqv(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  creqv\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, ~(RBIT(val_CR, BA) ^ RBIT(val_CR, BB)));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CREQV);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_crnand(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  crnand\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, ~(RBIT(val_CR, BA) & RBIT(val_CR, BB)));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CRNAND);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_crnor(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  crnor\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, ~(RBIT(val_CR, BA) | RBIT(val_CR, BB)));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CRNOR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_cror(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  cror\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, RBIT(val_CR, BA) | RBIT(val_CR, BB));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CROR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_crorc(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  crorc\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, RBIT(val_CR, BA) | ~RBIT(val_CR, BB));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CRORC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_crxor(int BT, int BA, int BB)
+{
+	// Inputs 'BT,BA,BB', implicit inputs 'CR'
+	uint32_t val_CR = READ_CR();
+
+	DISASS("%08x   %08x  crxor\t %d, %d, %d \n", pc, inst, /* in */ BT, /* in */ BA, /* in */ BB);
+
+	WBIT(val_CR, BT, RBIT(val_CR, BA) ^ RBIT(val_CR, BB));
+
+	// Outputs '', implicit outputs 'CR'
+	WRITE_CR(val_CR);
+
+	incPC();
+	COUNT(CTR_INST_CRXOR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_and(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  and%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = val_RS & val_RB;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_AND);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_andc(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  andc%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = val_RS & ~val_RB;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_ANDC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_andi_rc(int RS, u16 UI, int RA)
+{
+	// Inputs 'RS,UI', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  andi_rc.\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ UI);
+
+	val_RA = val_RS & UI;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	SET_CR0(val_RA); // Copies XER.SO
+	incPC();
+	COUNT(CTR_INST_ANDI_RC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_andis_rc(int RS, u16 UI, int RA)
+{
+	// Inputs 'RS,UI', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  andis_rc.\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ UI);
+
+	val_RA = val_RS & ((REG)UI<<16);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	SET_CR0(val_RA); // Copies XER.SO
+	incPC();
+	COUNT(CTR_INST_ANDIS_RC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_eqv(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  eqv%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	/* TEST THIS */
+
+	val_RA = ~(val_RS ^ val_RB);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_EQV);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_extsb(int RS, int RA, int Rc)
+{
+	// Inputs 'RS', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  extsb%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS);
+
+	/* WB does this on mem_result, could re-use that? (But want Rc/CR0 update which is much easier in EXE, so duplicate SXT.) */
+
+	val_RA = SXT8(val_RS);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_EXTSB);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_extsh(int RS, int RA, int Rc)
+{
+	// Inputs 'RS', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  extsh%s\t %d,  %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS);
+
+	val_RA = SXT16(val_RS);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_EXTSH);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_nand(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  nand%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = ~(val_RS & val_RB);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_NAND);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_neg(int RA, int RT, int Rc, int OE)
+{
+	// Inputs 'RA', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+	int val_OV;
+
+	DISASS("%08x   %08x  neg%s%s\t %d,  %d \n", pc, inst, (OE ? "o" : ""), (Rc ? "." : ""), /* out */ RT, /* in */ RA);
+
+	ADD_OV(val_RT, val_OV, ~val_RA, 1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	if (OE) {
+		SET_SO_OV(val_OV);
+	}
+	if (Rc) {
+		SET_CR0(val_RT); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_NEG);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_nor(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  nor%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = ~(val_RS | val_RB);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_NOR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_or(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  or%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = val_RS | val_RB;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_OR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mr(int RS, int RA)
+{
+	// Inputs 'RS', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  mr\t %d,  %d \n", pc, inst, /* out */ RA, /* in */ RS);
+
+	val_RA = val_RS;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_MR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_orc(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  orc%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = val_RS | ~val_RB;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_ORC);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_ori(int RS, u16 UI, int RA)
+{
+	// Inputs 'RS,UI', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  ori\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ UI);
+
+	val_RA = val_RS | UI;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_ORI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_nop()
+{
+	// Inputs '', implicit inputs ''
+
+	DISASS("%08x   %08x  nop\t  \n", pc, inst);
+
+	NOP();
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_NOP);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_oris(int RS, u16 UI, int RA)
+{
+	// Inputs 'RS,UI', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  oris\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ UI);
+
+	val_RA = val_RS | ((REG)UI<<16);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_ORIS);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_slwi(int RS, int SH, int RA)
+{
+	// Inputs 'RS,SH', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  slwi\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ SH);
+
+	val_RA = val_RS << SH;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_SLWI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_srwi(int RS, int MB, int RA)
+{
+	// Inputs 'RS,MB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  srwi\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ MB);
+
+	val_RA = val_RS >> MB;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_SRWI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_clrlwi(int RS, int MB, int RA)
+{
+	// Inputs 'RS,MB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  clrlwi\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ MB);
+
+	val_RA = val_RS & (0xffffffffU >> MB);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_CLRLWI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_slw(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  slw%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	int sh = (val_RB & 0x3f);
+	val_RA = sh & 0x20 ? 0 : (val_RS << (val_RB & 0x1f));
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_SLW);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_srw(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  srw%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = (val_RB & 0x20) ? 0 :(uint32_t)val_RS >> (val_RB & 0x1f);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_SRW);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_xor(int RS, int RB, int RA, int Rc)
+{
+	// Inputs 'RS,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RB = READ_GPR(RB);
+	REG val_RA;
+
+	DISASS("%08x   %08x  xor%s\t %d,  %d, %d \n", pc, inst, (Rc ? "." : ""), /* out */ RA, /* in */ RS, /* in */ RB);
+
+	val_RA = val_RS ^ val_RB;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	if (Rc) {
+		SET_CR0(val_RA); // Copies XER.SO
+	}
+	incPC();
+	COUNT(CTR_INST_XOR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_xori(int RS, u16 UI, int RA)
+{
+	// Inputs 'RS,UI', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  xori\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ UI);
+
+	val_RA = val_RS ^ UI;
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_XORI);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_xoris(int RS, u16 UI, int RA)
+{
+	// Inputs 'RS,UI', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA;
+
+	DISASS("%08x   %08x  xoris\t %d,  %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ UI);
+
+	val_RA = val_RS ^ ((REG)UI<<16);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_XORIS);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lbz(int RA0, s16 D, int RT)
+{
+	// Inputs 'RA0,D', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lbz\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ D);
+
+	val_RT=LOAD8(val_RA0 + D);
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LBZ);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lbzu(int RA, s16 D, int RT)
+{
+	// Inputs 'RA,D', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lbzu\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ D);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + D;
+	val_RT = LOAD8(x);
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LBZU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lbzx(int RA0, int RB, int RT)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lbzx\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ RB);
+
+	val_RT = LOAD8(val_RA0 + val_RB);
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LBZX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lbzux(int RA, int RB, int RT)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lbzux\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + val_RB;
+	val_RT = LOAD8(x);
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LBZUX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lha(int RA0, s16 D, int RT)
+{
+	// Inputs 'RA0,D', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lha\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ D);
+
+	val_RT = SXT16(LOAD16(val_RA0 + D));
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LHA);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhau(int RA, s16 D, int RT)
+{
+	// Inputs 'RA,D', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhau\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ D);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + D;
+	val_RT = SXT16(LOAD16(x));
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LHAU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhax(int RA0, int RB, int RT)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhax\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ RB);
+
+	val_RT = SXT16(LOAD16(val_RA0 + val_RB));
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LHAX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhaux(int RA, int RB, int RT)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhaux\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + val_RB;
+	val_RT = SXT16(LOAD16(x));
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LHAUX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhbrx(int RA0, int RB, int RT)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhbrx\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ RB);
+
+	val_RT = BSWAP16(LOAD16(val_RA0 + val_RB));
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LHBRX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhz(int RA0, s16 D, int RT)
+{
+	// Inputs 'RA0,D', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhz\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ D);
+
+	val_RT = LOAD16(val_RA0 + D);
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LHZ);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhzu(int RA, s16 D, int RT)
+{
+	// Inputs 'RA,D', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhzu\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ D);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + D;
+	val_RT = LOAD16(x);
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LHZU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhzx(int RA0, int RB, int RT)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhzx\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ RB);
+
+	val_RT = LOAD16(val_RA0 + val_RB);
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LHZX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lhzux(int RA, int RB, int RT)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lhzux\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ RB);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + val_RB;
+	val_RT = LOAD16(x);
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LHZUX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lwbrx(int RA0, int RB, int RT)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lwbrx\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ RB);
+
+	val_RT = BSWAP32(LOAD32(val_RA0 + val_RB));
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LWBRX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lwz(int RA0, s16 D, int RT)
+{
+	// Inputs 'RA0,D', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lwz\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ D);
+
+	val_RT = LOAD32(val_RA0 + D);
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LWZ);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lwzu(int RA, s16 D, int RT)
+{
+	// Inputs 'RA,D', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lwzu\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ D);
+
+	ADR x = val_RA + D;
+	val_RT = LOAD32(x);
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LWZU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lwzx(int RA0, int RB, int RT)
+{
+	// Inputs 'RA0,RB', implicit inputs ''
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lwzx\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA0, /* in */ RB);
+
+	val_RT = LOAD32(val_RA0 + val_RB);
+	MFCHECK(1);
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_LWZX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_lwzux(int RA, int RB, int RT)
+{
+	// Inputs 'RA,RB', implicit inputs ''
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+	REG val_RT;
+
+	DISASS("%08x   %08x  lwzux\t %d,  %d, %d \n", pc, inst, /* out */ RT, /* in */ RA, /* in */ RB);
+
+	ADR x = val_RA + val_RB;
+	val_RT = LOAD32(x);
+	val_RA = x;
+	MFCHECK(1);
+
+	// Outputs 'RT,RA', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_LWZUX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stb(int RS, int RA0, s16 D)
+{
+	// Inputs 'RS,RA0,D', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+
+	DISASS("%08x   %08x  stb\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ D);
+
+	/* MEM stores alu_res_b to [alu_res] */
+
+	STORE8(val_RA0 + D, val_RS);
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STB);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stbu(int RS, int RA, s16 D)
+{
+	// Inputs 'RS,RA,D', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA = READ_GPR(RA);
+
+	DISASS("%08x   %08x  stbu\t %d,  %d, %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ RA, /* in */ D);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA+D;
+	STORE8(x, val_RS);
+	val_RA = x;
+	MFCHECK(0);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_STBU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stbx(int RS, int RA0, int RB)
+{
+	// Inputs 'RS,RA0,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  stbx\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ RB);
+
+	STORE8(val_RA0 + val_RB, val_RS);
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STBX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stbux(int RS, int RA, int RB)
+{
+	// Inputs 'RS,RA,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  stbux\t %d,  %d, %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ RA, /* in */ RB);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + val_RB;
+	STORE8(x, val_RS);
+	val_RA = x;
+	MFCHECK(0);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_STBUX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_sth(int RS, int RA0, s16 D)
+{
+	// Inputs 'RS,RA0,D', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+
+	DISASS("%08x   %08x  sth\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ D);
+
+	STORE16(val_RA0 + D, val_RS);
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STH);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_sthbrx(int RS, int RA0, int RB)
+{
+	// Inputs 'RS,RA0,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  sthbrx\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ RB);
+
+	STORE16(val_RA0 + val_RB, BSWAP16(val_RS));
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STHBRX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_sthu(int RS, int RA, s16 D)
+{
+	// Inputs 'RS,RA,D', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA = READ_GPR(RA);
+
+	DISASS("%08x   %08x  sthu\t %d,  %d, %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ RA, /* in */ D);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + D;
+	STORE16(x, val_RS);
+	val_RA = x;
+	MFCHECK(0);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_STHU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_sthx(int RS, int RA0, int RB)
+{
+	// Inputs 'RS,RA0,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  sthx\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ RB);
+
+	STORE16(val_RA0 + val_RB, val_RS);
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STHX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_sthux(int RS, int RA, int RB)
+{
+	// Inputs 'RS,RA,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  sthux\t %d,  %d, %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ RA, /* in */ RB);
+
+	/* FIXME: UNDEF if RA=0 */
+
+	ADR x = val_RA + val_RB;
+	STORE16(x, val_RS);
+	val_RA = x;
+	MFCHECK(0);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_STHUX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stw(int RS, int RA0, s16 D)
+{
+	// Inputs 'RS,RA0,D', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+
+	DISASS("%08x   %08x  stw\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ D);
+
+	STORE32(val_RA0 + D, val_RS);
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STW);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stwbrx(int RS, int RA0, int RB)
+{
+	// Inputs 'RS,RA0,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  stwbrx\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ RB);
+
+	STORE32(val_RA0 + val_RB, BSWAP32(val_RS));
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STWBRX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stwu(int RS, int RA, s16 D)
+{
+	// Inputs 'RS,RA,D', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA = READ_GPR(RA);
+
+	DISASS("%08x   %08x  stwu\t %d,  %d, %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ RA, /* in */ D);
+
+	ADR x = val_RA + D;
+	STORE32(x, val_RS);
+	val_RA = x;
+	MFCHECK(0);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_STWU);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stwx(int RS, int RA0, int RB)
+{
+	// Inputs 'RS,RA0,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA0 = READ_GPR_OZ(RA0);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  stwx\t %d, %d, %d \n", pc, inst, /* in */ RS, /* in */ RA0, /* in */ RB);
+
+	STORE32(val_RA0 + val_RB, val_RS);
+	MFCHECK(0);
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_STWX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_stwux(int RS, int RA, int RB)
+{
+	// Inputs 'RS,RA,RB', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	REG val_RA = READ_GPR(RA);
+	REG val_RB = READ_GPR(RB);
+
+	DISASS("%08x   %08x  stwux\t %d,  %d, %d, %d \n", pc, inst, /* out */ RA, /* in */ RS, /* in */ RA, /* in */ RB);
+
+	ADR x = val_RA + val_RB;
+	STORE32(x, val_RS);
+	val_RA = x;
+	MFCHECK(0);
+
+	// Outputs 'RA', implicit outputs ''
+	WRITE_GPR(RA, val_RA);
+
+	incPC();
+	COUNT(CTR_INST_STWUX);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mfmsr(int RT)
+{
+	// Inputs '', implicit inputs 'MSR'
+	REG val_RT;
+
+	DISASS("%08x   %08x  mfmsr\t %d \n", pc, inst, /* out */ RT);
+
+	/* MSR source */
+
+	CHECK_YOUR_PRIVILEGE();
+
+	val_RT = READ_MSR();
+
+	// Outputs 'RT', implicit outputs ''
+	WRITE_GPR(RT, val_RT);
+
+	incPC();
+	COUNT(CTR_INST_MFMSR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_mtmsr(int RS)
+{
+	// Inputs 'RS', implicit inputs ''
+	REG val_RS = READ_GPR(RS);
+	int val_MSR;
+
+	DISASS("%08x   %08x  mtmsr\t %d \n", pc, inst, /* in */ RS);
+
+	/* Looks like RFI but with implicit PC.  Self-synchronising.  (Execution synchronizing?) */
+
+	CHECK_YOUR_PRIVILEGE();
+
+	WRITE_MSR(val_RS);
+	(void)val_MSR;
+
+	// Outputs '', implicit outputs 'MSR'
+
+	incPC();
+	COUNT(CTR_INST_MTMSR);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_tlbia()
+{
+	// Inputs '', implicit inputs ''
+
+	DISASS("%08x   %08x  tlbia\t  \n", pc, inst);
+
+	/* Invalidate all */
+
+	CHECK_YOUR_HYP_PRIVILEGE();
+
+	mmu->tlbia();
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_TLBIA);
+	INTERP_RETURN;
+}
+
+template <bool trace_variant>
+RET_TYPE PPCInterpreter::op_tlbsync()
+{
+	// Inputs '', implicit inputs ''
+
+	DISASS("%08x   %08x  tlbsync\t  \n", pc, inst);
+
+	/* Looks like isync? */
+
+	CHECK_YOUR_HYP_PRIVILEGE();
+
+	NOP();
+
+	// Outputs '', implicit outputs ''
+
+	incPC();
+	COUNT(CTR_INST_TLBSYNC);
+	INTERP_RETURN;
+}
+
+template RET_TYPE PPCInterpreter::op_add<true>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_addc<true>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_adde<true>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_addi<true>(int RA0, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_li<true>(s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addis<true>(int RA0, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_lis<true>(s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addic<true>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addic_rc<true>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addme<true>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_addze<true>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_mulhw<true>(int RA, int RB, int RT, int Rc);
+template RET_TYPE PPCInterpreter::op_mulhwu<true>(int RA, int RB, int RT, int Rc);
+template RET_TYPE PPCInterpreter::op_mulli<true>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_mullw<true>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subf<true>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfc<true>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfe<true>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfic<true>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_subfme<true>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfze<true>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_dcba<true>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbi<true>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbf<true>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbt<true>(int RA0, int RB, int TH);
+template RET_TYPE PPCInterpreter::op_dcbst<true>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbtst<true>(int RA0, int RB, int TH);
+template RET_TYPE PPCInterpreter::op_dcbz<true>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_icbt<true>(int CT, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_cmp<true>(int BF, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_cmpi<true>(int BF, int RA, s16 SI);
+template RET_TYPE PPCInterpreter::op_cmpl<true>(int BF, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_cmpli<true>(int BF, int RA, u16 UI);
+template RET_TYPE PPCInterpreter::op_crand<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crandc<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_creqv<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crnand<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crnor<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_cror<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crorc<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crxor<true>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_and<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_andc<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_andi_rc<true>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_andis_rc<true>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_eqv<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_extsb<true>(int RS, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_extsh<true>(int RS, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_nand<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_neg<true>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_nor<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_or<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_mr<true>(int RS, int RA);
+template RET_TYPE PPCInterpreter::op_orc<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_ori<true>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_nop<true>();
+template RET_TYPE PPCInterpreter::op_oris<true>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_slwi<true>(int RS, int SH, int RA);
+template RET_TYPE PPCInterpreter::op_srwi<true>(int RS, int MB, int RA);
+template RET_TYPE PPCInterpreter::op_clrlwi<true>(int RS, int MB, int RA);
+template RET_TYPE PPCInterpreter::op_slw<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_srw<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_xor<true>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_xori<true>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_xoris<true>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_lbz<true>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lbzu<true>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lbzx<true>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lbzux<true>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lha<true>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhau<true>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhax<true>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhaux<true>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhbrx<true>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhz<true>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhzu<true>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhzx<true>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhzux<true>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lwbrx<true>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lwz<true>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lwzu<true>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lwzx<true>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lwzux<true>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_stb<true>(int RS, int RA0, s16 D);
+template RET_TYPE PPCInterpreter::op_stbu<true>(int RS, int RA, s16 D);
+template RET_TYPE PPCInterpreter::op_stbx<true>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_stbux<true>(int RS, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_sth<true>(int RS, int RA0, s16 D);
+template RET_TYPE PPCInterpreter::op_sthbrx<true>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_sthu<true>(int RS, int RA, s16 D);
+template RET_TYPE PPCInterpreter::op_sthx<true>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_sthux<true>(int RS, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_stw<true>(int RS, int RA0, s16 D);
+template RET_TYPE PPCInterpreter::op_stwbrx<true>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_stwu<true>(int RS, int RA, s16 D);
+template RET_TYPE PPCInterpreter::op_stwx<true>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_stwux<true>(int RS, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_mfmsr<true>(int RT);
+template RET_TYPE PPCInterpreter::op_mtmsr<true>(int RS);
+template RET_TYPE PPCInterpreter::op_tlbia<true>();
+template RET_TYPE PPCInterpreter::op_tlbsync<true>();
+template RET_TYPE PPCInterpreter::op_add<false>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_addc<false>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_adde<false>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_addi<false>(int RA0, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_li<false>(s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addis<false>(int RA0, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_lis<false>(s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addic<false>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addic_rc<false>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_addme<false>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_addze<false>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_mulhw<false>(int RA, int RB, int RT, int Rc);
+template RET_TYPE PPCInterpreter::op_mulhwu<false>(int RA, int RB, int RT, int Rc);
+template RET_TYPE PPCInterpreter::op_mulli<false>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_mullw<false>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subf<false>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfc<false>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfe<false>(int RA, int RB, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfic<false>(int RA, s16 SI, int RT);
+template RET_TYPE PPCInterpreter::op_subfme<false>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_subfze<false>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_dcba<false>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbi<false>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbf<false>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbt<false>(int RA0, int RB, int TH);
+template RET_TYPE PPCInterpreter::op_dcbst<false>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_dcbtst<false>(int RA0, int RB, int TH);
+template RET_TYPE PPCInterpreter::op_dcbz<false>(int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_icbt<false>(int CT, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_cmp<false>(int BF, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_cmpi<false>(int BF, int RA, s16 SI);
+template RET_TYPE PPCInterpreter::op_cmpl<false>(int BF, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_cmpli<false>(int BF, int RA, u16 UI);
+template RET_TYPE PPCInterpreter::op_crand<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crandc<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_creqv<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crnand<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crnor<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_cror<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crorc<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_crxor<false>(int BT, int BA, int BB);
+template RET_TYPE PPCInterpreter::op_and<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_andc<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_andi_rc<false>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_andis_rc<false>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_eqv<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_extsb<false>(int RS, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_extsh<false>(int RS, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_nand<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_neg<false>(int RA, int RT, int Rc, int OE);
+template RET_TYPE PPCInterpreter::op_nor<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_or<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_mr<false>(int RS, int RA);
+template RET_TYPE PPCInterpreter::op_orc<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_ori<false>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_nop<false>();
+template RET_TYPE PPCInterpreter::op_oris<false>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_slwi<false>(int RS, int SH, int RA);
+template RET_TYPE PPCInterpreter::op_srwi<false>(int RS, int MB, int RA);
+template RET_TYPE PPCInterpreter::op_clrlwi<false>(int RS, int MB, int RA);
+template RET_TYPE PPCInterpreter::op_slw<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_srw<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_xor<false>(int RS, int RB, int RA, int Rc);
+template RET_TYPE PPCInterpreter::op_xori<false>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_xoris<false>(int RS, u16 UI, int RA);
+template RET_TYPE PPCInterpreter::op_lbz<false>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lbzu<false>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lbzx<false>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lbzux<false>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lha<false>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhau<false>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhax<false>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhaux<false>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhbrx<false>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhz<false>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhzu<false>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lhzx<false>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lhzux<false>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lwbrx<false>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lwz<false>(int RA0, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lwzu<false>(int RA, s16 D, int RT);
+template RET_TYPE PPCInterpreter::op_lwzx<false>(int RA0, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_lwzux<false>(int RA, int RB, int RT);
+template RET_TYPE PPCInterpreter::op_stb<false>(int RS, int RA0, s16 D);
+template RET_TYPE PPCInterpreter::op_stbu<false>(int RS, int RA, s16 D);
+template RET_TYPE PPCInterpreter::op_stbx<false>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_stbux<false>(int RS, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_sth<false>(int RS, int RA0, s16 D);
+template RET_TYPE PPCInterpreter::op_sthbrx<false>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_sthu<false>(int RS, int RA, s16 D);
+template RET_TYPE PPCInterpreter::op_sthx<false>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_sthux<false>(int RS, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_stw<false>(int RS, int RA0, s16 D);
+template RET_TYPE PPCInterpreter::op_stwbrx<false>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_stwu<false>(int RS, int RA, s16 D);
+template RET_TYPE PPCInterpreter::op_stwx<false>(int RS, int RA0, int RB);
+template RET_TYPE PPCInterpreter::op_stwux<false>(int RS, int RA, int RB);
+template RET_TYPE PPCInterpreter::op_mfmsr<false>(int RT);
+template RET_TYPE PPCInterpreter::op_mtmsr<false>(int RS);
+template RET_TYPE PPCInterpreter::op_tlbia<false>();
+template RET_TYPE PPCInterpreter::op_tlbsync<false>();
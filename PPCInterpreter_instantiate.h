@@ -0,0 +1,117 @@
+#define INSTANTIATE_OPS_Arithmetic(v) \
+	template RET_TYPE PPCInterpreter::op_divw<v>(int RA, int RB, int RT, int Rc, int OE); \
+	template RET_TYPE PPCInterpreter::op_divwu<v>(int RA, int RB, int RT, int Rc, int OE);
+
+#define INSTANTIATE_OPS_Branch(v) \
+	template RET_TYPE PPCInterpreter::op_b<v>(u32 LI, int AA, int LK); \
+	template RET_TYPE PPCInterpreter::op_bc<v>(int BO, int BI, int BD, int AA, int LK); \
+	template RET_TYPE PPCInterpreter::op_bclr<v>(int BO, int BI, int BH, int LK); \
+	template RET_TYPE PPCInterpreter::op_blr<v>(); \
+	template RET_TYPE PPCInterpreter::op_bcctr<v>(int BO, int BI, int BH, int LK); \
+	template RET_TYPE PPCInterpreter::op_bctr<v>();
+
+#define INSTANTIATE_OPS_Cache(v) \
+	template RET_TYPE PPCInterpreter::op_icbi<v>(int RA0, int RB);
+
+#define INSTANTIATE_OPS_Compare(v)
+
+#define INSTANTIATE_OPS_CondReg(v) \
+	template RET_TYPE PPCInterpreter::op_mcrf<v>(int BF, int BFA); \
+	template RET_TYPE PPCInterpreter::op_mcrxr<v>(int BF); \
+	template RET_TYPE PPCInterpreter::op_mfcr<v>(int RT); \
+	template RET_TYPE PPCInterpreter::op_mtcrf<v>(int FXM, int RS);
+
+#define INSTANTIATE_OPS_Float(v) \
+	template RET_TYPE PPCInterpreter::op_lfs<v>(int RA0, s16 D, int FRT); \
+	template RET_TYPE PPCInterpreter::op_lfsu<v>(int RA, s16 D, int FRT); \
+	template RET_TYPE PPCInterpreter::op_lfsx<v>(int RA0, int RB, int FRT); \
+	template RET_TYPE PPCInterpreter::op_lfsux<v>(int RA, int RB, int FRT); \
+	template RET_TYPE PPCInterpreter::op_lfd<v>(int RA0, s16 D, int FRT); \
+	template RET_TYPE PPCInterpreter::op_lfdu<v>(int RA, s16 D, int FRT); \
+	template RET_TYPE PPCInterpreter::op_lfdx<v>(int RA0, int RB, int FRT); \
+	template RET_TYPE PPCInterpreter::op_lfdux<v>(int RA, int RB, int FRT); \
+	template RET_TYPE PPCInterpreter::op_stfs<v>(int FRS, int RA0, s16 D); \
+	template RET_TYPE PPCInterpreter::op_stfsu<v>(int FRS, int RA, s16 D); \
+	template RET_TYPE PPCInterpreter::op_stfsx<v>(int FRS, int RA0, int RB); \
+	template RET_TYPE PPCInterpreter::op_stfsux<v>(int FRS, int RA, int RB); \
+	template RET_TYPE PPCInterpreter::op_stfd<v>(int FRS, int RA0, s16 D); \
+	template RET_TYPE PPCInterpreter::op_stfdu<v>(int FRS, int RA, s16 D); \
+	template RET_TYPE PPCInterpreter::op_stfdx<v>(int FRS, int RA0, int RB); \
+	template RET_TYPE PPCInterpreter::op_stfdux<v>(int FRS, int RA, int RB); \
+	template RET_TYPE PPCInterpreter::op_stfiwx<v>(int FRS, int RA0, int RB); \
+	template RET_TYPE PPCInterpreter::op_fadd<v>(int FRA, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fsub<v>(int FRA, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fmul<v>(int FRA, int FRC, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fdiv<v>(int FRA, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fsqrt<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fmadd<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fmsub<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fnmadd<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fnmsub<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fadds<v>(int FRA, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fsubs<v>(int FRA, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fmuls<v>(int FRA, int FRC, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fdivs<v>(int FRA, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fsqrts<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fmadds<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fmsubs<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fnmadds<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fnmsubs<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fres<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_frsqrte<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fsel<v>(int FRA, int FRC, int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fmr<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fneg<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fabs<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fnabs<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_frsp<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fctiw<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fctiwz<v>(int FRB, int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_fcmpu<v>(int FRA, int FRB, int BF); \
+	template RET_TYPE PPCInterpreter::op_fcmpo<v>(int FRA, int FRB, int BF); \
+	template RET_TYPE PPCInterpreter::op_mffs<v>(int FRT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_mtfsf<v>(int FLM, int FRB, int Rc); \
+	template RET_TYPE PPCInterpreter::op_mtfsfi<v>(int U, int BF, int Rc); \
+	template RET_TYPE PPCInterpreter::op_mtfsb0<v>(int BT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_mtfsb1<v>(int BT, int Rc); \
+	template RET_TYPE PPCInterpreter::op_mcrfs<v>(int BFA, int BF);
+
+#define INSTANTIATE_OPS_Logical(v) \
+	template RET_TYPE PPCInterpreter::op_cntlzw<v>(int RS, int RA, int Rc); \
+	template RET_TYPE PPCInterpreter::op_rlwimi<v>(int RA, int RS, int SH, int MB, int ME, int Rc); \
+	template RET_TYPE PPCInterpreter::op_rlwinm<v>(int RS, int SH, int MB, int ME, int RA, int Rc); \
+	template RET_TYPE PPCInterpreter::op_rlwnm<v>(int RB, int RS, int MB, int ME, int RA, int Rc); \
+	template RET_TYPE PPCInterpreter::op_sraw<v>(int RS, int RB, int RA, int Rc); \
+	template RET_TYPE PPCInterpreter::op_srawi<v>(int RS, int SH, int RA, int Rc);
+
+#define INSTANTIATE_OPS_Memory(v) \
+	template RET_TYPE PPCInterpreter::op_lmw<v>(int RT, s16 D, int RA0); \
+	template RET_TYPE PPCInterpreter::op_lswi<v>(int RT, int RA0, int NB); \
+	template RET_TYPE PPCInterpreter::op_lswx<v>(int RT, int RA0, int RB); \
+	template RET_TYPE PPCInterpreter::op_lwarx<v>(int RA0, int RB, int EH, int RT); \
+	template RET_TYPE PPCInterpreter::op_stmw<v>(int RS, s16 D, int RA0); \
+	template RET_TYPE PPCInterpreter::op_stswi<v>(int RS, int RA0, int NB); \
+	template RET_TYPE PPCInterpreter::op_stswx<v>(int RS, int RA0, int RB); \
+	template RET_TYPE PPCInterpreter::op_stwcx<v>(int RS, int RA0, int RB);
+
+#define INSTANTIATE_OPS_Special(v) \
+	template RET_TYPE PPCInterpreter::op_eieio<v>(); \
+	template RET_TYPE PPCInterpreter::op_isync<v>(); \
+	template RET_TYPE PPCInterpreter::op_mfspr<v>(int spr, int RT); \
+	template RET_TYPE PPCInterpreter::op_mftb<v>(int spr, int RT); \
+	template RET_TYPE PPCInterpreter::op_mtspr<v>(int spr, int RS); \
+	template RET_TYPE PPCInterpreter::op_rfi<v>(); \
+	template RET_TYPE PPCInterpreter::op_sync<v>(int L, int E); \
+	template RET_TYPE PPCInterpreter::op_DEBUG<v>(int RA); \
+	template RET_TYPE PPCInterpreter::op_mfsr<v>(int SR, int RT); \
+	template RET_TYPE PPCInterpreter::op_mfsrin<v>(int RB, int RT); \
+	template RET_TYPE PPCInterpreter::op_mtsr<v>(int SR, int RS); \
+	template RET_TYPE PPCInterpreter::op_mtsrin<v>(int RS, int RB); \
+	template RET_TYPE PPCInterpreter::op_tlbie<v>(int RB, int L); \
+	template RET_TYPE PPCInterpreter::op_tlbiel<v>(int RB, int L);
+
+#define INSTANTIATE_OPS_Trap(v) \
+	template RET_TYPE PPCInterpreter::op_sc<v>(u8 LEV); \
+	template RET_TYPE PPCInterpreter::op_tw<v>(int TO, int RA, int RB); \
+	template RET_TYPE PPCInterpreter::op_twi<v>(int TO, int RA, s16 SI);
+
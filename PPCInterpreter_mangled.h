@@ -0,0 +1,397 @@
+#define CXX_op_add_t	_ZN14PPCInterpreter6op_addILb1EEEPviiiii
+#define CXX_op_add_nt	_ZN14PPCInterpreter6op_addILb0EEEPviiiii
+#define CXX_op_addc_t	_ZN14PPCInterpreter7op_addcILb1EEEPviiiii
+#define CXX_op_addc_nt	_ZN14PPCInterpreter7op_addcILb0EEEPviiiii
+#define CXX_op_adde_t	_ZN14PPCInterpreter7op_addeILb1EEEPviiiii
+#define CXX_op_adde_nt	_ZN14PPCInterpreter7op_addeILb0EEEPviiiii
+#define CXX_op_addi_t	_ZN14PPCInterpreter7op_addiILb1EEEPvisi
+#define CXX_op_addi_nt	_ZN14PPCInterpreter7op_addiILb0EEEPvisi
+#define CXX_op_li_t	_ZN14PPCInterpreter5op_liILb1EEEPvsi
+#define CXX_op_li_nt	_ZN14PPCInterpreter5op_liILb0EEEPvsi
+#define CXX_op_addis_t	_ZN14PPCInterpreter8op_addisILb1EEEPvisi
+#define CXX_op_addis_nt	_ZN14PPCInterpreter8op_addisILb0EEEPvisi
+#define CXX_op_lis_t	_ZN14PPCInterpreter6op_lisILb1EEEPvsi
+#define CXX_op_lis_nt	_ZN14PPCInterpreter6op_lisILb0EEEPvsi
+#define CXX_op_addic_t	_ZN14PPCInterpreter8op_addicILb1EEEPvisi
+#define CXX_op_addic_nt	_ZN14PPCInterpreter8op_addicILb0EEEPvisi
+#define CXX_op_addic_rc_t	_ZN14PPCInterpreter11op_addic_rcILb1EEEPvisi
+#define CXX_op_addic_rc_nt	_ZN14PPCInterpreter11op_addic_rcILb0EEEPvisi
+#define CXX_op_addme_t	_ZN14PPCInterpreter8op_addmeILb1EEEPviiii
+#define CXX_op_addme_nt	_ZN14PPCInterpreter8op_addmeILb0EEEPviiii
+#define CXX_op_addze_t	_ZN14PPCInterpreter8op_addzeILb1EEEPviiii
+#define CXX_op_addze_nt	_ZN14PPCInterpreter8op_addzeILb0EEEPviiii
+#define CXX_op_and_t	_ZN14PPCInterpreter6op_andILb1EEEPviiii
+#define CXX_op_and_nt	_ZN14PPCInterpreter6op_andILb0EEEPviiii
+#define CXX_op_andc_t	_ZN14PPCInterpreter7op_andcILb1EEEPviiii
+#define CXX_op_andc_nt	_ZN14PPCInterpreter7op_andcILb0EEEPviiii
+#define CXX_op_andi_rc_t	_ZN14PPCInterpreter10op_andi_rcILb1EEEPviti
+#define CXX_op_andi_rc_nt	_ZN14PPCInterpreter10op_andi_rcILb0EEEPviti
+#define CXX_op_andis_rc_t	_ZN14PPCInterpreter11op_andis_rcILb1EEEPviti
+#define CXX_op_andis_rc_nt	_ZN14PPCInterpreter11op_andis_rcILb0EEEPviti
+#define CXX_op_b_t	_ZN14PPCInterpreter4op_bILb1EEEPvjii
+#define CXX_op_b_nt	_ZN14PPCInterpreter4op_bILb0EEEPvjii
+#define CXX_op_bc_t	_ZN14PPCInterpreter5op_bcILb1EEEPviiiii
+#define CXX_op_bc_nt	_ZN14PPCInterpreter5op_bcILb0EEEPviiiii
+#define CXX_op_bclr_t	_ZN14PPCInterpreter7op_bclrILb1EEEPviiii
+#define CXX_op_bclr_nt	_ZN14PPCInterpreter7op_bclrILb0EEEPviiii
+#define CXX_op_blr_t	_ZN14PPCInterpreter6op_blrILb1EEEPvv
+#define CXX_op_blr_nt	_ZN14PPCInterpreter6op_blrILb0EEEPvv
+#define CXX_op_bcctr_t	_ZN14PPCInterpreter8op_bcctrILb1EEEPviiii
+#define CXX_op_bcctr_nt	_ZN14PPCInterpreter8op_bcctrILb0EEEPviiii
+#define CXX_op_bctr_t	_ZN14PPCInterpreter7op_bctrILb1EEEPvv
+#define CXX_op_bctr_nt	_ZN14PPCInterpreter7op_bctrILb0EEEPvv
+#define CXX_op_cmp_t	_ZN14PPCInterpreter6op_cmpILb1EEEPviii
+#define CXX_op_cmp_nt	_ZN14PPCInterpreter6op_cmpILb0EEEPviii
+#define CXX_op_cmpi_t	_ZN14PPCInterpreter7op_cmpiILb1EEEPviis
+#define CXX_op_cmpi_nt	_ZN14PPCInterpreter7op_cmpiILb0EEEPviis
+#define CXX_op_cmpl_t	_ZN14PPCInterpreter7op_cmplILb1EEEPviii
+#define CXX_op_cmpl_nt	_ZN14PPCInterpreter7op_cmplILb0EEEPviii
+#define CXX_op_cmpli_t	_ZN14PPCInterpreter8op_cmpliILb1EEEPviit
+#define CXX_op_cmpli_nt	_ZN14PPCInterpreter8op_cmpliILb0EEEPviit
+#define CXX_op_cntlzw_t	_ZN14PPCInterpreter9op_cntlzwILb1EEEPviii
+#define CXX_op_cntlzw_nt	_ZN14PPCInterpreter9op_cntlzwILb0EEEPviii
+#define CXX_op_crand_t	_ZN14PPCInterpreter8op_crandILb1EEEPviii
+#define CXX_op_crand_nt	_ZN14PPCInterpreter8op_crandILb0EEEPviii
+#define CXX_op_crandc_t	_ZN14PPCInterpreter9op_crandcILb1EEEPviii
+#define CXX_op_crandc_nt	_ZN14PPCInterpreter9op_crandcILb0EEEPviii
+#define CXX_op_creqv_t	_ZN14PPCInterpreter8op_creqvILb1EEEPviii
+#define CXX_op_creqv_nt	_ZN14PPCInterpreter8op_creqvILb0EEEPviii
+#define CXX_op_crnand_t	_ZN14PPCInterpreter9op_crnandILb1EEEPviii
+#define CXX_op_crnand_nt	_ZN14PPCInterpreter9op_crnandILb0EEEPviii
+#define CXX_op_crnor_t	_ZN14PPCInterpreter8op_crnorILb1EEEPviii
+#define CXX_op_crnor_nt	_ZN14PPCInterpreter8op_crnorILb0EEEPviii
+#define CXX_op_cror_t	_ZN14PPCInterpreter7op_crorILb1EEEPviii
+#define CXX_op_cror_nt	_ZN14PPCInterpreter7op_crorILb0EEEPviii
+#define CXX_op_crorc_t	_ZN14PPCInterpreter8op_crorcILb1EEEPviii
+#define CXX_op_crorc_nt	_ZN14PPCInterpreter8op_crorcILb0EEEPviii
+#define CXX_op_crxor_t	_ZN14PPCInterpreter8op_crxorILb1EEEPviii
+#define CXX_op_crxor_nt	_ZN14PPCInterpreter8op_crxorILb0EEEPviii
+#define CXX_op_divw_t	_ZN14PPCInterpreter7op_divwILb1EEEPviiiii
+#define CXX_op_divw_nt	_ZN14PPCInterpreter7op_divwILb0EEEPviiiii
+#define CXX_op_divwu_t	_ZN14PPCInterpreter8op_divwuILb1EEEPviiiii
+#define CXX_op_divwu_nt	_ZN14PPCInterpreter8op_divwuILb0EEEPviiiii
+#define CXX_op_eieio_t	_ZN14PPCInterpreter8op_eieioILb1EEEPvv
+#define CXX_op_eieio_nt	_ZN14PPCInterpreter8op_eieioILb0EEEPvv
+#define CXX_op_eqv_t	_ZN14PPCInterpreter6op_eqvILb1EEEPviiii
+#define CXX_op_eqv_nt	_ZN14PPCInterpreter6op_eqvILb0EEEPviiii
+#define CXX_op_extsb_t	_ZN14PPCInterpreter8op_extsbILb1EEEPviii
+#define CXX_op_extsb_nt	_ZN14PPCInterpreter8op_extsbILb0EEEPviii
+#define CXX_op_extsh_t	_ZN14PPCInterpreter8op_extshILb1EEEPviii
+#define CXX_op_extsh_nt	_ZN14PPCInterpreter8op_extshILb0EEEPviii
+#define CXX_op_isync_t	_ZN14PPCInterpreter8op_isyncILb1EEEPvv
+#define CXX_op_isync_nt	_ZN14PPCInterpreter8op_isyncILb0EEEPvv
+#define CXX_op_lbz_t	_ZN14PPCInterpreter6op_lbzILb1EEEPvisi
+#define CXX_op_lbz_nt	_ZN14PPCInterpreter6op_lbzILb0EEEPvisi
+#define CXX_op_lbzu_t	_ZN14PPCInterpreter7op_lbzuILb1EEEPvisi
+#define CXX_op_lbzu_nt	_ZN14PPCInterpreter7op_lbzuILb0EEEPvisi
+#define CXX_op_lbzx_t	_ZN14PPCInterpreter7op_lbzxILb1EEEPviii
+#define CXX_op_lbzx_nt	_ZN14PPCInterpreter7op_lbzxILb0EEEPviii
+#define CXX_op_lbzux_t	_ZN14PPCInterpreter8op_lbzuxILb1EEEPviii
+#define CXX_op_lbzux_nt	_ZN14PPCInterpreter8op_lbzuxILb0EEEPviii
+#define CXX_op_lha_t	_ZN14PPCInterpreter6op_lhaILb1EEEPvisi
+#define CXX_op_lha_nt	_ZN14PPCInterpreter6op_lhaILb0EEEPvisi
+#define CXX_op_lhau_t	_ZN14PPCInterpreter7op_lhauILb1EEEPvisi
+#define CXX_op_lhau_nt	_ZN14PPCInterpreter7op_lhauILb0EEEPvisi
+#define CXX_op_lhax_t	_ZN14PPCInterpreter7op_lhaxILb1EEEPviii
+#define CXX_op_lhax_nt	_ZN14PPCInterpreter7op_lhaxILb0EEEPviii
+#define CXX_op_lhaux_t	_ZN14PPCInterpreter8op_lhauxILb1EEEPviii
+#define CXX_op_lhaux_nt	_ZN14PPCInterpreter8op_lhauxILb0EEEPviii
+#define CXX_op_lhbrx_t	_ZN14PPCInterpreter8op_lhbrxILb1EEEPviii
+#define CXX_op_lhbrx_nt	_ZN14PPCInterpreter8op_lhbrxILb0EEEPviii
+#define CXX_op_lhz_t	_ZN14PPCInterpreter6op_lhzILb1EEEPvisi
+#define CXX_op_lhz_nt	_ZN14PPCInterpreter6op_lhzILb0EEEPvisi
+#define CXX_op_lhzu_t	_ZN14PPCInterpreter7op_lhzuILb1EEEPvisi
+#define CXX_op_lhzu_nt	_ZN14PPCInterpreter7op_lhzuILb0EEEPvisi
+#define CXX_op_lhzx_t	_ZN14PPCInterpreter7op_lhzxILb1EEEPviii
+#define CXX_op_lhzx_nt	_ZN14PPCInterpreter7op_lhzxILb0EEEPviii
+#define CXX_op_lhzux_t	_ZN14PPCInterpreter8op_lhzuxILb1EEEPviii
+#define CXX_op_lhzux_nt	_ZN14PPCInterpreter8op_lhzuxILb0EEEPviii
+#define CXX_op_lmw_t	_ZN14PPCInterpreter6op_lmwILb1EEEPvisi
+#define CXX_op_lmw_nt	_ZN14PPCInterpreter6op_lmwILb0EEEPvisi
+#define CXX_op_lswi_t	_ZN14PPCInterpreter7op_lswiILb1EEEPviii
+#define CXX_op_lswi_nt	_ZN14PPCInterpreter7op_lswiILb0EEEPviii
+#define CXX_op_lswx_t	_ZN14PPCInterpreter7op_lswxILb1EEEPviii
+#define CXX_op_lswx_nt	_ZN14PPCInterpreter7op_lswxILb0EEEPviii
+#define CXX_op_lwarx_t	_ZN14PPCInterpreter8op_lwarxILb1EEEPviiii
+#define CXX_op_lwarx_nt	_ZN14PPCInterpreter8op_lwarxILb0EEEPviiii
+#define CXX_op_lwbrx_t	_ZN14PPCInterpreter8op_lwbrxILb1EEEPviii
+#define CXX_op_lwbrx_nt	_ZN14PPCInterpreter8op_lwbrxILb0EEEPviii
+#define CXX_op_lwz_t	_ZN14PPCInterpreter6op_lwzILb1EEEPvisi
+#define CXX_op_lwz_nt	_ZN14PPCInterpreter6op_lwzILb0EEEPvisi
+#define CXX_op_lwzu_t	_ZN14PPCInterpreter7op_lwzuILb1EEEPvisi
+#define CXX_op_lwzu_nt	_ZN14PPCInterpreter7op_lwzuILb0EEEPvisi
+#define CXX_op_lwzx_t	_ZN14PPCInterpreter7op_lwzxILb1EEEPviii
+#define CXX_op_lwzx_nt	_ZN14PPCInterpreter7op_lwzxILb0EEEPviii
+#define CXX_op_lwzux_t	_ZN14PPCInterpreter8op_lwzuxILb1EEEPviii
+#define CXX_op_lwzux_nt	_ZN14PPCInterpreter8op_lwzuxILb0EEEPviii
+#define CXX_op_mcrf_t	_ZN14PPCInterpreter7op_mcrfILb1EEEPvii
+#define CXX_op_mcrf_nt	_ZN14PPCInterpreter7op_mcrfILb0EEEPvii
+#define CXX_op_mcrxr_t	_ZN14PPCInterpreter8op_mcrxrILb1EEEPvi
+#define CXX_op_mcrxr_nt	_ZN14PPCInterpreter8op_mcrxrILb0EEEPvi
+#define CXX_op_mfcr_t	_ZN14PPCInterpreter7op_mfcrILb1EEEPvi
+#define CXX_op_mfcr_nt	_ZN14PPCInterpreter7op_mfcrILb0EEEPvi
+#define CXX_op_mfmsr_t	_ZN14PPCInterpreter8op_mfmsrILb1EEEPvi
+#define CXX_op_mfmsr_nt	_ZN14PPCInterpreter8op_mfmsrILb0EEEPvi
+#define CXX_op_mfspr_t	_ZN14PPCInterpreter8op_mfsprILb1EEEPvii
+#define CXX_op_mfspr_nt	_ZN14PPCInterpreter8op_mfsprILb0EEEPvii
+#define CXX_op_mftb_t	_ZN14PPCInterpreter7op_mftbILb1EEEPvii
+#define CXX_op_mftb_nt	_ZN14PPCInterpreter7op_mftbILb0EEEPvii
+#define CXX_op_mtcrf_t	_ZN14PPCInterpreter8op_mtcrfILb1EEEPvii
+#define CXX_op_mtcrf_nt	_ZN14PPCInterpreter8op_mtcrfILb0EEEPvii
+#define CXX_op_mtmsr_t	_ZN14PPCInterpreter8op_mtmsrILb1EEEPvi
+#define CXX_op_mtmsr_nt	_ZN14PPCInterpreter8op_mtmsrILb0EEEPvi
+#define CXX_op_mtspr_t	_ZN14PPCInterpreter8op_mtsprILb1EEEPvii
+#define CXX_op_mtspr_nt	_ZN14PPCInterpreter8op_mtsprILb0EEEPvii
+#define CXX_op_mulhw_t	_ZN14PPCInterpreter8op_mulhwILb1EEEPviiii
+#define CXX_op_mulhw_nt	_ZN14PPCInterpreter8op_mulhwILb0EEEPviiii
+#define CXX_op_mulhwu_t	_ZN14PPCInterpreter9op_mulhwuILb1EEEPviiii
+#define CXX_op_mulhwu_nt	_ZN14PPCInterpreter9op_mulhwuILb0EEEPviiii
+#define CXX_op_mulli_t	_ZN14PPCInterpreter8op_mulliILb1EEEPvisi
+#define CXX_op_mulli_nt	_ZN14PPCInterpreter8op_mulliILb0EEEPvisi
+#define CXX_op_mullw_t	_ZN14PPCInterpreter8op_mullwILb1EEEPviiiii
+#define CXX_op_mullw_nt	_ZN14PPCInterpreter8op_mullwILb0EEEPviiiii
+#define CXX_op_nand_t	_ZN14PPCInterpreter7op_nandILb1EEEPviiii
+#define CXX_op_nand_nt	_ZN14PPCInterpreter7op_nandILb0EEEPviiii
+#define CXX_op_neg_t	_ZN14PPCInterpreter6op_negILb1EEEPviiii
+#define CXX_op_neg_nt	_ZN14PPCInterpreter6op_negILb0EEEPviiii
+#define CXX_op_nor_t	_ZN14PPCInterpreter6op_norILb1EEEPviiii
+#define CXX_op_nor_nt	_ZN14PPCInterpreter6op_norILb0EEEPviiii
+#define CXX_op_or_t	_ZN14PPCInterpreter5op_orILb1EEEPviiii
+#define CXX_op_or_nt	_ZN14PPCInterpreter5op_orILb0EEEPviiii
+#define CXX_op_mr_t	_ZN14PPCInterpreter5op_mrILb1EEEPvii
+#define CXX_op_mr_nt	_ZN14PPCInterpreter5op_mrILb0EEEPvii
+#define CXX_op_orc_t	_ZN14PPCInterpreter6op_orcILb1EEEPviiii
+#define CXX_op_orc_nt	_ZN14PPCInterpreter6op_orcILb0EEEPviiii
+#define CXX_op_ori_t	_ZN14PPCInterpreter6op_oriILb1EEEPviti
+#define CXX_op_ori_nt	_ZN14PPCInterpreter6op_oriILb0EEEPviti
+#define CXX_op_nop_t	_ZN14PPCInterpreter6op_nopILb1EEEPvv
+#define CXX_op_nop_nt	_ZN14PPCInterpreter6op_nopILb0EEEPvv
+#define CXX_op_oris_t	_ZN14PPCInterpreter7op_orisILb1EEEPviti
+#define CXX_op_oris_nt	_ZN14PPCInterpreter7op_orisILb0EEEPviti
+#define CXX_op_rfi_t	_ZN14PPCInterpreter6op_rfiILb1EEEPvv
+#define CXX_op_rfi_nt	_ZN14PPCInterpreter6op_rfiILb0EEEPvv
+#define CXX_op_rlwimi_t	_ZN14PPCInterpreter9op_rlwimiILb1EEEPviiiiii
+#define CXX_op_rlwimi_nt	_ZN14PPCInterpreter9op_rlwimiILb0EEEPviiiiii
+#define CXX_op_rlwinm_t	_ZN14PPCInterpreter9op_rlwinmILb1EEEPviiiiii
+#define CXX_op_rlwinm_nt	_ZN14PPCInterpreter9op_rlwinmILb0EEEPviiiiii
+#define CXX_op_slwi_t	_ZN14PPCInterpreter7op_slwiILb1EEEPviii
+#define CXX_op_slwi_nt	_ZN14PPCInterpreter7op_slwiILb0EEEPviii
+#define CXX_op_srwi_t	_ZN14PPCInterpreter7op_srwiILb1EEEPviii
+#define CXX_op_srwi_nt	_ZN14PPCInterpreter7op_srwiILb0EEEPviii
+#define CXX_op_clrlwi_t	_ZN14PPCInterpreter9op_clrlwiILb1EEEPviii
+#define CXX_op_clrlwi_nt	_ZN14PPCInterpreter9op_clrlwiILb0EEEPviii
+#define CXX_op_rlwnm_t	_ZN14PPCInterpreter8op_rlwnmILb1EEEPviiiiii
+#define CXX_op_rlwnm_nt	_ZN14PPCInterpreter8op_rlwnmILb0EEEPviiiiii
+#define CXX_op_sc_t	_ZN14PPCInterpreter5op_scILb1EEEPvh
+#define CXX_op_sc_nt	_ZN14PPCInterpreter5op_scILb0EEEPvh
+#define CXX_op_slw_t	_ZN14PPCInterpreter6op_slwILb1EEEPviiii
+#define CXX_op_slw_nt	_ZN14PPCInterpreter6op_slwILb0EEEPviiii
+#define CXX_op_sraw_t	_ZN14PPCInterpreter7op_srawILb1EEEPviiii
+#define CXX_op_sraw_nt	_ZN14PPCInterpreter7op_srawILb0EEEPviiii
+#define CXX_op_srawi_t	_ZN14PPCInterpreter8op_srawiILb1EEEPviiii
+#define CXX_op_srawi_nt	_ZN14PPCInterpreter8op_srawiILb0EEEPviiii
+#define CXX_op_srw_t	_ZN14PPCInterpreter6op_srwILb1EEEPviiii
+#define CXX_op_srw_nt	_ZN14PPCInterpreter6op_srwILb0EEEPviiii
+#define CXX_op_stb_t	_ZN14PPCInterpreter6op_stbILb1EEEPviis
+#define CXX_op_stb_nt	_ZN14PPCInterpreter6op_stbILb0EEEPviis
+#define CXX_op_stbu_t	_ZN14PPCInterpreter7op_stbuILb1EEEPviis
+#define CXX_op_stbu_nt	_ZN14PPCInterpreter7op_stbuILb0EEEPviis
+#define CXX_op_stbx_t	_ZN14PPCInterpreter7op_stbxILb1EEEPviii
+#define CXX_op_stbx_nt	_ZN14PPCInterpreter7op_stbxILb0EEEPviii
+#define CXX_op_stbux_t	_ZN14PPCInterpreter8op_stbuxILb1EEEPviii
+#define CXX_op_stbux_nt	_ZN14PPCInterpreter8op_stbuxILb0EEEPviii
+#define CXX_op_sth_t	_ZN14PPCInterpreter6op_sthILb1EEEPviis
+#define CXX_op_sth_nt	_ZN14PPCInterpreter6op_sthILb0EEEPviis
+#define CXX_op_sthbrx_t	_ZN14PPCInterpreter9op_sthbrxILb1EEEPviii
+#define CXX_op_sthbrx_nt	_ZN14PPCInterpreter9op_sthbrxILb0EEEPviii
+#define CXX_op_sthu_t	_ZN14PPCInterpreter7op_sthuILb1EEEPviis
+#define CXX_op_sthu_nt	_ZN14PPCInterpreter7op_sthuILb0EEEPviis
+#define CXX_op_sthx_t	_ZN14PPCInterpreter7op_sthxILb1EEEPviii
+#define CXX_op_sthx_nt	_ZN14PPCInterpreter7op_sthxILb0EEEPviii
+#define CXX_op_sthux_t	_ZN14PPCInterpreter8op_sthuxILb1EEEPviii
+#define CXX_op_sthux_nt	_ZN14PPCInterpreter8op_sthuxILb0EEEPviii
+#define CXX_op_stmw_t	_ZN14PPCInterpreter7op_stmwILb1EEEPvisi
+#define CXX_op_stmw_nt	_ZN14PPCInterpreter7op_stmwILb0EEEPvisi
+#define CXX_op_stswi_t	_ZN14PPCInterpreter8op_stswiILb1EEEPviii
+#define CXX_op_stswi_nt	_ZN14PPCInterpreter8op_stswiILb0EEEPviii
+#define CXX_op_stswx_t	_ZN14PPCInterpreter8op_stswxILb1EEEPviii
+#define CXX_op_stswx_nt	_ZN14PPCInterpreter8op_stswxILb0EEEPviii
+#define CXX_op_stw_t	_ZN14PPCInterpreter6op_stwILb1EEEPviis
+#define CXX_op_stw_nt	_ZN14PPCInterpreter6op_stwILb0EEEPviis
+#define CXX_op_stwbrx_t	_ZN14PPCInterpreter9op_stwbrxILb1EEEPviii
+#define CXX_op_stwbrx_nt	_ZN14PPCInterpreter9op_stwbrxILb0EEEPviii
+#define CXX_op_stwcx_t	_ZN14PPCInterpreter8op_stwcxILb1EEEPviii
+#define CXX_op_stwcx_nt	_ZN14PPCInterpreter8op_stwcxILb0EEEPviii
+#define CXX_op_stwu_t	_ZN14PPCInterpreter7op_stwuILb1EEEPviis
+#define CXX_op_stwu_nt	_ZN14PPCInterpreter7op_stwuILb0EEEPviis
+#define CXX_op_stwx_t	_ZN14PPCInterpreter7op_stwxILb1EEEPviii
+#define CXX_op_stwx_nt	_ZN14PPCInterpreter7op_stwxILb0EEEPviii
+#define CXX_op_stwux_t	_ZN14PPCInterpreter8op_stwuxILb1EEEPviii
+#define CXX_op_stwux_nt	_ZN14PPCInterpreter8op_stwuxILb0EEEPviii
+#define CXX_op_subf_t	_ZN14PPCInterpreter7op_subfILb1EEEPviiiii
+#define CXX_op_subf_nt	_ZN14PPCInterpreter7op_subfILb0EEEPviiiii
+#define CXX_op_subfc_t	_ZN14PPCInterpreter8op_subfcILb1EEEPviiiii
+#define CXX_op_subfc_nt	_ZN14PPCInterpreter8op_subfcILb0EEEPviiiii
+#define CXX_op_subfe_t	_ZN14PPCInterpreter8op_subfeILb1EEEPviiiii
+#define CXX_op_subfe_nt	_ZN14PPCInterpreter8op_subfeILb0EEEPviiiii
+#define CXX_op_subfic_t	_ZN14PPCInterpreter9op_subficILb1EEEPvisi
+#define CXX_op_subfic_nt	_ZN14PPCInterpreter9op_subficILb0EEEPvisi
+#define CXX_op_subfme_t	_ZN14PPCInterpreter9op_subfmeILb1EEEPviiii
+#define CXX_op_subfme_nt	_ZN14PPCInterpreter9op_subfmeILb0EEEPviiii
+#define CXX_op_subfze_t	_ZN14PPCInterpreter9op_subfzeILb1EEEPviiii
+#define CXX_op_subfze_nt	_ZN14PPCInterpreter9op_subfzeILb0EEEPviiii
+#define CXX_op_sync_t	_ZN14PPCInterpreter7op_syncILb1EEEPvii
+#define CXX_op_sync_nt	_ZN14PPCInterpreter7op_syncILb0EEEPvii
+#define CXX_op_tw_t	_ZN14PPCInterpreter5op_twILb1EEEPviii
+#define CXX_op_tw_nt	_ZN14PPCInterpreter5op_twILb0EEEPviii
+#define CXX_op_twi_t	_ZN14PPCInterpreter6op_twiILb1EEEPviis
+#define CXX_op_twi_nt	_ZN14PPCInterpreter6op_twiILb0EEEPviis
+#define CXX_op_xor_t	_ZN14PPCInterpreter6op_xorILb1EEEPviiii
+#define CXX_op_xor_nt	_ZN14PPCInterpreter6op_xorILb0EEEPviiii
+#define CXX_op_xori_t	_ZN14PPCInterpreter7op_xoriILb1EEEPviti
+#define CXX_op_xori_nt	_ZN14PPCInterpreter7op_xoriILb0EEEPviti
+#define CXX_op_xoris_t	_ZN14PPCInterpreter8op_xorisILb1EEEPviti
+#define CXX_op_xoris_nt	_ZN14PPCInterpreter8op_xorisILb0EEEPviti
+#define CXX_op_lfs_t	_ZN14PPCInterpreter6op_lfsILb1EEEPvisi
+#define CXX_op_lfs_nt	_ZN14PPCInterpreter6op_lfsILb0EEEPvisi
+#define CXX_op_lfsu_t	_ZN14PPCInterpreter7op_lfsuILb1EEEPvisi
+#define CXX_op_lfsu_nt	_ZN14PPCInterpreter7op_lfsuILb0EEEPvisi
+#define CXX_op_lfsx_t	_ZN14PPCInterpreter7op_lfsxILb1EEEPviii
+#define CXX_op_lfsx_nt	_ZN14PPCInterpreter7op_lfsxILb0EEEPviii
+#define CXX_op_lfsux_t	_ZN14PPCInterpreter8op_lfsuxILb1EEEPviii
+#define CXX_op_lfsux_nt	_ZN14PPCInterpreter8op_lfsuxILb0EEEPviii
+#define CXX_op_lfd_t	_ZN14PPCInterpreter6op_lfdILb1EEEPvisi
+#define CXX_op_lfd_nt	_ZN14PPCInterpreter6op_lfdILb0EEEPvisi
+#define CXX_op_lfdu_t	_ZN14PPCInterpreter7op_lfduILb1EEEPvisi
+#define CXX_op_lfdu_nt	_ZN14PPCInterpreter7op_lfduILb0EEEPvisi
+#define CXX_op_lfdx_t	_ZN14PPCInterpreter7op_lfdxILb1EEEPviii
+#define CXX_op_lfdx_nt	_ZN14PPCInterpreter7op_lfdxILb0EEEPviii
+#define CXX_op_lfdux_t	_ZN14PPCInterpreter8op_lfduxILb1EEEPviii
+#define CXX_op_lfdux_nt	_ZN14PPCInterpreter8op_lfduxILb0EEEPviii
+#define CXX_op_stfs_t	_ZN14PPCInterpreter7op_stfsILb1EEEPviis
+#define CXX_op_stfs_nt	_ZN14PPCInterpreter7op_stfsILb0EEEPviis
+#define CXX_op_stfsu_t	_ZN14PPCInterpreter8op_stfsuILb1EEEPviis
+#define CXX_op_stfsu_nt	_ZN14PPCInterpreter8op_stfsuILb0EEEPviis
+#define CXX_op_stfsx_t	_ZN14PPCInterpreter8op_stfsxILb1EEEPviii
+#define CXX_op_stfsx_nt	_ZN14PPCInterpreter8op_stfsxILb0EEEPviii
+#define CXX_op_stfsux_t	_ZN14PPCInterpreter9op_stfsuxILb1EEEPviii
+#define CXX_op_stfsux_nt	_ZN14PPCInterpreter9op_stfsuxILb0EEEPviii
+#define CXX_op_stfd_t	_ZN14PPCInterpreter7op_stfdILb1EEEPviis
+#define CXX_op_stfd_nt	_ZN14PPCInterpreter7op_stfdILb0EEEPviis
+#define CXX_op_stfdu_t	_ZN14PPCInterpreter8op_stfduILb1EEEPviis
+#define CXX_op_stfdu_nt	_ZN14PPCInterpreter8op_stfduILb0EEEPviis
+#define CXX_op_stfdx_t	_ZN14PPCInterpreter8op_stfdxILb1EEEPviii
+#define CXX_op_stfdx_nt	_ZN14PPCInterpreter8op_stfdxILb0EEEPviii
+#define CXX_op_stfdux_t	_ZN14PPCInterpreter9op_stfduxILb1EEEPviii
+#define CXX_op_stfdux_nt	_ZN14PPCInterpreter9op_stfduxILb0EEEPviii
+#define CXX_op_stfiwx_t	_ZN14PPCInterpreter9op_stfiwxILb1EEEPviii
+#define CXX_op_stfiwx_nt	_ZN14PPCInterpreter9op_stfiwxILb0EEEPviii
+#define CXX_op_fadd_t	_ZN14PPCInterpreter7op_faddILb1EEEPviiii
+#define CXX_op_fadd_nt	_ZN14PPCInterpreter7op_faddILb0EEEPviiii
+#define CXX_op_fsub_t	_ZN14PPCInterpreter7op_fsubILb1EEEPviiii
+#define CXX_op_fsub_nt	_ZN14PPCInterpreter7op_fsubILb0EEEPviiii
+#define CXX_op_fmul_t	_ZN14PPCInterpreter7op_fmulILb1EEEPviiii
+#define CXX_op_fmul_nt	_ZN14PPCInterpreter7op_fmulILb0EEEPviiii
+#define CXX_op_fdiv_t	_ZN14PPCInterpreter7op_fdivILb1EEEPviiii
+#define CXX_op_fdiv_nt	_ZN14PPCInterpreter7op_fdivILb0EEEPviiii
+#define CXX_op_fsqrt_t	_ZN14PPCInterpreter8op_fsqrtILb1EEEPviii
+#define CXX_op_fsqrt_nt	_ZN14PPCInterpreter8op_fsqrtILb0EEEPviii
+#define CXX_op_fmadd_t	_ZN14PPCInterpreter8op_fmaddILb1EEEPviiiii
+#define CXX_op_fmadd_nt	_ZN14PPCInterpreter8op_fmaddILb0EEEPviiiii
+#define CXX_op_fmsub_t	_ZN14PPCInterpreter8op_fmsubILb1EEEPviiiii
+#define CXX_op_fmsub_nt	_ZN14PPCInterpreter8op_fmsubILb0EEEPviiiii
+#define CXX_op_fnmadd_t	_ZN14PPCInterpreter9op_fnmaddILb1EEEPviiiii
+#define CXX_op_fnmadd_nt	_ZN14PPCInterpreter9op_fnmaddILb0EEEPviiiii
+#define CXX_op_fnmsub_t	_ZN14PPCInterpreter9op_fnmsubILb1EEEPviiiii
+#define CXX_op_fnmsub_nt	_ZN14PPCInterpreter9op_fnmsubILb0EEEPviiiii
+#define CXX_op_fadds_t	_ZN14PPCInterpreter8op_faddsILb1EEEPviiii
+#define CXX_op_fadds_nt	_ZN14PPCInterpreter8op_faddsILb0EEEPviiii
+#define CXX_op_fsubs_t	_ZN14PPCInterpreter8op_fsubsILb1EEEPviiii
+#define CXX_op_fsubs_nt	_ZN14PPCInterpreter8op_fsubsILb0EEEPviiii
+#define CXX_op_fmuls_t	_ZN14PPCInterpreter8op_fmulsILb1EEEPviiii
+#define CXX_op_fmuls_nt	_ZN14PPCInterpreter8op_fmulsILb0EEEPviiii
+#define CXX_op_fdivs_t	_ZN14PPCInterpreter8op_fdivsILb1EEEPviiii
+#define CXX_op_fdivs_nt	_ZN14PPCInterpreter8op_fdivsILb0EEEPviiii
+#define CXX_op_fsqrts_t	_ZN14PPCInterpreter9op_fsqrtsILb1EEEPviii
+#define CXX_op_fsqrts_nt	_ZN14PPCInterpreter9op_fsqrtsILb0EEEPviii
+#define CXX_op_fmadds_t	_ZN14PPCInterpreter9op_fmaddsILb1EEEPviiiii
+#define CXX_op_fmadds_nt	_ZN14PPCInterpreter9op_fmaddsILb0EEEPviiiii
+#define CXX_op_fmsubs_t	_ZN14PPCInterpreter9op_fmsubsILb1EEEPviiiii
+#define CXX_op_fmsubs_nt	_ZN14PPCInterpreter9op_fmsubsILb0EEEPviiiii
+#define CXX_op_fnmadds_t	_ZN14PPCInterpreter10op_fnmaddsILb1EEEPviiiii
+#define CXX_op_fnmadds_nt	_ZN14PPCInterpreter10op_fnmaddsILb0EEEPviiiii
+#define CXX_op_fnmsubs_t	_ZN14PPCInterpreter10op_fnmsubsILb1EEEPviiiii
+#define CXX_op_fnmsubs_nt	_ZN14PPCInterpreter10op_fnmsubsILb0EEEPviiiii
+#define CXX_op_fres_t	_ZN14PPCInterpreter7op_fresILb1EEEPviii
+#define CXX_op_fres_nt	_ZN14PPCInterpreter7op_fresILb0EEEPviii
+#define CXX_op_frsqrte_t	_ZN14PPCInterpreter10op_frsqrteILb1EEEPviii
+#define CXX_op_frsqrte_nt	_ZN14PPCInterpreter10op_frsqrteILb0EEEPviii
+#define CXX_op_fsel_t	_ZN14PPCInterpreter7op_fselILb1EEEPviiiii
+#define CXX_op_fsel_nt	_ZN14PPCInterpreter7op_fselILb0EEEPviiiii
+#define CXX_op_fmr_t	_ZN14PPCInterpreter6op_fmrILb1EEEPviii
+#define CXX_op_fmr_nt	_ZN14PPCInterpreter6op_fmrILb0EEEPviii
+#define CXX_op_fneg_t	_ZN14PPCInterpreter7op_fnegILb1EEEPviii
+#define CXX_op_fneg_nt	_ZN14PPCInterpreter7op_fnegILb0EEEPviii
+#define CXX_op_fabs_t	_ZN14PPCInterpreter7op_fabsILb1EEEPviii
+#define CXX_op_fabs_nt	_ZN14PPCInterpreter7op_fabsILb0EEEPviii
+#define CXX_op_fnabs_t	_ZN14PPCInterpreter8op_fnabsILb1EEEPviii
+#define CXX_op_fnabs_nt	_ZN14PPCInterpreter8op_fnabsILb0EEEPviii
+#define CXX_op_frsp_t	_ZN14PPCInterpreter7op_frspILb1EEEPviii
+#define CXX_op_frsp_nt	_ZN14PPCInterpreter7op_frspILb0EEEPviii
+#define CXX_op_fctiw_t	_ZN14PPCInterpreter8op_fctiwILb1EEEPviii
+#define CXX_op_fctiw_nt	_ZN14PPCInterpreter8op_fctiwILb0EEEPviii
+#define CXX_op_fctiwz_t	_ZN14PPCInterpreter9op_fctiwzILb1EEEPviii
+#define CXX_op_fctiwz_nt	_ZN14PPCInterpreter9op_fctiwzILb0EEEPviii
+#define CXX_op_fcmpu_t	_ZN14PPCInterpreter8op_fcmpuILb1EEEPviii
+#define CXX_op_fcmpu_nt	_ZN14PPCInterpreter8op_fcmpuILb0EEEPviii
+#define CXX_op_fcmpo_t	_ZN14PPCInterpreter8op_fcmpoILb1EEEPviii
+#define CXX_op_fcmpo_nt	_ZN14PPCInterpreter8op_fcmpoILb0EEEPviii
+#define CXX_op_mffs_t	_ZN14PPCInterpreter7op_mffsILb1EEEPvii
+#define CXX_op_mffs_nt	_ZN14PPCInterpreter7op_mffsILb0EEEPvii
+#define CXX_op_mtfsf_t	_ZN14PPCInterpreter8op_mtfsfILb1EEEPviii
+#define CXX_op_mtfsf_nt	_ZN14PPCInterpreter8op_mtfsfILb0EEEPviii
+#define CXX_op_mtfsfi_t	_ZN14PPCInterpreter9op_mtfsfiILb1EEEPviii
+#define CXX_op_mtfsfi_nt	_ZN14PPCInterpreter9op_mtfsfiILb0EEEPviii
+#define CXX_op_mtfsb0_t	_ZN14PPCInterpreter9op_mtfsb0ILb1EEEPvii
+#define CXX_op_mtfsb0_nt	_ZN14PPCInterpreter9op_mtfsb0ILb0EEEPvii
+#define CXX_op_mtfsb1_t	_ZN14PPCInterpreter9op_mtfsb1ILb1EEEPvii
+#define CXX_op_mtfsb1_nt	_ZN14PPCInterpreter9op_mtfsb1ILb0EEEPvii
+#define CXX_op_mcrfs_t	_ZN14PPCInterpreter8op_mcrfsILb1EEEPvii
+#define CXX_op_mcrfs_nt	_ZN14PPCInterpreter8op_mcrfsILb0EEEPvii
+#define CXX_op_DEBUG_t	_ZN14PPCInterpreter8op_DEBUGILb1EEEPvi
+#define CXX_op_DEBUG_nt	_ZN14PPCInterpreter8op_DEBUGILb0EEEPvi
+#define CXX_op_dcba_t	_ZN14PPCInterpreter7op_dcbaILb1EEEPvii
+#define CXX_op_dcba_nt	_ZN14PPCInterpreter7op_dcbaILb0EEEPvii
+#define CXX_op_dcbi_t	_ZN14PPCInterpreter7op_dcbiILb1EEEPvii
+#define CXX_op_dcbi_nt	_ZN14PPCInterpreter7op_dcbiILb0EEEPvii
+#define CXX_op_dcbf_t	_ZN14PPCInterpreter7op_dcbfILb1EEEPvii
+#define CXX_op_dcbf_nt	_ZN14PPCInterpreter7op_dcbfILb0EEEPvii
+#define CXX_op_dcbt_t	_ZN14PPCInterpreter7op_dcbtILb1EEEPviii
+#define CXX_op_dcbt_nt	_ZN14PPCInterpreter7op_dcbtILb0EEEPviii
+#define CXX_op_dcbst_t	_ZN14PPCInterpreter8op_dcbstILb1EEEPvii
+#define CXX_op_dcbst_nt	_ZN14PPCInterpreter8op_dcbstILb0EEEPvii
+#define CXX_op_dcbtst_t	_ZN14PPCInterpreter9op_dcbtstILb1EEEPviii
+#define CXX_op_dcbtst_nt	_ZN14PPCInterpreter9op_dcbtstILb0EEEPviii
+#define CXX_op_dcbz_t	_ZN14PPCInterpreter7op_dcbzILb1EEEPvii
+#define CXX_op_dcbz_nt	_ZN14PPCInterpreter7op_dcbzILb0EEEPvii
+#define CXX_op_icbi_t	_ZN14PPCInterpreter7op_icbiILb1EEEPvii
+#define CXX_op_icbi_nt	_ZN14PPCInterpreter7op_icbiILb0EEEPvii
+#define CXX_op_icbt_t	_ZN14PPCInterpreter7op_icbtILb1EEEPviii
+#define CXX_op_icbt_nt	_ZN14PPCInterpreter7op_icbtILb0EEEPviii
+#define CXX_op_mfsr_t	_ZN14PPCInterpreter7op_mfsrILb1EEEPvii
+#define CXX_op_mfsr_nt	_ZN14PPCInterpreter7op_mfsrILb0EEEPvii
+#define CXX_op_mfsrin_t	_ZN14PPCInterpreter9op_mfsrinILb1EEEPvii
+#define CXX_op_mfsrin_nt	_ZN14PPCInterpreter9op_mfsrinILb0EEEPvii
+#define CXX_op_mtsr_t	_ZN14PPCInterpreter7op_mtsrILb1EEEPvii
+#define CXX_op_mtsr_nt	_ZN14PPCInterpreter7op_mtsrILb0EEEPvii
+#define CXX_op_mtsrin_t	_ZN14PPCInterpreter9op_mtsrinILb1EEEPvii
+#define CXX_op_mtsrin_nt	_ZN14PPCInterpreter9op_mtsrinILb0EEEPvii
+#define CXX_op_tlbie_t	_ZN14PPCInterpreter8op_tlbieILb1EEEPvii
+#define CXX_op_tlbie_nt	_ZN14PPCInterpreter8op_tlbieILb0EEEPvii
+#define CXX_op_tlbiel_t	_ZN14PPCInterpreter9op_tlbielILb1EEEPvii
+#define CXX_op_tlbiel_nt	_ZN14PPCInterpreter9op_tlbielILb0EEEPvii
+#define CXX_op_tlbia_t	_ZN14PPCInterpreter8op_tlbiaILb1EEEPvv
+#define CXX_op_tlbia_nt	_ZN14PPCInterpreter8op_tlbiaILb0EEEPvv
+#define CXX_op_tlbsync_t	_ZN14PPCInterpreter10op_tlbsyncILb1EEEPvv
+#define CXX_op_tlbsync_nt	_ZN14PPCInterpreter10op_tlbsyncILb0EEEPvv
+#define CXX_op_unk	_ZN14PPCInterpreter6op_unkEj
@@ -0,0 +1,199 @@
+template <bool trace_variant> RET_TYPE op_add(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_addc(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_adde(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_addi(int RA0, s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_li(s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_addis(int RA0, s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_lis(s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_addic(int RA, s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_addic_rc(int RA, s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_addme(int RA, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_addze(int RA, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_and(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_andc(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_andi_rc(int RS, u16 UI, int RA);
+template <bool trace_variant> RET_TYPE op_andis_rc(int RS, u16 UI, int RA);
+template <bool trace_variant> RET_TYPE op_b(u32 LI, int AA, int LK);
+template <bool trace_variant> RET_TYPE op_bc(int BO, int BI, int BD, int AA, int LK);
+template <bool trace_variant> RET_TYPE op_bclr(int BO, int BI, int BH, int LK);
+template <bool trace_variant> RET_TYPE op_blr();
+template <bool trace_variant> RET_TYPE op_bcctr(int BO, int BI, int BH, int LK);
+template <bool trace_variant> RET_TYPE op_bctr();
+template <bool trace_variant> RET_TYPE op_cmp(int BF, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_cmpi(int BF, int RA, s16 SI);
+template <bool trace_variant> RET_TYPE op_cmpl(int BF, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_cmpli(int BF, int RA, u16 UI);
+template <bool trace_variant> RET_TYPE op_cntlzw(int RS, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_crand(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_crandc(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_creqv(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_crnand(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_crnor(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_cror(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_crorc(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_crxor(int BT, int BA, int BB);
+template <bool trace_variant> RET_TYPE op_divw(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_divwu(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_eieio();
+template <bool trace_variant> RET_TYPE op_eqv(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_extsb(int RS, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_extsh(int RS, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_isync();
+template <bool trace_variant> RET_TYPE op_lbz(int RA0, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lbzu(int RA, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lbzx(int RA0, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lbzux(int RA, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lha(int RA0, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lhau(int RA, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lhax(int RA0, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lhaux(int RA, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lhbrx(int RA0, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lhz(int RA0, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lhzu(int RA, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lhzx(int RA0, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lhzux(int RA, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lmw(int RT, s16 D, int RA0);
+template <bool trace_variant> RET_TYPE op_lswi(int RT, int RA0, int NB);
+template <bool trace_variant> RET_TYPE op_lswx(int RT, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_lwarx(int RA0, int RB, int EH, int RT);
+template <bool trace_variant> RET_TYPE op_lwbrx(int RA0, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lwz(int RA0, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lwzu(int RA, s16 D, int RT);
+template <bool trace_variant> RET_TYPE op_lwzx(int RA0, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_lwzux(int RA, int RB, int RT);
+template <bool trace_variant> RET_TYPE op_mcrf(int BF, int BFA);
+template <bool trace_variant> RET_TYPE op_mcrxr(int BF);
+template <bool trace_variant> RET_TYPE op_mfcr(int RT);
+template <bool trace_variant> RET_TYPE op_mfmsr(int RT);
+template <bool trace_variant> RET_TYPE op_mfspr(int spr, int RT);
+template <bool trace_variant> RET_TYPE op_mftb(int spr, int RT);
+template <bool trace_variant> RET_TYPE op_mtcrf(int FXM, int RS);
+template <bool trace_variant> RET_TYPE op_mtmsr(int RS);
+template <bool trace_variant> RET_TYPE op_mtspr(int spr, int RS);
+template <bool trace_variant> RET_TYPE op_mulhw(int RA, int RB, int RT, int Rc);
+template <bool trace_variant> RET_TYPE op_mulhwu(int RA, int RB, int RT, int Rc);
+template <bool trace_variant> RET_TYPE op_mulli(int RA, s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_mullw(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_nand(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_neg(int RA, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_nor(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_or(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_mr(int RS, int RA);
+template <bool trace_variant> RET_TYPE op_orc(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_ori(int RS, u16 UI, int RA);
+template <bool trace_variant> RET_TYPE op_nop();
+template <bool trace_variant> RET_TYPE op_oris(int RS, u16 UI, int RA);
+template <bool trace_variant> RET_TYPE op_rfi();
+template <bool trace_variant> RET_TYPE op_rlwimi(int RA, int RS, int SH, int MB, int ME, int Rc);
+template <bool trace_variant> RET_TYPE op_rlwinm(int RS, int SH, int MB, int ME, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_slwi(int RS, int SH, int RA);
+template <bool trace_variant> RET_TYPE op_srwi(int RS, int MB, int RA);
+template <bool trace_variant> RET_TYPE op_clrlwi(int RS, int MB, int RA);
+template <bool trace_variant> RET_TYPE op_rlwnm(int RB, int RS, int MB, int ME, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_sc(u8 LEV);
+template <bool trace_variant> RET_TYPE op_slw(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_sraw(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_srawi(int RS, int SH, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_srw(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_stb(int RS, int RA0, s16 D);
+template <bool trace_variant> RET_TYPE op_stbu(int RS, int RA, s16 D);
+template <bool trace_variant> RET_TYPE op_stbx(int RS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_stbux(int RS, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_sth(int RS, int RA0, s16 D);
+template <bool trace_variant> RET_TYPE op_sthbrx(int RS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_sthu(int RS, int RA, s16 D);
+template <bool trace_variant> RET_TYPE op_sthx(int RS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_sthux(int RS, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_stmw(int RS, s16 D, int RA0);
+template <bool trace_variant> RET_TYPE op_stswi(int RS, int RA0, int NB);
+template <bool trace_variant> RET_TYPE op_stswx(int RS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_stw(int RS, int RA0, s16 D);
+template <bool trace_variant> RET_TYPE op_stwbrx(int RS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_stwcx(int RS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_stwu(int RS, int RA, s16 D);
+template <bool trace_variant> RET_TYPE op_stwx(int RS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_stwux(int RS, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_subf(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_subfc(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_subfe(int RA, int RB, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_subfic(int RA, s16 SI, int RT);
+template <bool trace_variant> RET_TYPE op_subfme(int RA, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_subfze(int RA, int RT, int Rc, int OE);
+template <bool trace_variant> RET_TYPE op_sync(int L, int E);
+template <bool trace_variant> RET_TYPE op_tw(int TO, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_twi(int TO, int RA, s16 SI);
+template <bool trace_variant> RET_TYPE op_xor(int RS, int RB, int RA, int Rc);
+template <bool trace_variant> RET_TYPE op_xori(int RS, u16 UI, int RA);
+template <bool trace_variant> RET_TYPE op_xoris(int RS, u16 UI, int RA);
+template <bool trace_variant> RET_TYPE op_lfs(int RA0, s16 D, int FRT);
+template <bool trace_variant> RET_TYPE op_lfsu(int RA, s16 D, int FRT);
+template <bool trace_variant> RET_TYPE op_lfsx(int RA0, int RB, int FRT);
+template <bool trace_variant> RET_TYPE op_lfsux(int RA, int RB, int FRT);
+template <bool trace_variant> RET_TYPE op_lfd(int RA0, s16 D, int FRT);
+template <bool trace_variant> RET_TYPE op_lfdu(int RA, s16 D, int FRT);
+template <bool trace_variant> RET_TYPE op_lfdx(int RA0, int RB, int FRT);
+template <bool trace_variant> RET_TYPE op_lfdux(int RA, int RB, int FRT);
+template <bool trace_variant> RET_TYPE op_stfs(int FRS, int RA0, s16 D);
+template <bool trace_variant> RET_TYPE op_stfsu(int FRS, int RA, s16 D);
+template <bool trace_variant> RET_TYPE op_stfsx(int FRS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_stfsux(int FRS, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_stfd(int FRS, int RA0, s16 D);
+template <bool trace_variant> RET_TYPE op_stfdu(int FRS, int RA, s16 D);
+template <bool trace_variant> RET_TYPE op_stfdx(int FRS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_stfdux(int FRS, int RA, int RB);
+template <bool trace_variant> RET_TYPE op_stfiwx(int FRS, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_fadd(int FRA, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fsub(int FRA, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fmul(int FRA, int FRC, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fdiv(int FRA, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fsqrt(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fmadd(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fmsub(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fnmadd(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fnmsub(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fadds(int FRA, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fsubs(int FRA, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fmuls(int FRA, int FRC, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fdivs(int FRA, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fsqrts(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fmadds(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fmsubs(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fnmadds(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fnmsubs(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fres(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_frsqrte(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fsel(int FRA, int FRC, int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fmr(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fneg(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fabs(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fnabs(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_frsp(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fctiw(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fctiwz(int FRB, int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_fcmpu(int FRA, int FRB, int BF);
+template <bool trace_variant> RET_TYPE op_fcmpo(int FRA, int FRB, int BF);
+template <bool trace_variant> RET_TYPE op_mffs(int FRT, int Rc);
+template <bool trace_variant> RET_TYPE op_mtfsf(int FLM, int FRB, int Rc);
+template <bool trace_variant> RET_TYPE op_mtfsfi(int U, int BF, int Rc);
+template <bool trace_variant> RET_TYPE op_mtfsb0(int BT, int Rc);
+template <bool trace_variant> RET_TYPE op_mtfsb1(int BT, int Rc);
+template <bool trace_variant> RET_TYPE op_mcrfs(int BFA, int BF);
+template <bool trace_variant> RET_TYPE op_DEBUG(int RA);
+template <bool trace_variant> RET_TYPE op_dcba(int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_dcbi(int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_dcbf(int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_dcbt(int RA0, int RB, int TH);
+template <bool trace_variant> RET_TYPE op_dcbst(int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_dcbtst(int RA0, int RB, int TH);
+template <bool trace_variant> RET_TYPE op_dcbz(int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_icbi(int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_icbt(int CT, int RA0, int RB);
+template <bool trace_variant> RET_TYPE op_mfsr(int SR, int RT);
+template <bool trace_variant> RET_TYPE op_mfsrin(int RB, int RT);
+template <bool trace_variant> RET_TYPE op_mtsr(int SR, int RS);
+template <bool trace_variant> RET_TYPE op_mtsrin(int RS, int RB);
+template <bool trace_variant> RET_TYPE op_tlbie(int RB, int L);
+template <bool trace_variant> RET_TYPE op_tlbiel(int RB, int L);
+template <bool trace_variant> RET_TYPE op_tlbia();
+template <bool trace_variant> RET_TYPE op_tlbsync();
+RET_TYPE op_unk(u32 inst);
@@ -25,6 +25,7 @@
 #include "log.h"
 #include "utility.h"
 #include "inst_utility.h"
+#include "ram_order.h"
 
 #include <arpa/inet.h>
 #include <string.h>
@@ -35,7 +36,8 @@
 #define IS_DIRECT(x)	!((x) & PPCMMU_HVA_IO_BIT)
 
 PPCMMU::PPCMMU() :
-	         enabled_i(false)
+	         code_cache(0)
+		,enabled_i(false)
 		,enabled_d(false)
 {
 	/* Zero le BATs */
@@ -48,6 +50,7 @@ PPCMMU::PPCMMU() :
 	}
 	iutlbInv();
 	dutlbInv();
+	setMode(true, false, false);
 
 	generation_count = 0;
 }
@@ -64,7 +67,7 @@ PPCMMU::fault_t	PPCMMU::loadInst32(VA addr, u32 *dest, bool priv)
 		return f;
 	}
 	if (likely(IS_DIRECT(pa))) {
-		*dest = BS32(*(u32 *)pa);
+		*dest = ram_read32((u8 *)pa);
 	} else {
 		*dest = BS32(bus->read32(pa));
 	}
@@ -85,7 +88,7 @@ PPCMMU::fault_t	PPCMMU::load32(VA addr, u32 *dest, bool priv)
 		return f;
 	}
 	if (likely(IS_DIRECT(pa))) {
-		*dest = BS32(*(u32 *)pa);
+		*dest = ram_read32((u8 *)pa);
 	} else {
 		*dest = BS32(bus->read32(pa));
 	}
@@ -119,7 +122,7 @@ PPCMMU::fault_t	PPCMMU::load16(VA addr, u16 *dest, bool priv)
 		return f;
 	}
 	if (likely(IS_DIRECT(pa))) {
-		*dest = BS16(*(u16 *)pa);
+		*dest = ram_read16((u8 *)pa);
 	} else {
 		*dest = BS16(bus->read16(pa));
 	}
@@ -152,7 +155,7 @@ PPCMMU::fault_t	PPCMMU::load8(VA addr, u8 *dest, bool priv)
 		return f;
 	}
 	if (likely(IS_DIRECT(pa))) {
-		*dest = *(u8 *)pa;
+		*dest = ram_read8((u8 *)pa);
 	} else {
 		*dest = bus->read8(pa);
 	}
@@ -173,7 +176,7 @@ PPCMMU::fault_t	PPCMMU::store32(VA addr, u32 val, bool priv)
 		return f;
 	}
 	if (likely(IS_DIRECT(pa))) {
-		*(u32 *)pa = BS32(val);
+		ram_write32((u8 *)pa, val);
 	} else {
 		bus->write32(pa, BS32(val));
 	}
@@ -206,7 +209,7 @@ PPCMMU::fault_t	PPCMMU::store16(VA addr, u16 val, bool priv)
 		return f;
 	}
 	if (likely(IS_DIRECT(pa))) {
-		*(u16 *)pa = BS16(val);
+		ram_write16((u8 *)pa, val);
 	} else {
 		bus->write16(pa, BS16(val));
 	}
@@ -239,7 +242,7 @@ PPCMMU::fault_t	PPCMMU::store8(VA addr, u8 val, bool priv)
 		return f;
 	}
 	if (likely(IS_DIRECT(pa))) {
-		*(u8 *)pa = val;
+		ram_write8((u8 *)pa, val);
 	} else {
 		bus->write8(pa, val);
 	}
@@ -402,6 +405,15 @@ void	PPCMMU::tlbie()
 	generation_count++;
 }
 
+/* Called by a code cache when it starts holding code from host_page; any
+ * existing D-side uTLB entries to that page must now report stores.  (New
+ * entries ask the code cache in utlbInsert().)
+ */
+void	PPCMMU::watchCodePage(u64 host_page)
+{
+	dutlbWatch(host_page);
+}
+
 static __attribute__((unused)) void dump_htab(Bus *bus, PA htab, u32 mask)
 {
 	int topbit = m_fls(mask);
@@ -620,12 +632,15 @@ bool	PPCMMU::translateEA(VA addr, bool InD, bool RnW, bool priv,
 	return false;
 }
 
-void	PPCMMU::setIRDR(bool ir, bool dr)
+void	PPCMMU::setMode(bool priv, bool ir, bool dr)
 {
 	enabled_d = dr;
 	enabled_i = ir;
+	cur_dutlb = select_utlb(false, priv);
+	cur_itr = ir ? PPCMMU_UTLB_TR : 0;
+	cur_dtr = dr ? PPCMMU_UTLB_TR : 0;
 #ifdef SUPER_VERBOSE
-	MMUTRACE("IR %d, DR %d\n", enabled_i, enabled_d);
+	MMUTRACE("PR %d, IR %d, DR %d\n", !priv, enabled_i, enabled_d);
 #endif
 }
 
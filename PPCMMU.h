@@ -28,6 +28,9 @@
 #include "Bus.h"
 #include "stats.h"
 #include "utility.h"
+#include "AbstractCodeCache.h"
+#include "portable_endian.h"
+#include "ram_order.h"
 
 #include <string.h>
 
@@ -35,6 +38,8 @@
 #define PPCMMU_SEGMENT_SIZE	MiB(256)
 #define PPCMMU_NR_BATS		4
 #define PPCMMU_NR_SEGS		16
+#define PPCMMU_PAGE_SIZE	4096
+#define PPCMMU_PAGE_OFFS	(PPCMMU_PAGE_SIZE-1)
 
 #define PPC_PTE_V		0x80000000
 #define PPC_PTE_H		0x00000040
@@ -67,10 +72,54 @@ public:
 	fault_t	store16(VA addr, u16 val, bool priv);
 	fault_t	store8(VA addr, u8 val, bool priv);
 
+	/* The same, by size: */
+	fault_t	load(VA addr, u32 *dest, bool priv)	{ return load32(addr, dest, priv); }
+	fault_t	load(VA addr, u16 *dest, bool priv)	{ return load16(addr, dest, priv); }
+	fault_t	load(VA addr, u8 *dest, bool priv)	{ return load8(addr, dest, priv); }
+	fault_t	store(VA addr, u32 val, bool priv)	{ return store32(addr, val, priv); }
+	fault_t	store(VA addr, u16 val, bool priv)	{ return store16(addr, val, priv); }
+	fault_t	store(VA addr, u8 val, bool priv)	{ return store8(addr, val, priv); }
+
+	/* Inline fast path for data accesses: an aligned access hitting the
+	 * uTLB on a RAM page is done directly.  Returns false if it wasn't,
+	 * in which case use the accessors above (which deal with misses, IO,
+	 * misalignment, faults and so on).  The access is made in the current
+	 * context (see setMode()).
+	 */
+	template <typename T>
+	bool	fastLoad(VA addr, T *dest)
+	{
+#if FLAT_MEM == 0 && DUMMY_MEM_ACCESS == 0
+		u8 *h = dutlbProbe(true, addr, sizeof(T));
+		if (likely(h)) {
+			ram_load(h, dest);
+			COUNT(CTR_MEM_FAST_R);
+			return true;
+		}
+#endif
+		return false;
+	}
+
+	template <typename T>
+	bool	fastStore(VA addr, T val)
+	{
+#if FLAT_MEM == 0 && DUMMY_MEM_ACCESS == 0
+		u8 *h = dutlbProbe(false, addr, sizeof(T));
+		if (likely(h)) {
+			ram_store(h, val);
+			COUNT(CTR_MEM_FAST_W);
+			return true;
+		}
+#endif
+		return false;
+	}
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Core translation
 	// Returns true on success, else false and returns fault.
-	inline bool translateAddr(VA addr, u64 *pa, bool InD, bool RnW, bool priv, fault_t *fault_out)
+	// len is the extent of a store (within the page), for code watching.
+	inline bool translateAddr(VA addr, u64 *pa, bool InD, bool RnW, bool priv, fault_t *fault_out,
+				  unsigned int len = 4)
 	{
 #if DUMMY_MEM_ACCESS == 0
 		mmuperms_t perms;
@@ -133,6 +182,13 @@ public:
                                 return false;
                         }
 		}
+
+		/* Stores to pages holding cached code get a heads-up to the
+		 * code cache.  (This is flagged in the uTLB entry so normal
+		 * stores don't pay for a lookup.)
+		 */
+		if (unlikely(perms.code) && !InD && !RnW)
+			code_cache->invalidateHostRange(*pa, len);
 #else
                 *pa = addr;
 #endif
@@ -163,16 +219,38 @@ public:
 	void	tlbia();
 	void	tlbie();
 
-	void	setIRDR(bool ir, bool dr);
+	/* The CPU's context changed (MSR[PR], MSR[IR], MSR[DR]): */
+	void	setMode(bool priv, bool ir, bool dr);
 
 	unsigned int	getGenCount()	{ return generation_count; }
 
+	/* Code caches register here, and call watchCodePage() when they start
+	 * caching from a page so that stores to it are reported back.
+	 */
+	void	setCodeCache(AbstractCodeCache *c)	{ code_cache = c; }
+	AbstractCodeCache *getCodeCache()		{ return code_cache; }
+	void	watchCodePage(u64 host_page);
+	/* Code invalidated explicitly (icbi etc.), rather than by a store: */
+	void	invalidateCode(u64 host_addr, unsigned int len)
+	{
+		if (code_cache)
+			code_cache->invalidateHostRange(host_addr, len);
+	}
+	void	invalidateAllCode()
+	{
+		if (code_cache)
+			code_cache->invalidateAll();
+	}
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Backend:  physical memory access via bus
 	void	setBus(Bus *b)		{ bus = b; }
+	/* The PA of a host address translateAddr() gave (not IO): */
+	bool	hostToPA(u64 host_addr, PA *pa)	{ return bus->get_direct_unmap((void *)host_addr, pa); }
 
 private:
 	Bus	*bus;
+	AbstractCodeCache *code_cache;
 	bool	enabled_i;
 	bool	enabled_d;
 
@@ -206,11 +284,12 @@ private:
 				unsigned int r : 1;
 				unsigned int w : 1;
                                 unsigned int clean : 1;
+                                unsigned int code : 1;	/* D-side only: page is watched by code_cache */
 			};
 			u32 field;
 		};
 	} mmuperms_t;
-#define PPCMMU_PERMS_ANY(x)     do { (x)->field = 0; (x)->r = 1; (x)->w = 1; (x)->clean = 0; \
+#define PPCMMU_PERMS_ANY(x)     do { (x)->field = 0; (x)->r = 1; (x)->w = 1; (x)->clean = 0; (x)->code = 0; \
         } while(0)
 
 
@@ -242,10 +321,42 @@ private:
 	 * void		iutlbInv();
 	 * void		dutlbInv();
 	 * void		dumpUTLBs();
+	 * void		dutlbWatch(u64 host_page);
+	 * u8	       *dutlbProbe(bool RnW, VA addr, unsigned int len);
 	 * bool    	utlbLookup(bool InD, bool priv, VA addr, PA *output_addr, mmuperms_t *perms);
 	 * void    	utlbInsert(bool InD, bool priv, VA addr, PA out_addr, u32 perms);
 	 */
 
+	/* The D-side uTLB for the current MSR[PR], and the TR bit entries
+	 * match given MSR[IR]/MSR[DR].  These only change in setMode(), so
+	 * accesses in the current context don't work them out each time.
+	 */
+	utlb_t	*cur_dutlb;
+	u32	cur_itr;
+	u32	cur_dtr;
+
+public:
+	/* For the JIT's inline dutlbProbe() (see blockgen.cc): */
+	static size_t	getCurDUTLBoffset()
+	{
+		return (uint8_t *)&((PPCMMU *)0)->cur_dutlb - (uint8_t *)((PPCMMU *)0);
+	}
+
+	static size_t	getCurDTRoffset()
+	{
+		return (uint8_t *)&((PPCMMU *)0)->cur_dtr - (uint8_t *)((PPCMMU *)0);
+	}
+
+	static size_t	getUTLBEAoffset()	{ return (uint8_t *)&((utlb_t *)0)->ea - (uint8_t *)((utlb_t *)0); }
+	static size_t	getUTLBPAoffset()	{ return (uint8_t *)&((utlb_t *)0)->pa - (uint8_t *)((utlb_t *)0); }
+	static size_t	getUTLBEntrySize()	{ return sizeof(utlb_t); }
+	static u32	getUTLBIndexMask()	{ return PPCMMU_UTLB_ENTRIES - 1; }
+	static u32	getUTLBValid()		{ return PPCMMU_UTLB_VALID; }
+	static u32	getDUTLBProbeNeed(bool RnW)	{ return dutlbProbeNeed(RnW); }
+	static u64	getDUTLBProbeReject(bool RnW)	{ return dutlbProbeReject(RnW); }
+
+private:
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Internal data:
 	bat_t	ibat[PPCMMU_NR_BATS];
@@ -82,8 +82,7 @@ bool    utlbLookup(bool InD, bool priv, VA addr, u64 *output_addr, PPCMMU::mmupe
 	 * FIXME: Make this direct-mapped, i.e. index by addr[m:n] and
 	 * just check one entry for a hit.
 	 */
-	u32 find_ea = (addr & ~0xfff) | PPCMMU_UTLB_VALID |
-		((InD ? enabled_i : enabled_d) ? PPCMMU_UTLB_TR : 0);
+	u32 find_ea = (addr & ~0xfff) | PPCMMU_UTLB_VALID | (InD ? cur_itr : cur_dtr);
 	for (int i = 0; i < PPCMMU_UTLB_ENTRIES; i++) {
 		utlb_t *t = &tlb[i];
 		if (t->getEA() == find_ea) {
@@ -112,10 +111,6 @@ void    utlbInsert(bool InD, bool priv, VA addr, PA out_addr, u32 perms)
         /* FIXME: More random/PRN replacement strategy?
          */
         utlb_t *tlb = select_utlb(InD, priv);
-        if (InD) {
-		tlb[utlb_idx].set(addr, enabled_i ? PPCMMU_UTLB_TR : 0, pa, perms);
-	} else {
-		tlb[utlb_idx].set(addr, enabled_d ? PPCMMU_UTLB_TR : 0, pa, perms);
-	}
+	tlb[utlb_idx].set(addr, InD ? cur_itr : cur_dtr, pa, perms);
         utlb_idx = (utlb_idx + 1) & (PPCMMU_UTLB_ENTRIES-1);
 }
@@ -89,8 +89,7 @@ bool    utlbLookup(bool InD, bool priv, VA addr, u64 *output_addr, PPCMMU::mmupe
 	/* The address to match also has a bit to say it's valid, plus a bit to
 	 * say whether it comes from IR/DR=1 context.
 	 */
-	u32 find_ea = (addr & ~0xfff) | PPCMMU_UTLB_VALID |
-		((InD ? enabled_i : enabled_d) ? PPCMMU_UTLB_TR : 0);
+	u32 find_ea = (addr & ~0xfff) | PPCMMU_UTLB_VALID | (InD ? cur_itr : cur_dtr);
 
 	if (t->getEA() == find_ea) {
 		*output_addr = t->getPA() | (addr & 0xfff);
@@ -103,6 +102,65 @@ bool    utlbLookup(bool InD, bool priv, VA addr, u64 *output_addr, PPCMMU::mmupe
 	return false;
 }
 
+/* Probe for the inline data access fast path:  returns a host pointer for an
+ * aligned access of len bytes, in the current context, if it hits an entry
+ * for RAM that permits it outright, otherwise 0 (and the caller takes the
+ * translateAddr() route).  Stores to watched code pages, or that need C set,
+ * don't qualify.
+ */
+static inline u32	dutlbProbeNeed(bool RnW)
+{
+	PPCMMU::mmuperms_t need;
+
+	need.field = 0;
+	if (RnW)
+		need.r = 1;
+	else
+		need.w = 1;
+	return need.field;
+}
+
+static inline u64	dutlbProbeReject(bool RnW)
+{
+	PPCMMU::mmuperms_t reject;
+
+	reject.field = 0;
+	if (!RnW) {
+#ifdef UPDATE_RC
+		reject.clean = 1;
+#endif
+		reject.code = 1;
+	}
+	return PPCMMU_HVA_IO_BIT | reject.field;
+}
+
+inline u8	*dutlbProbe(bool RnW, VA addr, unsigned int len)
+{
+	utlb_t *t = &cur_dutlb[PPCMMU_ADDR_TO_IDX(addr)];
+	u32 find_ea = (addr & ~0xfff) | PPCMMU_UTLB_VALID | cur_dtr;
+
+	if (t->ea != find_ea || (addr & (len - 1)) ||
+	    (t->pa & dutlbProbeReject(RnW)) || !(t->pa & dutlbProbeNeed(RnW)))
+		return 0;
+	COUNT(CTR_MEM_UTLB_HIT);
+	return (u8 *)(t->getPA() | (addr & 0xfff));
+}
+
+/* Flag existing D-side entries mapping the given host page as watched: */
+void	dutlbWatch(u64 host_page)
+{
+	PPCMMU::mmuperms_t p;
+	p.field = 0;
+	p.code = 1;
+
+	for (int i = 0; i < PPCMMU_UTLB_ENTRIES; i++) {
+		if (pd_utlb[i].isValid() && pd_utlb[i].getPA() == host_page)
+			pd_utlb[i].pa |= p.field;
+		if (ud_utlb[i].isValid() && ud_utlb[i].getPA() == host_page)
+			ud_utlb[i].pa |= p.field;
+	}
+}
+
 /* This takes a PA (PPC) address to map to, and possibly converts it into a host
  * VA for a direct mmap access.
  */
@@ -124,8 +182,11 @@ void    utlbInsert(bool InD, bool priv, VA addr, PA out_addr, u32 perms)
 		 */
 		pa = out_addr | PPCMMU_HVA_IO_BIT;
 	}
-	if (InD)
-		t->set(addr, enabled_i ? PPCMMU_UTLB_TR : 0, pa, perms);
-	else
-		t->set(addr, enabled_d ? PPCMMU_UTLB_TR : 0, pa, perms);
+	/* Stores to a page of code get reported to the code cache: */
+	PPCMMU::mmuperms_t p;
+	p.field = perms;
+	p.code = !InD && code_cache && !(pa & PPCMMU_HVA_IO_BIT) &&
+		code_cache->isCodePage(pa & ~0xfff);
+	perms = p.field;
+	t->set(addr, InD ? cur_itr : cur_dtr, pa, perms);
 }
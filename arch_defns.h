@@ -132,6 +132,46 @@
 #define MSR_FP		B(63-50)
 #define MSR_PR		B(63-49)
 #define MSR_EE		B(63-48)
+#define MSR_POW		B(63-45)
+#define MSR_FE0		B(63-52)
+#define MSR_FE1		B(63-55)
+
+// FPSCR
+#define FPSCR_FX	B(31-0)
+#define FPSCR_FEX	B(31-1)
+#define FPSCR_VX	B(31-2)
+#define FPSCR_OX	B(31-3)
+#define FPSCR_UX	B(31-4)
+#define FPSCR_ZX	B(31-5)
+#define FPSCR_XX	B(31-6)
+#define FPSCR_VXSNAN	B(31-7)
+#define FPSCR_VXISI	B(31-8)
+#define FPSCR_VXIDI	B(31-9)
+#define FPSCR_VXZDZ	B(31-10)
+#define FPSCR_VXIMZ	B(31-11)
+#define FPSCR_VXVC	B(31-12)
+#define FPSCR_FR	B(31-13)
+#define FPSCR_FI	B(31-14)
+#define FPSCR_FPRF_SHIFT	12		/* C,FL,FG,FE,FU */
+#define FPSCR_FPRF	(0x1f << FPSCR_FPRF_SHIFT)
+#define FPSCR_FPCC_SHIFT	12		/* FL,FG,FE,FU */
+#define FPSCR_FPCC	(0xf << FPSCR_FPCC_SHIFT)
+#define FPSCR_VXSOFT	B(31-21)
+#define FPSCR_VXSQRT	B(31-22)
+#define FPSCR_VXCVI	B(31-23)
+#define FPSCR_VE	B(31-24)
+#define FPSCR_OE	B(31-25)
+#define FPSCR_UE	B(31-26)
+#define FPSCR_ZE	B(31-27)
+#define FPSCR_XE	B(31-28)
+#define FPSCR_NI	B(31-29)
+#define FPSCR_RN	3
+/* The individual invalid-operation causes, summarised by VX: */
+#define FPSCR_VX_ALL	(FPSCR_VXSNAN | FPSCR_VXISI | FPSCR_VXIDI | FPSCR_VXZDZ | \
+			 FPSCR_VXIMZ | FPSCR_VXVC | FPSCR_VXSOFT | FPSCR_VXSQRT | \
+			 FPSCR_VXCVI)
+/* Sticky exception bits, which set FX when they go from 0 to 1: */
+#define FPSCR_EXC_ALL	(FPSCR_OX | FPSCR_UX | FPSCR_ZX | FPSCR_XX | FPSCR_VX_ALL)
 
 // CPU-specific.  These should move away, in time.
 typedef u32		VA;
@@ -0,0 +1,524 @@
+/* Copyright 2016-2022 Matt Evans
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <link.h>
+
+#include "log.h"
+#include "blockcache.h"
+#include "op_addrs.h"
+
+#if ENABLE_JIT_PERSIST
+/* Persistent block cache:
+ *
+ * Blocks generated in one run are kept in a file (-C), so later runs (e.g.
+ * booting the same kernel again) can load them instead of generating them
+ * again.  A block's code only depends on where it is in two ways:  calls to
+ * handlers are rel32, and exits return IDs made from the block's place in
+ * the buffer (see blockExitID()).  These are noted as relocations whilst
+ * it's generated, and redone when it's loaded.  The rest (offsets into the
+ * CPU state, exit target VAs, the tier check's rip-relative count) stays
+ * the same wherever the block goes, as long as it's the same build of the
+ * simulator:  the file's tagged with the executable's build ID, and started
+ * afresh if that doesn't match.
+ *
+ * Records are found by the block's guest PA (host addresses of RAM differ
+ * from run to run) and MSR, as blocks are.  Each holds the VA the block was
+ * generated at (which its exits compare against), the guest code it spans,
+ * and a hash of that code.  Before a record's used, the code's checked
+ * against guest memory, so code changed since (or another program at the
+ * same PA) just doesn't match.  IO blocks, and those calling the tracing
+ * variants of the handlers, aren't kept.
+ *
+ * The file's mmap'd and indexed at startup; each record's checksum is only
+ * checked when it's first wanted.  New blocks are appended, each with one
+ * O_APPEND write(), so several runs can share the file (each seeing the
+ * records there when it started, plus its own).  Records are kept in memory
+ * too, so a block that's evicted and wanted again is loaded rather than
+ * generated.
+ */
+#define BC_MAGIC		"MRISSJIT"
+#define BC_VERSION		1
+#define BC_REC_MAGIC		0x6b6c4221
+#define BC_HTAB_BITS		16
+#define BC_MAX_RELOCS		4096
+#define BC_MAX_FILE		(512ULL << 20)
+
+#if ENABLE_JIT_CHAIN
+#define BC_MAX_EXITS		BLOCK_EXITS
+#else
+#define BC_MAX_EXITS		0
+#endif
+
+typedef struct {
+	char magic[8];
+	u32 version;
+	u32 id_len;
+	u8 id[48];			/* The executable's build ID */
+} bc_header_t;
+
+typedef struct {
+	u32 magic;
+	u32 size;			/* Whole record, a multiple of 8 */
+	u64 check;			/* Hash of everything after this header */
+	u64 guest_hash;			/* Hash of the guest code */
+	PA pa;				/* Guest PA of the PC */
+	VA pc;
+	u32 msr;
+	u32 tier;
+	u32 codelen;
+	u32 guest_ofs;
+	u32 guest_len;
+	u32 entry_ofs;
+	u32 nr_exits;
+	u32 nr_relocs;
+	/* Then nr_exits bc_exit_t, nr_relocs bc_reloc_t, guest_len bytes of
+	 * guest code, and codelen bytes of host code.
+	 */
+} bc_rec_t;
+
+typedef struct {
+	VA target;
+	u32 jmp_ofs;
+} bc_exit_t;
+
+typedef struct {
+	u32 ofs;			/* From BLOCK_CODEPTR */
+	s32 exit;			/* Exit whose ID goes at ofs, or -1 for a callq */
+	s64 dest;			/* The callq's target, relative to op_unk */
+} bc_reloc_t;
+
+enum { BC_UNCHECKED = 0, BC_OK, BC_BAD };
+
+typedef struct _bc_entry {
+	struct _bc_entry *next;
+	const bc_rec_t *rec;
+	int state;
+} bc_entry_t;
+
+static PPCMMU *bc_mmu = 0;
+static int bc_fd = -1;
+static u64 bc_file_size = 0;
+static bc_entry_t **bc_htab = 0;
+static unsigned int bc_nr_recs = 0;
+
+/* Relocations of the block being generated: */
+static struct {
+	u8 *at;
+	s32 exit;
+	u64 dest;
+} bc_relocs[BC_MAX_RELOCS];
+static unsigned int bc_nr_relocs = 0;
+
+static inline const bc_exit_t *recExits(const bc_rec_t *r)
+{
+	return (const bc_exit_t *)(r + 1);
+}
+
+static inline const bc_reloc_t *recRelocs(const bc_rec_t *r)
+{
+	return (const bc_reloc_t *)(recExits(r) + r->nr_exits);
+}
+
+static inline const u8 *recGuest(const bc_rec_t *r)
+{
+	return (const u8 *)(recRelocs(r) + r->nr_relocs);
+}
+
+static inline const u8 *recCode(const bc_rec_t *r)
+{
+	return recGuest(r) + r->guest_len;
+}
+
+static u64	recSize(u64 nr_exits, u64 nr_relocs, u64 guest_len, u64 codelen)
+{
+	return ALIGN_TO(sizeof(bc_rec_t) + nr_exits * sizeof(bc_exit_t) +
+			nr_relocs * sizeof(bc_reloc_t) + guest_len + codelen, 8);
+}
+
+static u64	bc_hash(const u8 *p, size_t len)
+{
+	u64 h = 0xcbf29ce484222325ULL ^ len;
+	size_t i = 0;
+
+	for (; i + 8 <= len; i += 8) {
+		u64 w;
+		memcpy(&w, p + i, 8);
+		h = (h ^ w) * 0x100000001b3ULL;
+		h ^= h >> 29;
+	}
+	for (; i < len; i++)
+		h = (h ^ p[i]) * 0x100000001b3ULL;
+	return h ^ (h >> 32);
+}
+
+static inline unsigned int bc_idx(PA pa, u32 msr)
+{
+	return (((u64)pa ^ ((u64)msr << 32)) * 0x9e3779b97f4a7c15ULL) >> (64 - BC_HTAB_BITS);
+}
+
+static void	insertRecord(const bc_rec_t *r, int state)
+{
+	bc_entry_t *e = (bc_entry_t *)malloc(sizeof(bc_entry_t));
+	unsigned int i = bc_idx(r->pa, r->msr);
+
+	ASSERT(e);
+	e->rec = r;
+	e->state = state;
+	e->next = bc_htab[i];
+	bc_htab[i] = e;
+	bc_nr_recs++;
+	COUNT_SET(CTR_JIT_PERSIST_RECORDS, bc_nr_recs);
+}
+
+/* A record from the file is checked (once) before it's first used: */
+static bool	checkRecord(bc_entry_t *e)
+{
+	const bc_rec_t *r = e->rec;
+
+	if (e->state == BC_UNCHECKED) {
+		bool ok = r->check == bc_hash((const u8 *)(r + 1), r->size - sizeof(bc_rec_t)) &&
+			r->entry_ofs < r->codelen;
+		for (unsigned int i = 0; ok && i < r->nr_exits; i++)
+			ok = recExits(r)[i].jmp_ofs + 5 <= r->codelen;
+		for (unsigned int i = 0; ok && i < r->nr_relocs; i++) {
+			const bc_reloc_t *rl = &recRelocs(r)[i];
+			ok = rl->ofs + 5 <= r->codelen && rl->exit < (s32)r->nr_exits;
+		}
+		e->state = ok ? BC_OK : BC_BAD;
+		if (!ok)
+			COUNT(CTR_JIT_PERSIST_BAD);
+	}
+	return e->state == BC_OK;
+}
+
+/******************************************************************************/
+/* Noting relocations, as a block's generated (see blockgen.cc): */
+
+void	blockCacheStart(void)
+{
+	bc_nr_relocs = 0;
+}
+
+/* A callq at here, to dest: */
+void	blockCacheCall(u8 *here, u64 dest)
+{
+	if (bc_nr_relocs < BC_MAX_RELOCS) {
+		bc_relocs[bc_nr_relocs].at = here;
+		bc_relocs[bc_nr_relocs].exit = -1;
+		bc_relocs[bc_nr_relocs].dest = dest;
+	}
+	bc_nr_relocs++;
+}
+
+/* The imm32 at imm is exit's ID: */
+void	blockCacheExitID(u8 *imm, unsigned int exit)
+{
+	if (bc_nr_relocs < BC_MAX_RELOCS) {
+		bc_relocs[bc_nr_relocs].at = imm;
+		bc_relocs[bc_nr_relocs].exit = exit;
+		bc_relocs[bc_nr_relocs].dest = 0;
+	}
+	bc_nr_relocs++;
+}
+
+/* b has just been generated: */
+void	blockCacheSave(block_t *b)
+{
+	PA pa;
+
+	if (!bc_htab || bc_nr_relocs > BC_MAX_RELOCS || (b->pc_pa & PPCMMU_HVA_IO_BIT) ||
+	    !bc_mmu->hostToPA(b->pc_pa, &pa))
+		return;
+
+	const u8 *guest = (const u8 *)(b->pc_pa & ~0xfffULL) + b->guest_ofs;
+	u64 guest_hash = bc_hash(guest, b->guest_len);
+
+	/* Already got (e.g. a tier that wasn't wanted when it was looked up): */
+	for (bc_entry_t *e = bc_htab[bc_idx(pa, b->msr)]; e; e = e->next) {
+		const bc_rec_t *r = e->rec;
+
+		if (r->pa == pa && r->msr == b->msr && r->pc == b->pc && r->tier == b->tier &&
+		    r->guest_hash == guest_hash && e->state != BC_BAD)
+			return;
+	}
+
+	unsigned int nr_exits = 0, entry_ofs = 0;
+#if ENABLE_JIT_CHAIN
+	nr_exits = b->nr_exits;
+	entry_ofs = b->entry_ofs;
+#endif
+	u64 size = recSize(nr_exits, bc_nr_relocs, b->guest_len, b->codelen);
+	bc_rec_t *r = (bc_rec_t *)calloc(1, size);
+	ASSERT(r);
+
+	r->magic = BC_REC_MAGIC;
+	r->size = size;
+	r->guest_hash = guest_hash;
+	r->pa = pa;
+	r->pc = b->pc;
+	r->msr = b->msr;
+	r->tier = b->tier;
+	r->codelen = b->codelen;
+	r->guest_ofs = b->guest_ofs;
+	r->guest_len = b->guest_len;
+	r->entry_ofs = entry_ofs;
+	r->nr_exits = nr_exits;
+	r->nr_relocs = bc_nr_relocs;
+
+#if ENABLE_JIT_CHAIN
+	bc_exit_t *x = (bc_exit_t *)recExits(r);
+	for (unsigned int i = 0; i < nr_exits; i++) {
+		x[i].target = b->exit[i].target;
+		x[i].jmp_ofs = b->exit[i].jmp_ofs;
+	}
+#endif
+	bc_reloc_t *rl = (bc_reloc_t *)recRelocs(r);
+	for (unsigned int i = 0; i < bc_nr_relocs; i++) {
+		rl[i].ofs = bc_relocs[i].at - BLOCK_CODEPTR(b);
+		rl[i].exit = bc_relocs[i].exit;
+		if (rl[i].exit < 0)
+			rl[i].dest = bc_relocs[i].dest - get_op_unk();
+	}
+	memcpy((u8 *)recGuest(r), guest, b->guest_len);
+	memcpy((u8 *)recCode(r), BLOCK_CODEPTR(b), b->codelen);
+	r->check = bc_hash((const u8 *)(r + 1), size - sizeof(bc_rec_t));
+
+	if (bc_fd >= 0 && bc_file_size + size <= BC_MAX_FILE) {
+		if (write(bc_fd, r, size) != (ssize_t)size) {
+			WARN("Can't write to JIT cache file, no longer adding to it\n");
+			close(bc_fd);
+			bc_fd = -1;
+		} else {
+			bc_file_size += size;
+			COUNT(CTR_JIT_PERSIST_SAVE);
+		}
+	}
+	insertRecord(r, BC_OK);
+}
+
+/******************************************************************************/
+/* Returns a block made from a record for the PC, at min_tier or above (the
+ * highest there is), or 0 if there's none that's still valid:
+ */
+block_t *blockCacheLoad(PPCMMU *mmu, PPCCPUState *pcs, unsigned int min_tier)
+{
+	VA pc = pcs->getPC();
+	u32 msr = pcs->getMSR();
+	PPCMMU::fault_t fault;
+	u64 pc_pa = 0;
+	PA pa = 0;
+
+	if (!bc_htab || !mmu->translateAddr(pc, &pc_pa, true, true, pcs->isPrivileged(), &fault) ||
+	    (pc_pa & PPCMMU_HVA_IO_BIT) || !mmu->hostToPA(pc_pa, &pa))
+		return 0;
+
+	const u8 *page = (const u8 *)(pc_pa & ~0xfffULL);
+	const bc_rec_t *r = 0;
+
+	for (bc_entry_t *e = bc_htab[bc_idx(pa, msr)]; e; e = e->next) {
+		const bc_rec_t *c = e->rec;
+
+		if (c->pa != pa || c->msr != msr || c->pc != pc || c->tier < min_tier ||
+		    (r && r->tier >= c->tier) || !checkRecord(e))
+			continue;
+		if (bc_hash(page + c->guest_ofs, c->guest_len) != c->guest_hash ||
+		    memcmp(page + c->guest_ofs, recGuest(c), c->guest_len)) {
+			COUNT(CTR_JIT_PERSIST_STALE);
+			continue;
+		}
+		r = c;
+	}
+	if (!r)
+		return 0;
+
+	block_t *b;
+	unsigned int avail;
+	for (;;) {
+		b = allocBlock(pc, pc_pa, msr, &avail);
+		if (r->codelen <= avail)
+			break;
+		abandonBlock(b);
+	}
+	b->tier = r->tier;
+
+	u8 *code = BLOCK_CODEPTR(b);
+	memcpy(code, recCode(r), r->codelen);
+#if ENABLE_JIT_CHAIN
+	b->entry_ofs = r->entry_ofs;
+	b->nr_exits = r->nr_exits;
+	for (unsigned int i = 0; i < r->nr_exits; i++) {
+		b->exit[i].target = recExits(r)[i].target;
+		b->exit[i].jmp_ofs = recExits(r)[i].jmp_ofs;
+		b->exit[i].to = 0;
+	}
+#endif
+	for (unsigned int i = 0; i < r->nr_relocs; i++) {
+		const bc_reloc_t *rl = &recRelocs(r)[i];
+
+		if (rl->exit < 0)
+			*(s32 *)(code + rl->ofs + 1) = blockCallRel(code + rl->ofs, get_op_unk() + rl->dest);
+#if ENABLE_JIT_CHAIN
+		else
+			*(u32 *)(code + rl->ofs) = blockExitID(b, rl->exit);
+#endif
+	}
+	amendBlockSize(b, r->codelen, r->guest_ofs, r->guest_len);
+	JITTRACE("Loaded block %p (PC %08x, tier %d) from the cache\n", b, pc, b->tier);
+	COUNT(CTR_JIT_PERSIST_HIT);
+	return b;
+}
+
+/******************************************************************************/
+/* The executable's GNU build ID, which is the first object: */
+static int	findBuildID(struct dl_phdr_info *info, size_t size, void *data)
+{
+	bc_header_t *h = (bc_header_t *)data;
+
+	for (unsigned int i = 0; i < info->dlpi_phnum; i++) {
+		const ElfW(Phdr) *ph = &info->dlpi_phdr[i];
+
+		if (ph->p_type != PT_NOTE)
+			continue;
+		const u8 *p = (const u8 *)(info->dlpi_addr + ph->p_vaddr);
+		const u8 *end = p + ph->p_memsz;
+
+		while (p + sizeof(ElfW(Nhdr)) <= end) {
+			const ElfW(Nhdr) *n = (const ElfW(Nhdr) *)p;
+			const u8 *name = p + sizeof(ElfW(Nhdr));
+			const u8 *desc = name + ALIGN_TO(n->n_namesz, 4);
+
+			if (n->n_type == NT_GNU_BUILD_ID && n->n_namesz == 4 &&
+			    !memcmp(name, "GNU", 4) && n->n_descsz <= sizeof(h->id)) {
+				memcpy(h->id, desc, n->n_descsz);
+				h->id_len = n->n_descsz;
+				return 1;
+			}
+			p = desc + ALIGN_TO(n->n_descsz, 4);
+		}
+	}
+	return 1;
+}
+
+/* A new file, with a header then len bytes of records, replaces whatever's
+ * at path (which other runs might still be using):
+ */
+static int	newFile(const char *path, const bc_header_t *h, const u8 *recs, u64 len)
+{
+	char tmp[1024];
+	snprintf(tmp, sizeof(tmp), "%s.%d", path, (int)getpid());
+
+	int fd = open(tmp, O_RDWR | O_APPEND | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return -1;
+	if (write(fd, h, sizeof(*h)) != sizeof(*h) || (len && write(fd, recs, len) != (ssize_t)len) ||
+	    rename(tmp, path) < 0) {
+		close(fd);
+		unlink(tmp);
+		return -1;
+	}
+	return fd;
+}
+
+/* Indexes the records in the file (as it was when opened), up to the first
+ * that's not whole; returns where that is:
+ */
+static u64	indexFile(const u8 *map, u64 size)
+{
+	u64 ofs = sizeof(bc_header_t);
+
+	while (ofs + sizeof(bc_rec_t) <= size) {
+		const bc_rec_t *r = (const bc_rec_t *)(map + ofs);
+
+		if (r->magic != BC_REC_MAGIC || r->size > size - ofs || r->tier >= NR_TIERS ||
+		    r->nr_exits > BC_MAX_EXITS || r->nr_relocs > BC_MAX_RELOCS ||
+		    r->guest_ofs + (u64)r->guest_len > 0x1000 ||
+		    r->size != recSize(r->nr_exits, r->nr_relocs, r->guest_len, r->codelen))
+			break;
+		insertRecord(r, BC_UNCHECKED);
+		ofs += r->size;
+	}
+	return ofs;
+}
+
+void	initBlockCache(PPCMMU *mmu, const char *path)
+{
+	bc_header_t h;
+	bc_header_t fh;
+	struct stat sb;
+
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, BC_MAGIC, sizeof(h.magic));
+	h.version = BC_VERSION;
+	dl_iterate_phdr(findBuildID, &h);
+	if (!h.id_len) {
+		WARN("Executable has no build ID, so not using JIT cache file '%s'\n", path);
+		return;
+	}
+
+	bc_mmu = mmu;
+	bc_htab = (bc_entry_t **)calloc(1 << BC_HTAB_BITS, sizeof(bc_entry_t *));
+	ASSERT(bc_htab);
+
+	/* One from another build is started again: */
+	bc_fd = open(path, O_RDWR | O_APPEND);
+	if (bc_fd >= 0 && (fstat(bc_fd, &sb) < 0 ||
+			   pread(bc_fd, &fh, sizeof(fh), 0) != sizeof(fh) ||
+			   memcmp(&fh, &h, sizeof(h)))) {
+		close(bc_fd);
+		bc_fd = -1;
+	}
+	if (bc_fd < 0) {
+		bc_fd = newFile(path, &h, 0, 0);
+		bc_file_size = sizeof(h);
+	} else {
+		bc_file_size = sb.st_size;
+		u8 *map = (u8 *)mmap(0, sb.st_size, PROT_READ, MAP_PRIVATE, bc_fd, 0);
+		if (map == MAP_FAILED) {
+			WARN("Can't map JIT cache file '%s'\n", path);
+		} else {
+			u64 end = indexFile(map, sb.st_size);
+
+			/* Anything appended after a torn record would never be
+			 * seen, so the good ones are copied to a new file:
+			 */
+			if (end != (u64)sb.st_size) {
+				WARN("Dropping %lld bytes of bad records from JIT cache file '%s'\n",
+				     (long long)(sb.st_size - end), path);
+				close(bc_fd);
+				bc_fd = newFile(path, &h, map + sizeof(h), end - sizeof(h));
+				bc_file_size = end;
+			}
+		}
+	}
+	if (bc_fd < 0)
+		WARN("Can't write JIT cache file '%s'\n", path);
+	LOG("JIT cache file '%s':  %d blocks\n", path, bc_nr_recs);
+}
+#endif
@@ -24,8 +24,10 @@
 #include <stdio.h>
 #include "log.h"
 #include "blockgen.h"
+#include "blockcache.h"
 #include "op_addrs.h"
 #include "PPCInstructionFields.h"
+#include "ram_order.h"
 
 
 /* FIXME: Fugly globals -- pass this round in a generation context struct/object. */
@@ -68,7 +70,10 @@ static bool oom_abort = false;
 static int get_rel_addr(void *here, u64 dest)
 {
 	/* Rel address for a callq instruction -- note relative to the end of the 5-byte instruction. */
-	return (intptr_t)dest - (intptr_t)here - 5;
+#if ENABLE_JIT_PERSIST
+	blockCacheCall((u8 *)here, dest);
+#endif
+	return blockCallRel((u8 *)here, dest);
 }
 
 static void generate_call(u8 **codeptr, unsigned int *codelen, u64 addr)
@@ -306,6 +311,11 @@ static void generate_call_u32_int_int(u8 **codeptr, unsigned int *codelen, u64 a
 	generate_call_int_int_int(codeptr, codelen, addr, arg1, arg2, arg3);
 }
 
+static void generate_call_s16_int(u8 **codeptr, unsigned int *codelen, u64 addr, s16 arg1, int arg2)
+{
+	generate_call_int_int(codeptr, codelen, addr, (u16)arg1, arg2);
+}
+
 static void generate_call_u8(u8 **codeptr, unsigned int *codelen, u64 addr, u8 arg1)
 {
 	generate_call_int(codeptr, codelen, addr, arg1);
@@ -324,6 +334,12 @@ static void generate_call_u32(u8 **codeptr, unsigned int *codelen, u64 addr, u32
  * used for a simple self-referential block optimisation (or other direct-branch
  * function).
  */
+/* Blocks call either the tracing or non-tracing variant of the ops (see
+ * log.h), chosen by createBlock()'s caller:
+ */
+static bool gen_tracing = false;
+#define OP_ADDR(op)	(gen_tracing ? get_##op##_t() : get_##op##_nt())
+
 static unsigned int decodeInstrGenerateCall(u32 inst, u8 **codeptr, unsigned int *codelen)
 {
 	u32 opcode = getOpcode(inst);
@@ -337,31 +353,1056 @@ static unsigned int decodeInstrGenerateCall(u32 inst, u8 **codeptr, unsigned int
 	return 2;
 }
 
-static void 	plantBlockLoopCheck(VA block_pc, u8 *codestart, u8 **codeptr, unsigned int *codelen)
+/* Before a call to a handler, note how many of the block's instructions that
+ * makes (see PPCCPUState::setBlockTicks()):
+ *
+ *	movl	$n, blk_ticks(%r12)
+ */
+static void	noteBlockTicks(u8 **codeptr, unsigned int *codelen)
 {
 	unsigned int l = 0;
-	/* Read PC from PPCCPUState (in PPCInterpreter) and compare to provided PC: */
-	INST8 (*codeptr, l, 0x48);	/* movq   offsetof(PPCInterpreter, cpus)(%rbx), %rdi */
-	INST8 (*codeptr, l, 0x8b);
-	INST8 (*codeptr, l, 0xbb);
-	INST32(*codeptr, l, PPCInterpreter::getCPUSoffset());
 
-	INST8 (*codeptr, l, 0x8b);	/* movl   offsetof(PPCCPUState, pc)(%rdi), %edi */
-	INST8 (*codeptr, l, 0xbf);
-	INST32(*codeptr, l, PPCCPUState::getPCoffset());
+	INST8 (*codeptr, l, 0x41);	/* movl    $n, blk_ticks(%r12) */
+	INST8 (*codeptr, l, 0xc7);
+	INST8 (*codeptr, l, 0x84);
+	INST8 (*codeptr, l, 0x24);
+	INST32(*codeptr, l, PPCCPUState::getBlockTicksOffset());
+	INST32(*codeptr, l, cur_blk_nr_instrs + 1);
+
+	CODE_FINAL(*codelen, l, *codeptr);
+}
+
+#if ENABLE_JIT_NATIVE
+/* Native code for simple integer instructions:  rather than calling the
+ * handler, these read and write PPCCPUState's GPRs/CR/XER directly, via
+ * %r12 (which startBlock() points at it), with %eax, %ecx, %edx and %esi as
+ * scratch.  None of them can fault or branch, so they don't bother updating
+ * the PC as they go; native_pc_lag counts how far behind it is, and
+ * flushPC() catches it up before anything that might look at it (a call to
+ * a handler, or the end of the block).
+ *
+ * Only the non-tracing variant does this, as these don't trace.
+ */
+#define NATIVE_MAX_BYTES	256
+
+/* x86 registers: */
+enum { H_EAX = 0, H_ECX = 1, H_EDX = 2, H_ESI = 6 };
+/* Condition codes, for setcc/cmovcc: */
+enum { CC_B = 0x2, CC_E = 0x4, CC_NE = 0x5, CC_L = 0xc };
+/* ALU ops, as the /digit of 0x81 (op r/m32, imm32): */
+enum { ALU_ADD = 0, ALU_OR = 1, ALU_AND = 4, ALU_SUB = 5, ALU_XOR = 6, ALU_CMP = 7 };
+/* Shifts, as the /digit of 0xc1 (imm8) or 0xd3 (%cl): */
+enum { SH_ROL = 0, SH_SHL = 4, SH_SHR = 5, SH_SAR = 7 };
+
+static unsigned int native_pc_lag = 0;
+
+#define GPR_OFF(r)	((u32)PPCCPUState::getGPRoffset(r))
+
+static void	n_load(u8 *c, unsigned int *l, int reg, u32 off)
+{
+	INST8 (c, *l, 0x41);	/* movl    off(%r12), %reg */
+	INST8 (c, *l, 0x8b);
+	INST8 (c, *l, 0x84 | (reg << 3));
+	INST8 (c, *l, 0x24);
+	INST32(c, *l, off);
+}
+
+static void	n_store(u8 *c, unsigned int *l, int reg, u32 off)
+{
+	INST8 (c, *l, 0x41);	/* movl    %reg, off(%r12) */
+	INST8 (c, *l, 0x89);
+	INST8 (c, *l, 0x84 | (reg << 3));
+	INST8 (c, *l, 0x24);
+	INST32(c, *l, off);
+}
+
+#if ENABLE_LAZY_FLAGS
+static void	n_store8_imm(u8 *c, unsigned int *l, u32 off, u8 val)
+{
+	INST8 (c, *l, 0x41);	/* movb    $val, off(%r12) */
+	INST8 (c, *l, 0xc6);
+	INST8 (c, *l, 0x84);
+	INST8 (c, *l, 0x24);
+	INST32(c, *l, off);
+	INST8 (c, *l, val);
+}
+#endif
+
+static void	n_mov_imm(u8 *c, unsigned int *l, int reg, u32 val)
+{
+	INST8 (c, *l, 0xb8 | reg);	/* movl    $val, %reg */
+	INST32(c, *l, val);
+}
+
+static void	n_mov(u8 *c, unsigned int *l, int dst, int src)
+{
+	INST8 (c, *l, 0x89);	/* movl    %src, %dst */
+	INST8 (c, *l, 0xc0 | (src << 3) | dst);
+}
+
+static void	n_alu(u8 *c, unsigned int *l, int op, int dst, int src)
+{
+	INST8 (c, *l, (op << 3) | 1);	/* <op>l   %src, %dst */
+	INST8 (c, *l, 0xc0 | (src << 3) | dst);
+}
+
+static void	n_alu_imm(u8 *c, unsigned int *l, int op, int dst, u32 val)
+{
+	INST8 (c, *l, 0x81);	/* <op>l   $val, %dst */
+	INST8 (c, *l, 0xc0 | (op << 3) | dst);
+	INST32(c, *l, val);
+}
+
+static void	n_shift_imm(u8 *c, unsigned int *l, int op, int dst, u8 n)
+{
+	INST8 (c, *l, 0xc1);	/* <op>l   $n, %dst */
+	INST8 (c, *l, 0xc0 | (op << 3) | dst);
+	INST8 (c, *l, n);
+}
+
+static void	n_shift_cl(u8 *c, unsigned int *l, int op, int dst)
+{
+	INST8 (c, *l, 0xd3);	/* <op>l   %cl, %dst */
+	INST8 (c, *l, 0xc0 | (op << 3) | dst);
+}
+
+static void	n_not(u8 *c, unsigned int *l, int dst)
+{
+	INST8 (c, *l, 0xf7);	/* notl    %dst */
+	INST8 (c, *l, 0xd0 | dst);
+}
+
+static void	n_neg(u8 *c, unsigned int *l, int dst)
+{
+	INST8 (c, *l, 0xf7);	/* negl    %dst */
+	INST8 (c, *l, 0xd8 | dst);
+}
+
+static void	n_test(u8 *c, unsigned int *l, int a, int b)
+{
+	INST8 (c, *l, 0x85);	/* testl   %b, %a */
+	INST8 (c, *l, 0xc0 | (b << 3) | a);
+}
+
+static void	n_test_imm(u8 *c, unsigned int *l, int dst, u32 val)
+{
+	INST8 (c, *l, 0xf7);	/* testl   $val, %dst */
+	INST8 (c, *l, 0xc0 | dst);
+	INST32(c, *l, val);
+}
+
+/* The 0f-prefixed reg <- r/m ops: imul (af), bsr (bd), movsb (be), movsw
+ * (bf), cmovcc (40+cc):
+ */
+static void	n_op0f(u8 *c, unsigned int *l, u8 op, int dst, int src)
+{
+	INST8 (c, *l, 0x0f);
+	INST8 (c, *l, op);
+	INST8 (c, *l, 0xc0 | (dst << 3) | src);
+}
+
+static void	n_imul_imm(u8 *c, unsigned int *l, int dst, int src, u32 val)
+{
+	INST8 (c, *l, 0x69);	/* imull   $val, %src, %dst */
+	INST8 (c, *l, 0xc0 | (dst << 3) | src);
+	INST32(c, *l, val);
+}
+
+static void	n_setcc(u8 *c, unsigned int *l, int cc, int dst)
+{
+	INST8 (c, *l, 0x0f);	/* set<cc> %dst (low byte) */
+	INST8 (c, *l, 0x90 | cc);
+	INST8 (c, *l, 0xc0 | dst);
+}
+
+/* CR field BF = %eax compared with %ecx, and XER[SO] (see CMP()/CMPu()): */
+static void	n_cmp_cr(u8 *c, unsigned int *l, int BF, bool is_signed)
+{
+	unsigned int sh = (7 - BF) * 4;
+
+	n_mov_imm(c, l, H_EDX, 4);
+	n_mov_imm(c, l, H_ESI, 8);
+	n_alu(c, l, ALU_CMP, H_EAX, H_ECX);
+	n_op0f(c, l, 0x40 | (is_signed ? CC_L : CC_B), H_EDX, H_ESI);
+	n_mov_imm(c, l, H_ESI, 2);
+	n_op0f(c, l, 0x40 | CC_E, H_EDX, H_ESI);
+
+	n_load(c, l, H_EAX, PPCCPUState::getXERoffset());
+	n_shift_imm(c, l, SH_SHR, H_EAX, 31);
+	n_alu(c, l, ALU_OR, H_EDX, H_EAX);
+	if (sh)
+		n_shift_imm(c, l, SH_SHL, H_EDX, sh);
+
+	n_load(c, l, H_EAX, PPCCPUState::getCRoffset());
+	n_alu_imm(c, l, ALU_AND, H_EAX, ~(0xfU << sh));
+	n_alu(c, l, ALU_OR, H_EAX, H_EDX);
+	n_store(c, l, H_EAX, PPCCPUState::getCRoffset());
+#if ENABLE_LAZY_FLAGS
+	/* CR0 is now up to date (other fields leave a pending CR0 be): */
+	if (BF == 0)
+		n_store8_imm(c, l, PPCCPUState::getCR0PendingOffset(), 0);
+#endif
+}
+
+/* Record form:  CR0 from the result in %eax (see setCR0Result()): */
+static void	n_set_cr0(u8 *c, unsigned int *l)
+{
+#if ENABLE_LAZY_FLAGS
+	n_store(c, l, H_EAX, PPCCPUState::getCR0ResultOffset());
+	n_store8_imm(c, l, PPCCPUState::getCR0PendingOffset(), 1);
+#else
+	n_mov_imm(c, l, H_ECX, 0);
+	n_cmp_cr(c, l, 0, true);
+#endif
+}
+
+static u32	rlw_mask(int MB, int ME)
+{
+	return MB <= ME ?
+		( (0xffffffffu >> MB) & ~(0x7fffffffu >> ME) ) :
+		( (0xffffffff << (31-ME)) | ~(0xfffffffeu << (31-MB)));
+}
+
+#if FLAT_MEM == 0 && DUMMY_MEM_ACCESS == 0
+/* Loads and stores:  the current D-side uTLB is probed inline, as
+ * dutlbProbe() does, and an aligned access hitting a RAM page that permits
+ * it outright is done directly on the host page.  Anything else (a miss,
+ * IO, misalignment, a watched code page, etc.) calls the handler, which
+ * deals with it (or takes a DSI), with the PC brought up to date around the
+ * call:
+ *
+ *	<EA in %esi>
+ *	movq	mmu(%rbx), %rdx
+ *	movl	%esi, %eax
+ *	shrl	$12, %eax
+ *	andl	$(entries - 1), %eax
+ *	imull	$entry_size, %eax, %eax
+ *	addq	cur_dutlb(%rdx), %rax
+ *	movl	%esi, %ecx
+ *	andl	$~0xfff, %ecx
+ *	orl	cur_dtr(%rdx), %ecx
+ *	orl	$VALID, %ecx
+ *	cmpl	ea(%rax), %ecx
+ *	jne	slow
+ *	testl	$(size - 1), %esi
+ *	jne	slow
+ *	movq	pa(%rax), %rax
+ *	movabs	$(reject | need), %rcx
+ *	andq	%rax, %rcx
+ *	cmpq	$need, %rcx
+ *	jne	slow
+ *	andq	$~0xfff, %rax
+ *	movl	%esi, %ecx
+ *	andl	$0xfff, %ecx
+ *	<access (%rax,%rcx), byte-swapping as ram_load()/ram_store() do>
+ *	jmp	done
+ * slow:
+ *	addl	$(4 * native_pc_lag), pc(%r12)
+ *	movl	$n, blk_ticks(%r12)
+ *	<call handler>
+ *	subl	$(4 * (native_pc_lag + 1)), pc(%r12)
+ * done:
+ */
+static bool	generateNativeMem(u32 inst, u8 **codeptr, unsigned int *codelen)
+{
+	u8 *c = *codeptr;
+	unsigned int l = 0;
+	unsigned int op = getOpcode(inst);
+	int rt = D_RT(inst), ra = D_RA(inst), rb = -1;
+	u32 d = D_SI(inst);
+
+	/* lwz(u), lbz(u), stw(u), stb(u), lhz(u), lha(u), sth(u), and their
+	 * X-form equivalents, which have XOPC 23 + 32 * (D opcode - 32):
+	 */
+	if (op == 31) {
+		unsigned int x = X_XOPC(inst);
+		if (x < 23 || x > 23 + 32 * 13 || (x - 23) % 32)
+			return false;
+		op = 32 + (x - 23) / 32;
+		rb = X_RB(inst);
+		d = 0;
+	} else if (op < 32 || op > 45) {
+		return false;
+	}
+	bool load = op != 36 && op != 37 && op != 38 && op != 39 && op != 44 && op != 45;
+	bool update = op & 1;
+	bool sext = op == 42 || op == 43;
+	unsigned int size = (op < 34 || op == 36 || op == 37) ? 4 :
+		(op < 40) ? 1 : 2;
+
+	/* Leave the invalid update forms to the handler: */
+	if (update && (ra == 0 || (load && ra == rt)))
+		return false;
+
+	/* EA: */
+	if (ra) {
+		n_load(c, &l, H_ESI, GPR_OFF(ra));
+		if (rb >= 0) {
+			n_load(c, &l, H_ECX, GPR_OFF(rb));
+			n_alu(c, &l, ALU_ADD, H_ESI, H_ECX);
+		} else if (d) {
+			n_alu_imm(c, &l, ALU_ADD, H_ESI, d);
+		}
+	} else if (rb >= 0) {
+		n_load(c, &l, H_ESI, GPR_OFF(rb));
+	} else {
+		n_mov_imm(c, &l, H_ESI, d);
+	}
+
+	/* Probe: */
+	unsigned int to_slow[3], nr_to_slow = 0;
+
+	INST8 (c, l, 0x48);	/* movq    mmu(%rbx), %rdx */
+	INST8 (c, l, 0x8b);
+	INST8 (c, l, 0x93);
+	INST32(c, l, PPCInterpreter::getMMUoffset());
+	n_mov(c, &l, H_EAX, H_ESI);
+	n_shift_imm(c, &l, SH_SHR, H_EAX, 12);
+	n_alu_imm(c, &l, ALU_AND, H_EAX, PPCMMU::getUTLBIndexMask());
+	n_imul_imm(c, &l, H_EAX, H_EAX, PPCMMU::getUTLBEntrySize());
+	INST8 (c, l, 0x48);	/* addq    cur_dutlb(%rdx), %rax */
+	INST8 (c, l, 0x03);
+	INST8 (c, l, 0x82);
+	INST32(c, l, PPCMMU::getCurDUTLBoffset());
+
+	n_mov(c, &l, H_ECX, H_ESI);
+	n_alu_imm(c, &l, ALU_AND, H_ECX, ~0xfff);
+	INST8 (c, l, 0x0b);	/* orl     cur_dtr(%rdx), %ecx */
+	INST8 (c, l, 0x8a);
+	INST32(c, l, PPCMMU::getCurDTRoffset());
+	n_alu_imm(c, &l, ALU_OR, H_ECX, PPCMMU::getUTLBValid());
+	INST8 (c, l, 0x3b);	/* cmpl    ea(%rax), %ecx */
+	INST8 (c, l, 0x48);
+	INST8 (c, l, PPCMMU::getUTLBEAoffset());
+	INST8 (c, l, 0x75);	/* jne     slow */
+	to_slow[nr_to_slow++] = l;
+	INST8 (c, l, 0);
+
+	if (size > 1) {
+		n_test_imm(c, &l, H_ESI, size - 1);
+		INST8 (c, l, 0x75);	/* jne     slow */
+		to_slow[nr_to_slow++] = l;
+		INST8 (c, l, 0);
+	}
+
+	INST8 (c, l, 0x48);	/* movq    pa(%rax), %rax */
+	INST8 (c, l, 0x8b);
+	INST8 (c, l, 0x40);
+	INST8 (c, l, PPCMMU::getUTLBPAoffset());
+	INST8 (c, l, 0x48);	/* movabs  $(reject | need), %rcx */
+	INST8 (c, l, 0xb9);
+	INST64(c, l, PPCMMU::getDUTLBProbeReject(load) | PPCMMU::getDUTLBProbeNeed(load));
+	INST8 (c, l, 0x48);	/* andq    %rax, %rcx */
+	INST8 (c, l, 0x21);
+	INST8 (c, l, 0xc1);
+	INST8 (c, l, 0x48);	/* cmpq    $need, %rcx */
+	INST8 (c, l, 0x83);
+	INST8 (c, l, 0xf9);
+	INST8 (c, l, PPCMMU::getDUTLBProbeNeed(load));
+	INST8 (c, l, 0x75);	/* jne     slow */
+	to_slow[nr_to_slow++] = l;
+	INST8 (c, l, 0);
+
+	INST8 (c, l, 0x48);	/* andq    $~0xfff, %rax */
+	INST8 (c, l, 0x25);
+	INST32(c, l, ~0xfff);
+	n_mov(c, &l, H_ECX, H_ESI);
+	n_alu_imm(c, &l, ALU_AND, H_ECX, 0xfff);
+	if (RAM_SWIZZLED && size < 4)
+		n_alu_imm(c, &l, ALU_XOR, H_ECX, 4 - size);
+
+	/* Access: */
+	if (load) {
+		if (size == 4) {
+			INST8 (c, l, 0x8b);	/* movl    (%rax,%rcx), %eax */
+		} else {
+			INST8 (c, l, 0x0f);	/* movz[bw]l (%rax,%rcx), %eax */
+			INST8 (c, l, size == 1 ? 0xb6 : 0xb7);
+		}
+		INST8 (c, l, 0x04);
+		INST8 (c, l, 0x08);
+		if (!RAM_SWIZZLED && size == 4) {
+			INST8 (c, l, 0x0f);	/* bswap   %eax */
+			INST8 (c, l, 0xc8);
+		} else if (!RAM_SWIZZLED && size == 2) {
+			INST8 (c, l, 0x66);	/* rolw    $8, %ax */
+			INST8 (c, l, 0xc1);
+			INST8 (c, l, 0xc0);
+			INST8 (c, l, 8);
+		}
+		if (sext)
+			n_op0f(c, &l, 0xbf, H_EAX, H_EAX);
+		n_store(c, &l, H_EAX, GPR_OFF(rt));
+	} else {
+		n_load(c, &l, H_EDX, GPR_OFF(rt));
+		if (!RAM_SWIZZLED && size == 4) {
+			INST8 (c, l, 0x0f);	/* bswap   %edx */
+			INST8 (c, l, 0xca);
+		} else if (!RAM_SWIZZLED && size == 2) {
+			INST8 (c, l, 0x66);	/* rolw    $8, %dx */
+			INST8 (c, l, 0xc1);
+			INST8 (c, l, 0xc2);
+			INST8 (c, l, 8);
+		}
+		if (size == 2)
+			INST8 (c, l, 0x66);	/* movw    %dx, (%rax,%rcx) */
+		INST8 (c, l, size == 1 ? 0x88 : 0x89);	/* mov[lb] %edx/%dl, (%rax,%rcx) */
+		INST8 (c, l, 0x14);
+		INST8 (c, l, 0x08);
+	}
+	if (update)
+		n_store(c, &l, H_ESI, GPR_OFF(ra));
+
+	INST8 (c, l, 0xe9);	/* jmp     done */
+	unsigned int to_done = l;
+	INST32(c, l, 0);
+
+	/* Slow path: */
+	for (unsigned int i = 0; i < nr_to_slow; i++)
+		c[to_slow[i]] = l - (to_slow[i] + 1);
+
+	if (native_pc_lag) {
+		INST8 (c, l, 0x41);	/* addl    $lag, pc(%r12) */
+		INST8 (c, l, 0x81);
+		INST8 (c, l, 0x84);
+		INST8 (c, l, 0x24);
+		INST32(c, l, PPCCPUState::getPCoffset());
+		INST32(c, l, native_pc_lag * 4);
+	}
+	u8 *p = c + l;
+	unsigned int avail = *codelen - l;
+	noteBlockTicks(&p, &avail);
+	decodeInstrGenerateCall(inst, &p, &avail);
+	l = p - c;
+	INST8 (c, l, 0x41);	/* subl    $(lag + 1), pc(%r12) */
+	INST8 (c, l, 0x81);
+	INST8 (c, l, 0xac);
+	INST8 (c, l, 0x24);
+	INST32(c, l, PPCCPUState::getPCoffset());
+	INST32(c, l, (native_pc_lag + 1) * 4);
+
+	*(u32 *)(c + to_done) = l - (to_done + 4);
+
+	JITTRACE("  native %s, %d bytes\n", load ? "load" : "store", l);
+	*codeptr += l;
+	*codelen -= l;
+	native_pc_lag++;
+	COUNT(CTR_JIT_INST_NATIVE_MEM);
+	return true;
+}
+#endif
+
+/* Returns true if native code was generated for inst, or false if it should
+ * be a call to its handler.
+ */
+static bool	generateNative(u32 inst, u8 **codeptr, unsigned int *codelen)
+{
+	u8 *c = *codeptr;
+	unsigned int l = 0;
+	int rd = -1;		/* GPR to write %eax to */
+	bool rc = false;	/* Then set CR0 from it */
+
+	/* Leave the call path to find it's out of space: */
+	if (*codelen < NATIVE_MAX_BYTES)
+		return false;
+
+#if FLAT_MEM == 0 && DUMMY_MEM_ACCESS == 0
+	if (generateNativeMem(inst, codeptr, codelen))
+		return true;
+#endif
+
+	switch (getOpcode(inst)) {
+	case 7:		/* mulli */
+		n_load(c, &l, H_EAX, GPR_OFF(D_RA(inst)));
+		n_imul_imm(c, &l, H_EAX, H_EAX, D_SI(inst));
+		rd = D_RT(inst);
+		break;
+
+	case 10:	/* cmpli */
+	case 11:	/* cmpi */
+		if (D_L(inst))
+			return false;
+		n_load(c, &l, H_EAX, GPR_OFF(D_RA(inst)));
+		n_mov_imm(c, &l, H_ECX, getOpcode(inst) == 11 ? (u32)D_SI(inst) : D_UI(inst));
+		n_cmp_cr(c, &l, D_BF(inst), getOpcode(inst) == 11);
+		break;
+
+	case 14:	/* addi (li) */
+	case 15: {	/* addis (lis) */
+		u32 imm = getOpcode(inst) == 14 ? D_SI(inst) : D_SI(inst) << 16;
+		if (D_RA0(inst) == 0) {
+			n_mov_imm(c, &l, H_EAX, imm);
+		} else {
+			n_load(c, &l, H_EAX, GPR_OFF(D_RA0(inst)));
+			if (imm)
+				n_alu_imm(c, &l, ALU_ADD, H_EAX, imm);
+		}
+		rd = D_RT(inst);
+		break;
+	}
+
+	case 20: {	/* rlwimi */
+		u32 m = rlw_mask(M_MB(inst), M_ME(inst));
+		n_load(c, &l, H_EAX, GPR_OFF(M_RS(inst)));
+		if (M_SH(inst))
+			n_shift_imm(c, &l, SH_ROL, H_EAX, M_SH(inst));
+		n_alu_imm(c, &l, ALU_AND, H_EAX, m);
+		n_load(c, &l, H_ECX, GPR_OFF(M_RA(inst)));
+		n_alu_imm(c, &l, ALU_AND, H_ECX, ~m);
+		n_alu(c, &l, ALU_OR, H_EAX, H_ECX);
+		rd = M_RA(inst);
+		rc = M_Rc(inst);
+		break;
+	}
+
+	case 21:	/* rlwinm (slwi, srwi, clrlwi, ...) */
+	case 23: {	/* rlwnm */
+		u32 m = rlw_mask(M_MB(inst), M_ME(inst));
+		n_load(c, &l, H_EAX, GPR_OFF(M_RS(inst)));
+		if (getOpcode(inst) == 23) {
+			n_load(c, &l, H_ECX, GPR_OFF(M_RB(inst)));
+			n_shift_cl(c, &l, SH_ROL, H_EAX);
+		} else if (M_SH(inst)) {
+			n_shift_imm(c, &l, SH_ROL, H_EAX, M_SH(inst));
+		}
+		if (m != 0xffffffff)
+			n_alu_imm(c, &l, ALU_AND, H_EAX, m);
+		rd = M_RA(inst);
+		rc = M_Rc(inst);
+		break;
+	}
+
+	case 24:	/* ori */
+	case 25:	/* oris */
+	case 26:	/* xori */
+	case 27:	/* xoris */
+	case 28:	/* andi. */
+	case 29: {	/* andis. */
+		static const int ops[] = { ALU_OR, ALU_XOR, ALU_AND };
+		unsigned int op = getOpcode(inst) - 24;
+		u32 imm = (op & 1) ? D_UI(inst) << 16 : D_UI(inst);
+		n_load(c, &l, H_EAX, GPR_OFF(D_RS(inst)));
+		if (imm || op >= 4)
+			n_alu_imm(c, &l, ops[op / 2], H_EAX, imm);
+		rd = D_RA(inst);
+		rc = op >= 4;
+		break;
+	}
+
+	case 31:
+		switch (X_XOPC(inst)) {
+		case 0:		/* cmp */
+		case 32:	/* cmpl */
+			if ((inst >> 21) & 1)	/* L */
+				return false;
+			n_load(c, &l, H_EAX, GPR_OFF(X_RA(inst)));
+			n_load(c, &l, H_ECX, GPR_OFF(X_RB(inst)));
+			n_cmp_cr(c, &l, X_BF(inst), X_XOPC(inst) == 0);
+			break;
+
+		/* XO-form, OE=0 (else the XOPC includes it): */
+		case 266:	/* add */
+		case 40:	/* subf */
+		case 235:	/* mullw */
+			n_load(c, &l, H_EAX, GPR_OFF(X_XOPC(inst) == 40 ? XO_RB(inst) : XO_RA(inst)));
+			n_load(c, &l, H_ECX, GPR_OFF(X_XOPC(inst) == 40 ? XO_RA(inst) : XO_RB(inst)));
+			if (X_XOPC(inst) == 235)
+				n_op0f(c, &l, 0xaf, H_EAX, H_ECX);
+			else
+				n_alu(c, &l, X_XOPC(inst) == 40 ? ALU_SUB : ALU_ADD, H_EAX, H_ECX);
+			rd = XO_RT(inst);
+			rc = XO_Rc(inst);
+			break;
+
+		case 104:	/* neg */
+			n_load(c, &l, H_EAX, GPR_OFF(XO_RA(inst)));
+			n_neg(c, &l, H_EAX);
+			rd = XO_RT(inst);
+			rc = XO_Rc(inst);
+			break;
+
+		case 28:	/* and */
+		case 60:	/* andc */
+		case 476:	/* nand */
+		case 444:	/* or (mr) */
+		case 412:	/* orc */
+		case 124:	/* nor */
+		case 316:	/* xor */
+		case 284: {	/* eqv */
+			unsigned int xo = X_XOPC(inst);
+			int op = (xo == 28 || xo == 60 || xo == 476) ? ALU_AND :
+				(xo == 316 || xo == 284) ? ALU_XOR : ALU_OR;
+			n_load(c, &l, H_EAX, GPR_OFF(X_RS(inst)));
+			if (!(xo == 444 && X_RS(inst) == X_RB(inst))) {
+				n_load(c, &l, H_ECX, GPR_OFF(X_RB(inst)));
+				if (xo == 60 || xo == 412)
+					n_not(c, &l, H_ECX);
+				n_alu(c, &l, op, H_EAX, H_ECX);
+				if (xo == 476 || xo == 124 || xo == 284)
+					n_not(c, &l, H_EAX);
+			}
+			rd = X_RA(inst);
+			rc = X_Rc(inst);
+			break;
+		}
+
+		case 24:	/* slw */
+		case 536:	/* srw */
+			/* x86 only uses the bottom 5 bits of the count: */
+			n_load(c, &l, H_EAX, GPR_OFF(X_RS(inst)));
+			n_load(c, &l, H_ECX, GPR_OFF(X_RB(inst)));
+			n_mov_imm(c, &l, H_EDX, 0);
+			n_shift_cl(c, &l, X_XOPC(inst) == 24 ? SH_SHL : SH_SHR, H_EAX);
+			n_test_imm(c, &l, H_ECX, 0x20);
+			n_op0f(c, &l, 0x40 | CC_NE, H_EAX, H_EDX);
+			rd = X_RA(inst);
+			rc = X_Rc(inst);
+			break;
+
+		case 824: {	/* srawi */
+			unsigned int sh = X_SH(inst);
+			n_load(c, &l, H_EAX, GPR_OFF(X_RS(inst)));
+			if (sh) {
+				/* CA if negative and any 1s shifted out: */
+				n_mov(c, &l, H_EDX, H_EAX);
+				n_alu_imm(c, &l, ALU_AND, H_EDX, (1U << sh) - 1);
+				n_mov(c, &l, H_ECX, H_EAX);
+				n_shift_imm(c, &l, SH_SAR, H_ECX, 31);
+				n_test(c, &l, H_EDX, H_ECX);
+				n_mov_imm(c, &l, H_ECX, 0);
+				n_setcc(c, &l, CC_NE, H_ECX);
+				n_shift_imm(c, &l, SH_SHL, H_ECX, 29);
+				n_shift_imm(c, &l, SH_SAR, H_EAX, sh);
+			} else {
+				n_mov_imm(c, &l, H_ECX, 0);
+			}
+			n_load(c, &l, H_EDX, PPCCPUState::getXERoffset());
+			n_alu_imm(c, &l, ALU_AND, H_EDX, ~XER_CA);
+			n_alu(c, &l, ALU_OR, H_EDX, H_ECX);
+			n_store(c, &l, H_EDX, PPCCPUState::getXERoffset());
+			rd = X_RA(inst);
+			rc = X_Rc(inst);
+			break;
+		}
+
+		case 954:	/* extsb */
+		case 922:	/* extsh */
+			n_load(c, &l, H_EAX, GPR_OFF(X_RS(inst)));
+			n_op0f(c, &l, X_XOPC(inst) == 954 ? 0xbe : 0xbf, H_EAX, H_EAX);
+			rd = X_RA(inst);
+			rc = X_Rc(inst);
+			break;
+
+		case 26:	/* cntlzw */
+			/* 31 - bsr, or 32 for 0: */
+			n_load(c, &l, H_EAX, GPR_OFF(X_RS(inst)));
+			n_mov_imm(c, &l, H_ECX, 0xffffffff);
+			n_op0f(c, &l, 0xbd, H_EAX, H_EAX);
+			n_op0f(c, &l, 0x40 | CC_E, H_EAX, H_ECX);
+			n_neg(c, &l, H_EAX);
+			n_alu_imm(c, &l, ALU_ADD, H_EAX, 31);
+			rd = X_RA(inst);
+			rc = X_Rc(inst);
+			break;
+
+		default:
+			return false;
+		}
+		break;
+
+	default:
+		return false;
+	}
 
-	/* Compare PC to block_pc; if the same, branch to codestart */
-	INST8 (*codeptr, l, 0x81);	/* cmpl	  $pc, %edi */
-	INST8 (*codeptr, l, 0xff);
-	INST32(*codeptr, l, block_pc);	/* Note, 32bit PC */
+	if (rd >= 0)
+		n_store(c, &l, H_EAX, GPR_OFF(rd));
+	if (rc)
+		n_set_cr0(c, &l);
+
+	JITTRACE("  native, %d bytes\n", l);
+	*codeptr += l;
+	*codelen -= l;
+	native_pc_lag++;
+	COUNT(CTR_JIT_INST_NATIVE);
+	return true;
+}
+
+/* Bring the PC up to date with the native instructions since it was last: */
+static void	flushPC(u8 **codeptr, unsigned int *codelen)
+{
+	unsigned int l = 0;
 
-	int r = get_rel_addr(*codeptr + l + 1, (u64)codestart);
-	INST8 (*codeptr, l, 0x0f);	/* je	  relative_thing */
+	if (native_pc_lag == 0)
+		return;
+
+	INST8 (*codeptr, l, 0x41);	/* addl    $n, offsetof(PPCCPUState, pc)(%r12) */
+	INST8 (*codeptr, l, 0x81);
 	INST8 (*codeptr, l, 0x84);
-	INST32(*codeptr, l, r);
+	INST8 (*codeptr, l, 0x24);
+	INST32(*codeptr, l, PPCCPUState::getPCoffset());
+	INST32(*codeptr, l, native_pc_lag * 4);
+	native_pc_lag = 0;
 
 	CODE_FINAL(*codelen, l, *codeptr);
 }
+#endif
+
+#if ENABLE_JIT_CHAIN
+/* Block exits (see blockstore.cc):  a block ends by ticking the instruction
+ * count, then, if the run horizon's not been reached and the PC is one of
+ * its exits' targets, jumping straight to the block there if linked.
+ * Otherwise it returns 0, or the exit's ID if it wants linking:
+ *
+ *	addq	$nr_instrs, ticks(%r12)
+ *	movq	ticks(%r12), %rax
+ *	cmpq	run_horizon(%r12), %rax
+ *	jae	none
+ *	movl	pc(%r12), %ecx
+ *	cmpl	$target0, %ecx
+ *	jne	1f
+ *	jmp	.+5			<- patched to the target block
+ *	movl	$id0, %eax
+ *	jmp	out
+ * 1:	...
+ * none:
+ *	xorl	%eax, %eax
+ * out:
+ */
+
+/* Can the instruction change the MSR or address mapping?  If so, its block's
+ * exits can't assume the next block is found the same way this one was.
+ */
+static bool	changesContext(u32 inst)
+{
+	if (getOpcode(inst) != 31)
+		return false;
+	switch (X_XOPC(inst)) {
+	case 146:	/* mtmsr */
+	case 210:	/* mtsr */
+	case 242:	/* mtsrin */
+	case 306:	/* tlbie */
+	case 370:	/* tlbia */
+	case 566:	/* tlbsync */
+		return true;
+	case 467: {	/* mtspr; SDR1, BATs etc. */
+		unsigned int spr = XFX_spr(inst);
+		return spr != SPR_XER && spr != SPR_LR && spr != SPR_CTR;
+	}
+	default:
+		return false;
+	}
+}
+
+/* Exits only go to PCs on the same page as the block: */
+static void	addBlockExit(block_t *block, VA target)
+{
+	if ((target & ~0xfff) != (block->pc & ~0xfff) || block->nr_exits == BLOCK_EXITS)
+		return;
+	block->exit[block->nr_exits].target = target;
+	block->exit[block->nr_exits].to = 0;
+	block->nr_exits++;
+}
+
+/* Given the block's last instruction (at pc), and how it ended (see
+ * decodeInstrGenerateCall()), find where it can go next:
+ */
+static void	findBlockExits(block_t *block, u32 inst, VA pc, unsigned int end_type)
+{
+	if (end_type == 0) {
+		/* Ran on, i.e. hit the instruction limit: */
+		addBlockExit(block, pc + 4);
+		return;
+	}
+	if (end_type != 1)
+		return;
+
+	switch (getOpcode(inst)) {
+	case 18: {	/* b */
+		VA t = (s32)(I_LI(inst) << 6) >> 6;
+		addBlockExit(block, I_AA(inst) ? t : pc + t);
+		break;
+	}
+	case 16: {	/* bc */
+		VA t = (s16)B_BD(inst);
+		addBlockExit(block, B_AA(inst) ? t : pc + t);
+		if ((B_BO(inst) & 0x14) != 0x14)
+			addBlockExit(block, pc + 4);
+		break;
+	}
+	case 19:	/* bclr, bcctr */
+		if ((B_BO(inst) & 0x14) != 0x14)
+			addBlockExit(block, pc + 4);
+		break;
+	}
+}
+
+/* Plants the exits from first on, having done nr_instrs instructions: */
+static void	plantBlockExits(block_t *block, unsigned int first, unsigned int nr_instrs,
+				u8 **codeptr, unsigned int *codelen)
+{
+	unsigned int l = 0;
+	unsigned int to_none[BLOCK_EXITS + 1], nr_to_none = 0;
+	unsigned int to_out[BLOCK_EXITS], nr_to_out = 0;
+	u8 *c = *codeptr;
+
+	INST8 (c, l, 0x49);	/* addq    $nr_instrs, ticks(%r12) */
+	INST8 (c, l, 0x81);
+	INST8 (c, l, 0x84);
+	INST8 (c, l, 0x24);
+	INST32(c, l, PPCCPUState::getTicksOffset());
+	INST32(c, l, nr_instrs);
+
+	if (block->nr_exits > first) {
+		INST8 (c, l, 0x49);	/* movq    ticks(%r12), %rax */
+		INST8 (c, l, 0x8b);
+		INST8 (c, l, 0x84);
+		INST8 (c, l, 0x24);
+		INST32(c, l, PPCCPUState::getTicksOffset());
+
+		INST8 (c, l, 0x49);	/* cmpq    run_horizon(%r12), %rax */
+		INST8 (c, l, 0x3b);
+		INST8 (c, l, 0x84);
+		INST8 (c, l, 0x24);
+		INST32(c, l, PPCCPUState::getRunHorizonOffset());
+
+		INST8 (c, l, 0x73);	/* jae     none */
+		to_none[nr_to_none++] = l;
+		INST8 (c, l, 0);
+
+		INST8 (c, l, 0x41);	/* movl    pc(%r12), %ecx */
+		INST8 (c, l, 0x8b);
+		INST8 (c, l, 0x8c);
+		INST8 (c, l, 0x24);
+		INST32(c, l, PPCCPUState::getPCoffset());
+	}
+
+	for (unsigned int i = first; i < block->nr_exits; i++) {
+		INST8 (c, l, 0x81);	/* cmpl    $target, %ecx */
+		INST8 (c, l, 0xf9);
+		INST32(c, l, block->exit[i].target);
+
+		INST8 (c, l, 0x75);	/* jne     next (or none) */
+		unsigned int jne = l;
+		INST8 (c, l, 0);
+
+		block->exit[i].jmp_ofs = c + l - BLOCK_CODEPTR(block);
+		INST8 (c, l, 0xe9);	/* jmp     .+5 */
+		INST32(c, l, 0);
+
+		INST8 (c, l, 0xb8);	/* movl    $id, %eax */
+#if ENABLE_JIT_PERSIST
+		blockCacheExitID(c + l, i);
+#endif
+		INST32(c, l, blockExitID(block, i));
+
+		INST8 (c, l, 0xeb);	/* jmp     out */
+		to_out[nr_to_out++] = l;
+		INST8 (c, l, 0);
+
+		if (i == block->nr_exits - 1)
+			to_none[nr_to_none++] = jne;
+		else
+			c[jne] = l - (jne + 1);
+	}
+
+	for (unsigned int i = 0; i < nr_to_none; i++)
+		c[to_none[i]] = l - (to_none[i] + 1);
+	INST8 (c, l, 0x31);	/* xorl    %eax, %eax */
+	INST8 (c, l, 0xc0);
+
+	for (unsigned int i = 0; i < nr_to_out; i++)
+		c[to_out[i]] = l - (to_out[i] + 1);
+
+	CODE_FINAL(*codelen, l, *codeptr);
+}
+#endif
+
+/* Return from the block, with %eax set for the runloop: */
+static void	plantReturn(u8 **codeptr, unsigned int *codelen)
+{
+	unsigned int l = 0;
+
+	/* See above re stack alignment.
+	 * INST32(*codeptr, l, 0x08c48348);  addq    $8, %rsp
+	 */
+
+	INST8 (*codeptr, l, 0x5b);	/* popq	   %rbx */
+
+	INST8 (*codeptr, l, 0x41);	/* popq	   %r12 */
+	INST8 (*codeptr, l, 0x5c);
+
+	INST8 (*codeptr, l, 0x5d);	/* popq	   %rbp */
+
+	INST8 (*codeptr, l, 0xc3);	/* retq */
+
+	CODE_FINAL(*codelen, l, *codeptr);
+}
+
+#if ENABLE_JIT_TRACE
+/* Traces:  rather than ending at every branch, a block carries on at the
+ * target of an unconditional one, and on the likely side of a conditional
+ * one, as long as that's on the same page and not somewhere the block has
+ * already been (a loop's branch back ends it, to be chained to itself).  A
+ * blr after a bl that was followed is taken to return just past it.
+ * Each followed conditional branch checks the PC it set; if it went the
+ * other way, the block ticks the instructions done so far and leaves there,
+ * through an exit of its own (which can be linked like the block's last
+ * ones, if there's room) or straight back to the runloop:
+ *
+ *	cmpl	$predicted, pc(%r12)
+ *	je	1f
+ *	<exits, as plantBlockExits()>	; or, without JIT_CHAIN,
+ *					;  movl $nr_instrs, %eax
+ *	popq	%rbx ; popq %r12 ; popq %rbp
+ *	retq
+ * 1:
+ */
+#define TRACE_MAX_RUNS	8
+
+static VA		trace_run_start[TRACE_MAX_RUNS];
+static VA		trace_run_end[TRACE_MAX_RUNS];
+static unsigned int	trace_nr_runs;
+static VA		trace_ret;	/* After a followed bl, where a blr likely goes */
+
+static bool	inTrace(VA addr)
+{
+	for (unsigned int i = 0; i < trace_nr_runs; i++) {
+		if (addr >= trace_run_start[i] && addr < trace_run_end[i])
+			return true;
+	}
+	return false;
+}
+
+/* The branch at pc (a type 1 end, see decodeInstrGenerateCall()) ends the
+ * current run.  Returns true if the block should carry on at *next, with
+ * *check set if it's only likely to go there:
+ */
+static bool	traceFollow(u32 inst, VA pc, VA *next, bool *check, VA *other)
+{
+	VA t;
+
+	trace_run_end[trace_nr_runs - 1] = pc + 4;
+	if (trace_nr_runs == TRACE_MAX_RUNS)
+		return false;
+
+	switch (getOpcode(inst)) {
+	case 18:	/* b */
+		t = (s32)(I_LI(inst) << 6) >> 6;
+		*next = I_AA(inst) ? t : pc + t;
+		*check = false;
+		break;
+	case 16: {	/* bc */
+		s32 d = (s16)B_BD(inst);
+		t = B_AA(inst) ? d : pc + d;
+		if ((B_BO(inst) & 0x14) == 0x14) {
+			*next = t;
+			*check = false;
+		} else {
+			/* Backward taken, forward not; the y bit says otherwise: */
+			bool taken = (d < 0) != !!(B_BO(inst) & 1);
+			*next = taken ? t : pc + 4;
+			*other = taken ? pc + 4 : t;
+			*check = true;
+		}
+		break;
+	}
+	case 19:	/* blr, back to a bl earlier in the trace */
+		if (X_XOPC(inst) != 16 || (B_BO(inst) & 0x14) != 0x14 || B_LK(inst) || !trace_ret)
+			return false;
+		*next = trace_ret;
+		*other = 0;
+		*check = true;
+		break;
+	default:
+		return false;
+	}
+	if ((*next & ~0xfff) != (pc & ~0xfff) || inTrace(*next))
+		return false;
+	if (B_LK(inst))		/* (Same bit in I-form) */
+		trace_ret = pc + 4;
+	else if (getOpcode(inst) == 19)
+		trace_ret = 0;
+
+	trace_run_start[trace_nr_runs] = *next;
+	trace_run_end[trace_nr_runs] = *next;
+	trace_nr_runs++;
+	COUNT(CTR_JIT_TRACE_FOLLOW);
+	return true;
+}
+
+/* After a followed conditional branch (or blr), which was predicted to go
+ * to predicted; otherwise, it went to other (or somewhere unknown, if 0):
+ */
+static void	plantSideExit(block_t *block, VA predicted, VA other,
+			      u8 **codeptr, unsigned int *codelen)
+{
+	unsigned int l = 0;
+
+	INST8 (*codeptr, l, 0x41);	/* cmpl    $predicted, pc(%r12) */
+	INST8 (*codeptr, l, 0x81);
+	INST8 (*codeptr, l, 0xbc);
+	INST8 (*codeptr, l, 0x24);
+	INST32(*codeptr, l, PPCCPUState::getPCoffset());
+	INST32(*codeptr, l, predicted);
+
+	INST8 (*codeptr, l, 0x74);	/* je      1f */
+	INST8 (*codeptr, l, 0);
+	CODE_FINAL(*codelen, l, *codeptr);
+
+	u8 *je_end = *codeptr;
+#if ENABLE_JIT_CHAIN
+	/* The exit can be linked too, leaving room for the block's last ones: */
+	unsigned int first = block->nr_exits;
+	if (other && first < BLOCK_EXITS - 2)
+		addBlockExit(block, other);
+	plantBlockExits(block, first, cur_blk_nr_instrs, codeptr, codelen);
+#else
+	l = 0;
+	INST8 (*codeptr, l, 0xb8);	/* movl    $nr_instrs, %eax */
+	INST32(*codeptr, l, cur_blk_nr_instrs);
+	CODE_FINAL(*codelen, l, *codeptr);
+#endif
+	plantReturn(codeptr, codelen);
+	if (oom_abort)
+		return;
+	je_end[-1] = *codeptr - je_end;
+	COUNT(CTR_JIT_TRACE_SIDE_EXIT);
+}
+#endif
+
+/* A block below the top tier counts down its runs (from wherever it's
+ * entered), and when they're up, returns to the runloop without doing
+ * anything, to be made again at the next tier:
+ *
+ *	subl	$1, tier_left(%rip)
+ *	jnz	1f
+ *	xorl	%eax, %eax
+ *	popq	%rbx ; popq %r12 ; popq %rbp
+ *	retq
+ * 1:
+ */
+static void	plantTierCheck(block_t *block, u8 **codeptr, unsigned int *codelen)
+{
+	unsigned int l = 0;
+
+	INST8 (*codeptr, l, 0x83);	/* subl    $1, tier_left(%rip) */
+	INST8 (*codeptr, l, 0x2d);
+	INST32(*codeptr, l, (u8 *)&block->tier_left - (*codeptr + l + 5));
+	INST8 (*codeptr, l, 0x01);
+
+	INST8 (*codeptr, l, 0x75);	/* jnz     1f */
+	INST8 (*codeptr, l, 0);
+
+	INST8 (*codeptr, l, 0x31);	/* xorl    %eax, %eax */
+	INST8 (*codeptr, l, 0xc0);
+	CODE_FINAL(*codelen, l, *codeptr);
+
+	u8 *jnz_end = *codeptr - 2;
+	plantReturn(codeptr, codelen);
+	if (oom_abort)
+		return;
+	jnz_end[-1] = *codeptr - jnz_end;
+}
 
 static void	startBlock(block_t *block, u8 **codeptr, unsigned int *codelen)
 {
@@ -390,30 +1431,29 @@ static void	startBlock(block_t *block, u8 **codeptr, unsigned int *codelen)
 	INST8 (*codeptr, l, 0x89);
 	INST8 (*codeptr, l, 0xfb);
 
+	/* ...and its PPCCPUState * in %r12, for native code, exits and
+	 * noteBlockTicks():
+	 */
+	INST8 (*codeptr, l, 0x4c);	/* movq    offsetof(PPCInterpreter, cpus)(%rbx), %r12 */
+	INST8 (*codeptr, l, 0x8b);
+	INST8 (*codeptr, l, 0xa3);
+	INST32(*codeptr, l, PPCInterpreter::getCPUSoffset());
+
 	CODE_FINAL(*codelen, l, *codeptr);
 }
 
 static void	finaliseBlock(block_t *block, u8 **codeptr, unsigned int *codelen)
 {
+#if !ENABLE_JIT_CHAIN
+	/* (Otherwise, plantBlockExits() has ticked and set %eax.) */
 	unsigned int l = 0;
 
 	INST8 (*codeptr, l, 0xb8);	/* movl    $xxxxxxxx, %eax */
-	INST32(*codeptr, l, cur_blk_nr_instrs);	/* FIXME: make dynamic if looping! */
-
-	/* See above re stack alignment.
-	 * INST32(*codeptr, l, 0x08c48348);  addq    $8, %rsp
-	 */
-
-	INST8 (*codeptr, l, 0x5b);	/* popq	   %rbx */
-
-	INST8 (*codeptr, l, 0x41);	/* popq	   %r12 */
-	INST8 (*codeptr, l, 0x5c);
-
-	INST8 (*codeptr, l, 0x5d);	/* popq	   %rbp */
-
-	INST8 (*codeptr, l, 0xc3);	/* retq */
-
+	INST32(*codeptr, l, cur_blk_nr_instrs);
 	CODE_FINAL(*codelen, l, *codeptr);
+#endif
+
+	plantReturn(codeptr, codelen);
 
 	/* Block is now complete.  Since it's x86, no need to synchronise I&D
 	 * caches (haha crikey), but on other backends here's where you'd do
@@ -421,11 +1461,14 @@ static void	finaliseBlock(block_t *block, u8 **codeptr, unsigned int *codelen)
 	 */
 }
 
-block_t *createBlock(PPCMMU *mmu, PPCCPUState *pcs)
+/* Generates a block at the PC, at the given tier (TIER_BLOCK or TIER_TRACE,
+ * see blockstore.h); one below TIER_TOP must then be given its tier_left.
+ */
+block_t *createBlock(PPCMMU *mmu, PPCCPUState *pcs, bool tracing, unsigned int tier)
 {
+	gen_tracing = tracing;
 retry:
 	VA pc = pcs->getPC();
-	VA block_start_pc = pc;
 	u32 inst;
 
 	PPCMMU::fault_t	fault;
@@ -448,6 +1491,10 @@ retry:
 	}
 
 	block_t *new_block = allocBlock(pc, pc_pa, pcs->getMSR(), &cur_codelen);
+	new_block->tier = tier;
+#if ENABLE_JIT_PERSIST
+	blockCacheStart();
+#endif
 
 	u8 *cur_codeptr = BLOCK_CODEPTR(new_block);
 	u8 *orig_codeptr = cur_codeptr;
@@ -458,34 +1505,80 @@ retry:
 
 	cur_blk_nr_instrs = 0;
 	cur_blk_size = 0;
+#if ENABLE_JIT_NATIVE
+	native_pc_lag = 0;
+#endif
 
 	startBlock(new_block, &cur_codeptr, &cur_codelen);
 
-	u8 *start_codeptr = cur_codeptr;
+#if ENABLE_JIT_CHAIN
+	new_block->entry_ofs = cur_codeptr - orig_codeptr;
+	bool chainable = true;
+#endif
+	if (tier < TIER_TOP)
+		plantTierCheck(new_block, &cur_codeptr, &cur_codelen);
+#if ENABLE_JIT_TRACE
+	trace_run_start[0] = pc;
+	trace_nr_runs = 1;
+	trace_ret = 0;
+#endif
+	VA lo_pc = pc, hi_pc = pc;
 
 	unsigned int limit = 1000;
 	do {
 		JITTRACE(" Generating for inst %08x (codeptr %p, len %d)\n",
 			 inst, cur_codeptr, cur_codelen);
+#if ENABLE_JIT_NATIVE
+		if (!gen_tracing && generateNative(inst, &cur_codeptr, &cur_codelen)) {
+			must_end_block = 0;
+		} else {
+			flushPC(&cur_codeptr, &cur_codelen);
+			noteBlockTicks(&cur_codeptr, &cur_codelen);
+			must_end_block = decodeInstrGenerateCall(inst, &cur_codeptr, &cur_codelen);
+		}
+#else
+		noteBlockTicks(&cur_codeptr, &cur_codelen);
 		must_end_block = decodeInstrGenerateCall(inst, &cur_codeptr, &cur_codelen);
+#endif
 		// if instr == CJ, backwards J or backwards NCB or rfi or sc then end block
 		// break
 		cur_blk_nr_instrs++;
-
-		if (oom_abort) {
-			resetBlockstore();
-			goto retry;
-		}
-		/* Currently, all control-flow instructions break the block. If
-		 * ever we run-on through branches etc., this next-PC needs to
-		 * get smart/er:
-		 */
-		pc += 4;
-		if ((pc & 0xfff) == 0) {
+#if ENABLE_JIT_CHAIN
+		if (changesContext(inst))
+			chainable = false;
+#endif
+
+		lo_pc = MIN(lo_pc, pc);
+		hi_pc = MAX(hi_pc, pc);
+
+		VA next_pc = pc + 4;
+#if ENABLE_JIT_TRACE
+		bool check;
+		VA other;
+		if (must_end_block == 1 && tier == TIER_TRACE &&
+		    traceFollow(inst, pc, &next_pc, &check, &other)) {
+			JITTRACE("--- Following branch to %08x\n", next_pc);
+			if (check) {
+#if ENABLE_JIT_CHAIN
+				if (!chainable)
+					other = 0;
+#endif
+				plantSideExit(new_block, next_pc, other, &cur_codeptr, &cur_codelen);
+			}
+			must_end_block = 0;
+		} else
+#endif
+		if ((next_pc & 0xfff) == 0) {
 			/* If crossed page boundary, break block */
 			COUNT(CTR_JIT_BLK_SPLIT_PAGE);
 			must_end_block = true;
 		}
+		pc = next_pc;
+
+		if (oom_abort) {
+			abandonBlock(new_block);
+			goto retry;
+		}
 
 		if (must_end_block) {
 			JITTRACE("--- Flagged block end (type %d)\n", must_end_block);
@@ -502,19 +1595,28 @@ retry:
 	 * instructions that /do/ run, and then next time round the runloop the
 	 * fault will be dealt with.
 	 */
-	if (false && must_end_block == 1) { /* Unused; naive approach is slower */
-		/* Ended on a branch:
-		 *
-	 	 * Plant a check to see if dynamic PC is start of block,
-		 * branching inline if so:
-		 */
-		plantBlockLoopCheck(block_start_pc, start_codeptr, &cur_codeptr, &cur_codelen);
+#if ENABLE_JIT_NATIVE
+	flushPC(&cur_codeptr, &cur_codelen);
+#endif
+#if ENABLE_JIT_CHAIN
+	unsigned int first_exit = new_block->nr_exits;
+	if (chainable && fault == PPCMMU::FAULT_NONE)
+		findBlockExits(new_block, inst, pc - 4, must_end_block);
+	plantBlockExits(new_block, first_exit, cur_blk_nr_instrs, &cur_codeptr, &cur_codelen);
+	if (oom_abort) {
+		abandonBlock(new_block);
+		goto retry;
 	}
-
+#endif
 	finaliseBlock(new_block, &cur_codeptr, &cur_codelen);
 
 	// Finally, update blockstore with nr bytes actually consumed:
-	amendBlockSize(new_block, orig_codelen - cur_codelen);
+	amendBlockSize(new_block, orig_codelen - cur_codelen, lo_pc & 0xfff, hi_pc + 4 - lo_pc);
+#if ENABLE_JIT_PERSIST
+	/* (Before anything's linked to its exits.) */
+	if (!tracing)
+		blockCacheSave(new_block);
+#endif
 
 	if (JITTRACING) {
 		JITTRACE("Block %p (PC %08x MSR %08x) len %d:\n",
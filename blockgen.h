@@ -27,6 +27,6 @@
 #include "blockstore.h"
 #include "types.h"
 
-block_t *createBlock(PPCMMU *mmu, PPCCPUState *pcs);
+block_t *createBlock(PPCMMU *mmu, PPCCPUState *pcs, bool tracing, unsigned int tier);
 
 #endif
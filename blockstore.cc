@@ -31,60 +31,152 @@
 #include "blockstore.h"
 #include "op_addrs.h"
 
-#define BS_CODE_SIZE	(4*1024*1024)
+#define BS_REGION_SIZE	(512*1024)
+#define BS_VENEER_SIZE	(64*1024)
 #define BS_FUMES	(1024)
 #define BS_GRACE	100
 
-static u8 block_buffer_storage[BS_CODE_SIZE + 4096];
+/* The code buffer is mmap'd:  a pool of veneers for far calls (see
+ * blockVeneer()), then the blocks.  Blocks are allocated in order through a
+ * ring of regions; when the one being filled is full, the next (holding the
+ * oldest blocks) is emptied and filling moves on to it.
+ */
 static u8 *block_buffer = 0;
-static u8 *block_buffer_last = 0;
+static u8 *block_buffer_last = 0;	/* Next allocation, in the current region */
+static u8 *bs_regions = 0;		/* First region, after the veneers */
+static unsigned int bs_nr_regions = 0;
+static unsigned int bs_cur_region = 0;
+static u8 **bs_region_last = 0;		/* End of each other region's blocks */
+static u64 bs_bytes_used = 0;
+static unsigned int bs_nr_blocks = 0;
 
 static block_t dummy_block;
-block_t *last_block = &dummy_block;
+block_t *bs_jump_cache[JC_ENTRIES];
 unsigned int bs_gencount = 0;
+static u64 bs_miss_pa = 0;		/* PA of the PC findBlock_slow() last missed */
 
 static const unsigned int headerlen = ALIGN_TO(sizeof(block_t), 64);
 
 
 /******************************************************************************/
-#define HTAB_ENTRIES	32768
-/* TODO: Multiply by a prime, measure efficiency... */
-#define HASH_IDX(va, msr)	((((va) >> 2) ^ ((va) >> 13) ^ (msr)) & (HTAB_ENTRIES - 1))
+/* Blocks are hashed by {PA, MSR}.  The table doubles whenever there are more
+ * blocks than buckets, so chains stay short however big the cache is.
+ */
+#define HTAB_MIN_BITS	12
+#define HTAB_MAX_BITS	22
 
-static block_t *bs_hashmap[HTAB_ENTRIES];
+static block_t **bs_hashmap = 0;
+static unsigned int bs_htab_bits = 0;
+static unsigned int bs_nr_hashed = 0;
 
-static inline void bs_hm_insert(PA pc_pa, u32 msr, block_t *block)
+/* Fibonacci hashing:  the top bits of a multiply by 2^64/phi depend on all
+ * of the key (the low bits of a PA don't vary much, and the MSR's hardly at
+ * all).
+ */
+static inline unsigned int bs_hash(u64 pc_pa, u32 msr)
 {
-	unsigned int i = HASH_IDX(pc_pa, msr);
-	block_t *b = bs_hashmap[i];
-	if (b) {
-		block->next = b; // FIXME: could just write this unconditionally.  ProfileMe.
+	return ((pc_pa ^ ((u64)msr << 40)) * 0x9e3779b97f4a7c15ULL) >> (64 - bs_htab_bits);
+}
+
+static void	bs_hm_alloc(unsigned int bits)
+{
+	bs_hashmap = (block_t **)calloc(1 << bits, sizeof(block_t *));
+	ASSERT(bs_hashmap);
+	bs_htab_bits = bits;
+	COUNT_SET(CTR_JIT_HASH_ENTRIES, 1 << bits);
+}
+
+static void	bs_hm_grow(void)
+{
+	block_t **old = bs_hashmap;
+	unsigned int old_entries = 1 << bs_htab_bits;
+
+	bs_hm_alloc(bs_htab_bits + 1);
+	for (unsigned int i = 0; i < old_entries; i++) {
+		block_t *n;
+
+		for (block_t *b = old[i]; b; b = n) {
+			unsigned int j = bs_hash(b->pc_pa, b->msr);
+
+			n = b->next;
+			b->next = bs_hashmap[j];
+			bs_hashmap[j] = b;
+		}
 	}
+	free(old);
+	JITTRACE("Block hash table grown to %d entries\n", 1 << bs_htab_bits);
+	COUNT(CTR_JIT_HASH_GROW);
+}
+
+static inline void bs_hm_insert(u64 pc_pa, u32 msr, block_t *block)
+{
+	if (++bs_nr_hashed > (1U << bs_htab_bits) && bs_htab_bits < HTAB_MAX_BITS)
+		bs_hm_grow();
+
+	unsigned int i = bs_hash(pc_pa, msr);
+	block->next = bs_hashmap[i];
 	bs_hashmap[i] = block;
 }
 
-static inline block_t *bs_hm_lookup(PA pc_pa, u32 msr)
+static inline block_t *bs_hm_lookup(u64 pc_pa, u32 msr)
 {
-	unsigned int i = HASH_IDX(pc_pa, msr);
+	unsigned int i = bs_hash(pc_pa, msr);
 	block_t *b = bs_hashmap[i];
 
-	bool firstTry = true;
+	/* Hits are counted by how far down the chain they are: */
+	unsigned int depth = 0;
 	while (b) {
+		depth++;
+		COUNT(CTR_JIT_HASH_PROBE);
 		if (b->pc_pa == pc_pa && b->msr == msr) {
-			last_block = b;
-			if (firstTry)
+			if (depth == 1)
 				COUNT(CTR_JIT_HASH_HIT_FIRST);
+			else if (depth == 2)
+				COUNT(CTR_JIT_HASH_HIT_SECOND);
 			else
-				COUNT(CTR_JIT_HASH_HIT);
+				COUNT(CTR_JIT_HASH_HIT_DEEP);
 			return b;
 		}
-		firstTry = false;
 		b = b->next;
 	}
 	COUNT(CTR_JIT_HASH_MISS);
 	return 0;
 }
 
+static inline void bs_hm_remove(block_t *block)
+{
+	block_t **p = &bs_hashmap[bs_hash(block->pc_pa, block->msr)];
+
+	for (; *p; p = &(*p)->next) {
+		if (*p == block) {
+			*p = block->next;
+			bs_nr_hashed--;
+			return;
+		}
+	}
+}
+
+/******************************************************************************/
+/* The jump cache, in front of all that, finds a block from just {VA, MSR}
+ * (see findBlock()).  That skips translating the PC, which is fine until the
+ * MMU's mappings change (as the gencount tracks), when it's flushed.  Blocks
+ * thrown away are taken out of it; empty entries point to dummy_block, which
+ * never matches.
+ */
+static void	jc_flush(void)
+{
+	for (unsigned int i = 0; i < JC_ENTRIES; i++)
+		bs_jump_cache[i] = &dummy_block;
+}
+
+static inline void jc_remove(block_t *b)
+{
+	block_t **e = &bs_jump_cache[JC_IDX(b->pc, b->msr)];
+
+	if (*e == b)
+		*e = &dummy_block;
+}
+
 block_t *findBlock_slow(PPCMMU *mmu, PPCCPUState *pcs, PPCMMU::fault_t *fault)
 {
 	/* First, make sure PC translates to a valid PA.  If it doesn't, it's
@@ -95,15 +187,20 @@ block_t *findBlock_slow(PPCMMU *mmu, PPCCPUState *pcs, PPCMMU::fault_t *fault)
 
 	/* See if the VA we're looking for is actually accessible.
 	 *
-	 * Can this be optimised out if we *know* there've been no TLBIs since
-	 * last time?  I don't think so, because HTAB is lossy and ISI/DSI could
-	 * Just Happen simply because some other lookup knocked something else
-	 * out of the HTAB.  Maybe if we know no faults have occurred either..?
-	 *
-	 * Note bs_gencount tracks MMU mapping changes; that isn't checked here
-	 * as we no longer empty the blockstore on mapping changes (yay!).
+	 * The jump cache skips this for a PC that's been translated since the
+	 * last mapping change (bs_gencount).  An OS knocking a PTE out of the
+	 * HTAB has to tlbie it, and until then a real CPU could still be using
+	 * it from its TLB, so that's legit.  The blockstore itself isn't
+	 * emptied on mapping changes (yay!), as blocks are found by PA.
 	 */
-	u64 pa;
+	if (mmu->getGenCount() != bs_gencount) {
+		jc_flush();
+		bs_gencount = mmu->getGenCount();
+		COUNT(CTR_JIT_JC_FLUSH);
+	}
+	COUNT(CTR_JIT_JC_MISS);
+
+	u64 pa = 0;
 	if (!mmu->translateAddr(pc, &pa, true, true, pcs->isPrivileged(), fault)) {
 		JITTRACE("findBlock: Translating PC %08x failed, fault %d\n", pc, *fault);
 		return 0;
@@ -113,17 +210,525 @@ block_t *findBlock_slow(PPCMMU *mmu, PPCCPUState *pcs, PPCMMU::fault_t *fault)
 	}
 
 	/* Blocks are indexed/matched by PA now: */
-	return bs_hm_lookup(pa, pcs->getMSR());
+	block_t *b = bs_hm_lookup(pa, pcs->getMSR());
+	if (b)
+		bs_jump_cache[JC_IDX(pc, b->msr)] = b;
+	else
+		bs_miss_pa = pa;
+	return b;
+}
+
+/******************************************************************************/
+/* Tiers (see runloop.cc):
+ *
+ * With JIT_TIER, a PC with no block is interpreted until it's been run from
+ * threshold times.  Runs are counted by {PA, MSR} in a direct-mapped table;
+ * a clash just starts the count again.  The count isn't reset when a block
+ * is made, so a block that's thrown away (e.g. evicted) is made again as
+ * soon as it's next run.
+ *
+ * Time spent at each tier (in TSC cycles) and compiling for it is gathered
+ * into counters.  Chained blocks run on into blocks of either JIT tier, so
+ * JIT time goes to the tier of the block entered from the runloop.
+ */
+#if ENABLE_JIT_TIER
+#define WARM_ENTRIES		8192
+#define WARM_IDX(pa, msr)	((((pa) >> 2) ^ ((msr) >> 4)) & (WARM_ENTRIES - 1))
+
+typedef struct {
+	u64 pc_pa;
+	u32 msr;
+	u32 runs;
+} warm_t;
+
+static warm_t bs_warm[WARM_ENTRIES];
+
+/* Counts a run from the PC findBlock() just missed; returns true once it's
+ * warm enough to compile:
+ */
+bool	warmBlock(u32 msr, unsigned int threshold)
+{
+	warm_t *w = &bs_warm[WARM_IDX(bs_miss_pa, msr)];
+
+	if (w->pc_pa != bs_miss_pa || w->msr != msr) {
+		w->pc_pa = bs_miss_pa;
+		w->msr = msr;
+		w->runs = 0;
+	}
+	if (w->runs >= threshold)
+		return true;
+	w->runs++;
+	return false;
+}
+#endif
+
+static u64 bs_tier_compile[NR_TIERS];
+static u64 bs_tier_run[NR_TIERS];
+
+void	tierCompiled(unsigned int tier, u64 cycles)
+{
+	bs_tier_compile[tier] += cycles;
+	if (tier == TIER_BLOCK) {
+		COUNT(CTR_JIT_TIER1_COMPILES);
+		COUNT_SET(CTR_JIT_TIER1_COMPILE_CYCLES, bs_tier_compile[tier]);
+	} else {
+		COUNT(CTR_JIT_TIER2_COMPILES);
+		COUNT_SET(CTR_JIT_TIER2_COMPILE_CYCLES, bs_tier_compile[tier]);
+	}
+}
+
+void	tierRan(unsigned int tier, u64 cycles)
+{
+	bs_tier_run[tier] += cycles;
+	if (tier == TIER_INTERP) {
+		COUNT(CTR_JIT_TIER0_RUNS);
+		COUNT_SET(CTR_JIT_TIER0_CYCLES, bs_tier_run[tier]);
+	} else if (tier == TIER_BLOCK) {
+		COUNT_SET(CTR_JIT_TIER1_CYCLES, bs_tier_run[tier]);
+	} else {
+		COUNT_SET(CTR_JIT_TIER2_CYCLES, bs_tier_run[tier]);
+	}
+}
+
+#if ENABLE_JIT_CHAIN
+/******************************************************************************/
+/* Block chaining:
+ *
+ * A block ending in a branch (or running on into the next instruction) to a
+ * PC known at generation time, and on the same page, gets an exit for each
+ * such PC (see plantBlockExits()).  That exit's jmp starts off going nowhere,
+ * i.e. falls through to returning its ID to the runloop; the runloop finds
+ * or generates the block for the new PC, then calls linkPendingBlock(),
+ * which points the jmp straight at that block.  After that, the blocks run
+ * one after another without returning, until the run horizon.
+ *
+ * Both blocks were entered at the same VA page with the same MSR, so (as
+ * the source block can't change the MMU context, see blockgen.cc) this is
+ * the block the runloop would have found.  Links are undone by
+ * unlinkBlock(), which must be used on any block thrown away individually
+ * (see discardBlock()); resetBlockstore() throws away all of them, links
+ * and all.
+ */
+static int bs_link_pending = 0;
+
+/* An exit's ID is its block's offset in the buffer (blocks are 64-aligned),
+ * plus one more than the exit number:
+ */
+int	blockExitID(block_t *b, unsigned int exit)
+{
+	return ((u8 *)b - block_buffer) + 1 + exit;
+}
+
+void	setBlockLinkPending(int id)
+{
+	bs_link_pending = id;
+}
+
+static void	patchExit(block_t *b, block_exit_t *e, block_t *to)
+{
+	u8 *jmp = BLOCK_CODEPTR(b) + e->jmp_ofs;
+	s32 rel = 0;
+
+	if (to)
+		rel = (BLOCK_CODEPTR(to) + to->entry_ofs) - (jmp + 5);
+	*(s32 *)(jmp + 1) = rel;
+}
+
+/* The block that's been found for the PC after a block returned with an exit
+ * ID:  link the exit to it, if it's the one the exit goes to.
+ */
+void	linkPendingBlock(block_t *to)
+{
+	int id = bs_link_pending;
+
+	if (!id)
+		return;
+	bs_link_pending = 0;
+
+	block_t *b = (block_t *)(block_buffer + ((id - 1) & ~63));
+	unsigned int exit = (id - 1) & 63;
+	block_exit_t *e = &b->exit[exit];
+
+	/* The exit's block might have been thrown away whilst it ran (so has
+	 * no exits left), or the PC might not be the exit's target by now
+	 * (e.g. an IRQ was taken in between):
+	 */
+	if (exit >= b->nr_exits || to->pc != e->target || to->msr != b->msr ||
+	    (to->pc_pa & ~0xfffULL) != (b->pc_pa & ~0xfffULL) || e->to)
+		return;
+
+	JITTRACE("Linking block %p exit %d (PC %08x) to block %p\n",
+		 b, exit, e->target, to);
+	e->to = to;
+	e->from = b;
+	e->next_in = to->links_in;
+	to->links_in = e;
+	patchExit(b, e, to);
+	COUNT(CTR_JIT_CHAIN_LINK);
+}
+
+/* Undo all links to and from b: */
+void	unlinkBlock(block_t *b)
+{
+	/* Exits jumping here go back to returning to the runloop: */
+	for (block_exit_t *e = b->links_in; e; e = e->next_in) {
+		patchExit(e->from, e, 0);
+		e->to = 0;
+	}
+	b->links_in = 0;
+
+	/* ...and b's own exits come off the lists of the blocks they jump to: */
+	for (unsigned int i = 0; i < b->nr_exits; i++) {
+		block_exit_t *e = &b->exit[i];
+
+		if (!e->to)
+			continue;
+		for (block_exit_t **p = &e->to->links_in; *p; p = &(*p)->next_in) {
+			if (*p == e) {
+				*p = e->next_in;
+				break;
+			}
+		}
+		patchExit(b, e, 0);
+		e->to = 0;
+	}
+	COUNT(CTR_JIT_CHAIN_UNLINK);
+}
+#endif
+
+/******************************************************************************/
+/* Self-modifying code:
+ *
+ * Each host page that blocks have been generated from has a bitmap of the
+ * instruction words translated, and a list of those blocks.  The blockstore
+ * is the MMU's code cache (see AbstractCodeCache.h), so the uTLB entries of
+ * these pages are marked, taking stores to them off the fast paths (the
+ * JIT's inline one included) and reporting them to invalidateRange().  A
+ * store to translated words throws away just the blocks holding them;
+ * stores to the rest of the page (e.g. data sharing it with code) find no
+ * bits set, and cost nothing more.  A block that's a trace through several
+ * runs of code (see createBlock()) claims the whole span, from its lowest
+ * instruction to its highest.
+ *
+ * A block thrown away is unhashed and unlinked, but its code stays put
+ * until the next reset, as it might be the one running.  (A block storing
+ * into itself runs on to its end, which is fine:  modified code needn't be
+ * seen until after an isync.)
+ */
+#define BS_CODE_PAGES		4096
+#define CP_HTAB_ENTRIES		1024
+#define CP_HASH_IDX(hp)		(((hp) >> 12) & (CP_HTAB_ENTRIES - 1))
+
+typedef struct _code_page {
+	u64 host_page;
+	struct _code_page *next;	/* Hash chain, or free list */
+	block_t *blocks;
+	u32 words[1024/32];		/* Bit per instruction word translated */
+} code_page_t;
+
+static code_page_t bs_code_pages[BS_CODE_PAGES];
+static code_page_t *bs_free_code_pages = 0;
+static code_page_t *bs_cp_hashmap[CP_HTAB_ENTRIES];
+static PPCMMU *bs_mmu = 0;
+
+static code_page_t *findCodePage(u64 host_page)
+{
+	for (code_page_t *p = bs_cp_hashmap[CP_HASH_IDX(host_page)]; p; p = p->next) {
+		if (p->host_page == host_page)
+			return p;
+	}
+	return 0;
+}
+
+static void	markCodeWords(code_page_t *p, block_t *b)
+{
+	unsigned int first = b->guest_ofs >> 2;
+
+	for (unsigned int i = first; i < first + b->guest_len/4; i++)
+		p->words[i / 32] |= 1 << (i % 32);
+}
+
+/* Any translated words in [start, end), which is within p? */
+static bool	testCodeWords(code_page_t *p, u64 start, u64 end)
+{
+	for (unsigned int i = (start & 0xfff) >> 2; i <= ((end - 1) & 0xfff) >> 2; i++) {
+		if (p->words[i / 32] & (1 << (i % 32)))
+			return true;
+	}
+	return false;
+}
+
+/* A newly-generated block goes on its page's list: */
+static void	addCodeBlock(block_t *b)
+{
+	/* Stores to IO aren't seen, so there's nothing to watch: */
+	if (b->pc_pa & PPCMMU_HVA_IO_BIT)
+		return;
+
+	u64 host_page = b->pc_pa & ~0xfffULL;
+	code_page_t *p = findCodePage(host_page);
+
+	if (!p) {
+		/* allocBlock() made sure there's one free: */
+		p = bs_free_code_pages;
+		bs_free_code_pages = p->next;
+		p->host_page = host_page;
+		p->blocks = 0;
+		memset(p->words, 0, sizeof(p->words));
+		p->next = bs_cp_hashmap[CP_HASH_IDX(host_page)];
+		bs_cp_hashmap[CP_HASH_IDX(host_page)] = p;
+		/* uTLB entries already mapping it start reporting stores: */
+		bs_mmu->watchCodePage(host_page);
+	}
+	b->next_in_page = p->blocks;
+	p->blocks = b;
+	markCodeWords(p, b);
+}
+
+/* The page has no blocks left, so can be reused: */
+static void	freeCodePage(code_page_t *p)
+{
+	for (code_page_t **pp = &bs_cp_hashmap[CP_HASH_IDX(p->host_page)]; *pp; pp = &(*pp)->next) {
+		if (*pp == p) {
+			*pp = p->next;
+			break;
+		}
+	}
+	p->next = bs_free_code_pages;
+	bs_free_code_pages = p;
+}
+
+/* Take a block off its page's list, when it's evicted: */
+static void	removeCodeBlock(block_t *b)
+{
+	if (b->pc_pa & PPCMMU_HVA_IO_BIT)
+		return;
+
+	code_page_t *p = findCodePage(b->pc_pa & ~0xfffULL);
+	memset(p->words, 0, sizeof(p->words));
+	for (block_t **bp = &p->blocks; *bp; ) {
+		if (*bp == b) {
+			*bp = b->next_in_page;
+		} else {
+			markCodeWords(p, *bp);
+			bp = &(*bp)->next_in_page;
+		}
+	}
+	if (!p->blocks)
+		freeCodePage(p);
+}
+
+/* Makes b unreachable.  It's then dead (guest_len is 0), but its code is
+ * there until its region's evicted.
+ */
+static void	discardBlock(block_t *b)
+{
+	JITTRACE("Discarding block %p (PC %08x)\n", b, b->pc);
+	bs_hm_remove(b);
+	jc_remove(b);
+#if ENABLE_JIT_CHAIN
+	unlinkBlock(b);
+	/* Nor is it linked again, e.g. by the exit it's about to return: */
+	b->nr_exits = 0;
+#endif
+	b->guest_len = 0;
+	bs_nr_blocks--;
+}
+
+/* b is to be made again, at a higher tier: */
+void	retireBlock(block_t *b)
+{
+	removeCodeBlock(b);
+	discardBlock(b);
+	COUNT(CTR_JIT_TIER_UP);
+	COUNT_SET(CTR_JIT_CACHE_BLOCKS, bs_nr_blocks);
+}
+
+/* [host_addr, host_addr+len) is being written: */
+static void	invalidateRange(u64 host_addr, unsigned int len)
+{
+	u64 end = host_addr + len;
+
+	for (u64 a = host_addr; a < end; a = (a & ~0xfffULL) + 0x1000) {
+		code_page_t *p = findCodePage(a & ~0xfffULL);
+		u64 page_end = MIN(end, (a & ~0xfffULL) + 0x1000);
+
+		if (!p || !testCodeWords(p, a, page_end))
+			continue;
+
+		/* Blocks overlapping the range go, and the bitmap is rebuilt
+		 * from the rest (as blocks can overlap each other):
+		 */
+		memset(p->words, 0, sizeof(p->words));
+		for (block_t **bp = &p->blocks; *bp; ) {
+			block_t *b = *bp;
+
+			u64 g = (b->pc_pa & ~0xfffULL) + b->guest_ofs;
+
+			if (g < page_end && g + b->guest_len > a) {
+				*bp = b->next_in_page;
+				discardBlock(b);
+				COUNT(CTR_JIT_BLK_INVAL);
+			} else {
+				markCodeWords(p, b);
+				bp = &b->next_in_page;
+			}
+		}
+		if (!p->blocks)
+			freeCodePage(p);
+	}
+	COUNT_SET(CTR_JIT_CACHE_BLOCKS, bs_nr_blocks);
+}
+
+/* Nothing's found or linked to any more, though the code's still there: */
+static void	forgetBlocks(void)
+{
+	jc_flush();
+#if ENABLE_JIT_CHAIN
+	bs_link_pending = 0;
+#endif
+
+	/* Reset hashmaps */
+	memset(bs_hashmap, 0, sizeof(block_t *) << bs_htab_bits);
+	bs_nr_hashed = 0;
+	memset(bs_cp_hashmap, 0, sizeof(bs_cp_hashmap));
+	bs_free_code_pages = 0;
+	for (unsigned int i = 0; i < BS_CODE_PAGES; i++) {
+		bs_code_pages[i].next = bs_free_code_pages;
+		bs_free_code_pages = &bs_code_pages[i];
+	}
+	bs_nr_blocks = 0;
+	COUNT_SET(CTR_JIT_CACHE_BLOCKS, 0);
+}
+
+static u8	*regionStart(unsigned int r)
+{
+	return bs_regions + (size_t)r * BS_REGION_SIZE;
+}
+
+static u8	*regionEnd(unsigned int r)
+{
+	return (r == bs_cur_region) ? block_buffer_last : bs_region_last[r];
+}
+
+static u8	*nextBlock(u8 *p)
+{
+	return (u8 *)ALIGN_TO(p + headerlen + ((block_t *)p)->codelen, 64);
+}
+
+/* E.g. the I-cache is invalidated.  This can happen from a block, so the
+ * code has to stay put, like discardBlock():  no block can be found or
+ * chained to, but the buffer's only reused after the next reset.
+ */
+static void	invalidateAll(void)
+{
+	for (unsigned int r = 0; r < bs_nr_regions; r++) {
+		for (u8 *p = regionStart(r); p < regionEnd(r); p = nextBlock(p)) {
+			block_t *b = (block_t *)p;
+
+#if ENABLE_JIT_CHAIN
+			for (unsigned int i = 0; i < b->nr_exits; i++) {
+				patchExit(b, &b->exit[i], 0);
+				b->exit[i].to = 0;
+			}
+			b->nr_exits = 0;
+			b->links_in = 0;
+#endif
+			b->guest_len = 0;
+		}
+	}
+	forgetBlocks();
+	COUNT(CTR_JIT_INVAL_ALL);
+}
+
+/* The MMU's code cache before the blockstore took over (i.e. the
+ * interpreter's predecoded pages, which tiering runs from) is told too:
+ */
+class BlockStoreCodeCache : public AbstractCodeCache
+{
+public:
+	AbstractCodeCache *prev;
+
+	BlockStoreCodeCache() : prev(0) {}
+
+	bool	isCodePage(u64 host_page)
+	{
+		return findCodePage(host_page) != 0 || (prev && prev->isCodePage(host_page));
+	}
+	void	invalidateHostRange(u64 host_addr, unsigned int len)
+	{
+		invalidateRange(host_addr, len);
+		if (prev)
+			prev->invalidateHostRange(host_addr, len);
+	}
+	void	invalidateAll()
+	{
+		::invalidateAll();
+		if (prev)
+			prev->invalidateAll();
+	}
+};
+
+static BlockStoreCodeCache bs_code_cache;
+
+/******************************************************************************/
+/* Allocation and eviction: */
+
+/* Empty region r (the oldest) for reuse.  This happens between blocks, so
+ * the code can go, unlike with discardBlock() alone.
+ */
+static void	evictRegion(unsigned int r)
+{
+	u8 *start = regionStart(r);
+	u8 *end = regionEnd(r);
+
+	if (start == end)
+		return;
+#if ENABLE_JIT_CHAIN
+	/* An exit waiting to be linked might be in one of them: */
+	u8 *pending = block_buffer + ((bs_link_pending - 1) & ~63);
+	if (bs_link_pending && pending >= start && pending < end)
+		bs_link_pending = 0;
+#endif
+	for (u8 *p = start; p < end; p = nextBlock(p)) {
+		block_t *b = (block_t *)p;
+
+		/* Already dead, if thrown away by a store: */
+		if (!b->guest_len)
+			continue;
+		removeCodeBlock(b);
+		discardBlock(b);
+		COUNT(CTR_JIT_EVICT_BLOCK);
+	}
+	bs_bytes_used -= end - start;
+	bs_region_last[r] = start;
+	COUNT(CTR_JIT_EVICT_REGION);
+	COUNT_SET(CTR_JIT_CACHE_BYTES, bs_bytes_used);
+	COUNT_SET(CTR_JIT_CACHE_BLOCKS, bs_nr_blocks);
+}
+
+/* Move allocation on to the next region, evicting what's there: */
+static void	nextRegion(void)
+{
+	unsigned int next = (bs_cur_region + 1) % bs_nr_regions;
+
+	JITTRACE("Moving on to region %d\n", next);
+	bs_region_last[bs_cur_region] = block_buffer_last;
+	evictRegion(next);
+	bs_cur_region = next;
+	block_buffer_last = regionStart(next);
 }
 
 static void _resetBlockstore(void)
 {
 	/* Reset allocator */
-	block_buffer_last = block_buffer;
-	last_block = &dummy_block;
-
-	/* Reset hashmap */
-	memset(bs_hashmap, 0, sizeof(bs_hashmap));
+	for (unsigned int r = 0; r < bs_nr_regions; r++)
+		bs_region_last[r] = regionStart(r);
+	bs_cur_region = 0;
+	block_buffer_last = regionStart(0);
+	bs_bytes_used = 0;
+	COUNT_SET(CTR_JIT_CACHE_BYTES, 0);
+	forgetBlocks();
 }
 
 void resetBlockstore(void)
@@ -133,16 +738,17 @@ void resetBlockstore(void)
 }
 
 /* Allocates a block_t and finds space in the code buffer to begin generating
- * code to.  Note that our sophisticated "fuck it all" cleanup policy means that
- * the code buffer simply grows and is reset to empty if space is exhausted.
+ * code to.  The current region simply fills up, then the next (oldest) one is
+ * evicted and filled, and so on round (likewise if there's no room to track
+ * another code page).
  * Thus this returns the number of bytes free at the time of this allocation,
  * assuming that generation will immediately follow.  Generation then calls
- * amendBlockSize with the amount of real space used.  Don't call this without
- * following with amendBlockSize().
+ * amendBlockSize with the amount of real space used, or abandonBlock() if
+ * there wasn't enough.  Don't call this without following with one of those.
  *
  * A block_t is immediately followed by the generated code.  Keep block_t a multiple of CL!
  */
-block_t *allocBlock(VA pc, PA pc_pa, u32 msr, unsigned int *bytes_avail)
+block_t *allocBlock(VA pc, u64 pc_pa, u32 msr, unsigned int *bytes_avail)
 {
 	// FIXME: Assert the block's not found
 retry:
@@ -150,9 +756,11 @@ retry:
 	 * there isn't, there's no point starting to generate the block and then
 	 * failing then.  This number is art not science:
 	 */
-	if ((block_buffer_last - block_buffer) > (BS_CODE_SIZE - BS_FUMES)) {
-		JITTRACE("Block buffer exhausted\n");
-		resetBlockstore();
+	u8 *region_end = regionStart(bs_cur_region) + BS_REGION_SIZE;
+
+	if (region_end - block_buffer_last < BS_FUMES || !bs_free_code_pages) {
+		JITTRACE("Region %d exhausted\n", bs_cur_region);
+		nextRegion();
 		goto retry;
 	}
 
@@ -163,39 +771,124 @@ retry:
 	b->pc_pa = pc_pa;	/* This is the primary index */
 	b->msr = msr;
 	b->codelen = 0;
+	b->guest_ofs = 0;
+	b->guest_len = 0;
 	b->next = 0;
+	b->next_in_page = 0;
+	b->tier = TIER_TOP;
+	b->tier_left = 0;
+#if ENABLE_JIT_CHAIN
+	b->entry_ofs = 0;
+	b->nr_exits = 0;
+	b->links_in = 0;
+#endif
 	bs_hm_insert(pc_pa, msr, b);
 
-	*bytes_avail = BS_CODE_SIZE - BS_GRACE - (block_buffer_last - block_buffer) - headerlen;
+	*bytes_avail = region_end - block_buffer_last - headerlen - BS_GRACE;
 
 	return b;
 }
 
-void 	amendBlockSize(block_t *b, unsigned int real_size)
+void 	amendBlockSize(block_t *b, unsigned int real_size, unsigned int guest_ofs, unsigned int guest_len)
 {
-	block_buffer_last += headerlen + real_size;
 	b->codelen = real_size;
+	b->guest_ofs = guest_ofs;
+	b->guest_len = guest_len;
+	addCodeBlock(b);
 
 	/* CL-align next allocation: */
-	block_buffer_last = (u8 *)ALIGN_TO(block_buffer_last, 64);
+	u8 *next = nextBlock(block_buffer_last);
+	bs_bytes_used += next - block_buffer_last;
+	block_buffer_last = next;
+	bs_nr_blocks++;
+	COUNT_SET(CTR_JIT_CACHE_BYTES, bs_bytes_used);
+	COUNT_SET(CTR_JIT_CACHE_BLOCKS, bs_nr_blocks);
+}
+
+/* Generating b ran out of space:  drop it, and move on to the next region so
+ * that the retry has a whole one.
+ */
+void	abandonBlock(block_t *b)
+{
+	bs_hm_remove(b);
+	if ((u8 *)b == regionStart(bs_cur_region))
+		FATAL("Block for PC %08x doesn't fit in a region\n", b->pc);
+	COUNT(CTR_JIT_BLK_ABANDON);
+	nextRegion();
+}
+
+/******************************************************************************/
+/* Veneers:
+ *
+ * Blocks call handlers with a rel32 callq, which can't reach if the buffer
+ * was mapped more than 2GB from .text.  Those calls go via a veneer in the
+ * pool at the start of the buffer (always in reach), which jumps on to the
+ * absolute address.  There are only as many as there are handlers called,
+ * so they're never freed.
+ */
+#define VENEER_SIZE		16
+#define VENEER_HTAB_ENTRIES	(2*BS_VENEER_SIZE/VENEER_SIZE)
+
+static u64 bs_veneer_dest[VENEER_HTAB_ENTRIES];
+static u8 *bs_veneer[VENEER_HTAB_ENTRIES];
+static unsigned int bs_nr_veneers = 0;
+
+u8	*blockVeneer(u64 dest)
+{
+	unsigned int i = (dest >> 4) & (VENEER_HTAB_ENTRIES - 1);
+
+	while (bs_veneer_dest[i] && bs_veneer_dest[i] != dest)
+		i = (i + 1) & (VENEER_HTAB_ENTRIES - 1);
+	if (bs_veneer_dest[i])
+		return bs_veneer[i];
+
+	if (bs_nr_veneers == BS_VENEER_SIZE/VENEER_SIZE)
+		FATAL("Out of JIT veneers (calling %p)\n", (void *)dest);
+	u8 *v = block_buffer + bs_nr_veneers++ * VENEER_SIZE;
+	v[0] = 0xff;	/* jmpq    *0(%rip) */
+	v[1] = 0x25;
+	*(u32 *)&v[2] = 0;
+	*(u64 *)&v[6] = dest;
+
+	bs_veneer_dest[i] = dest;
+	bs_veneer[i] = v;
+	COUNT(CTR_JIT_VENEER);
+	return v;
 }
 
-void	initBlockStore(void)
+void	initBlockStore(PPCMMU *mmu, unsigned int cache_mb)
 {
-	block_buffer = (u8 *)ALIGN_TO(block_buffer_storage, 4096);
-	mprotect(block_buffer, BS_CODE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC);
-	JITTRACE("Block buffer is at %p, blockstore starts at %p (%d bytes)\n",
-		 block_buffer_storage, block_buffer, BS_CODE_SIZE);
+	/* Exit IDs are offsets into the buffer, so it can't be huge: */
+	if (cache_mb < 1 || cache_mb > 1024)
+		FATAL("JIT code cache size %dMB out of range (1-1024MB)\n", cache_mb);
+	bs_nr_regions = MAX(((size_t)cache_mb << 20) / BS_REGION_SIZE, 2);
+	size_t size = BS_VENEER_SIZE + (size_t)bs_nr_regions * BS_REGION_SIZE;
+
+	/* Ask for somewhere just below .text, so calls can mostly reach
+	 * directly.  If it ends up elsewhere, calls go via veneers.
+	 */
+	u64 text = (u64)get_op_unk() & ~0xfffffULL;
+	void *hint = (text > size + (64 << 20)) ? (void *)(text - size - (32 << 20)) : 0;
+
+	block_buffer = (u8 *)mmap(hint, size, PROT_READ | PROT_WRITE | PROT_EXEC,
+				  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (block_buffer == MAP_FAILED)
+		FATAL("Can't map %dMB JIT code cache\n", cache_mb);
+	bs_regions = block_buffer + BS_VENEER_SIZE;
+	bs_region_last = (u8 **)calloc(bs_nr_regions, sizeof(u8 *));
+	ASSERT(bs_region_last);
+	JITTRACE("Block buffer is at %p (%d regions of %d bytes), .text at %p\n",
+		 block_buffer, bs_nr_regions, BS_REGION_SIZE, get_op_unk());
 
 	/* dummy_block is intended to be a never-match */
 	dummy_block.pc = ~0;
 	dummy_block.msr = ~0;
+	bs_hm_alloc(HTAB_MIN_BITS);
 
-	/* Ensure blockstore is close enough to fns it needs to call: */
-	if (labs((s64)get_op_unk() - (s64)block_buffer) > 0x80000000) {
-		FATAL("Block buffer is too far from .txt, e.g. buffer at %p, fn at %p\n",
-		      block_buffer, get_op_unk());
-	}
+	/* Stores to code are reported back, see invalidateRange(): */
+	bs_mmu = mmu;
+	bs_code_cache.prev = mmu->getCodeCache();
+	mmu->setCodeCache(&bs_code_cache);
 
 	_resetBlockstore();
 }
@@ -24,6 +24,8 @@
 #ifndef BLOCKSTORE_H
 #define BLOCKSTORE_H
 
+#include <x86intrin.h>
+
 #include "PPCInterpreter.h"
 #include "PPCCPUState.h"
 #include "PPCMMU.h"
@@ -36,39 +38,132 @@ extern "C" {
 	typedef int (*block_fn_t)(PPCInterpreter *);
 }
 
+/* Tiers code is run at:  interpreted, plain blocks, then (with JIT_TRACE)
+ * traces.  Without JIT_TIER, blocks are generated at the top tier straight
+ * away; with it, code climbs as it gets hotter (see runloop.cc).
+ */
+enum {
+	TIER_INTERP = 0,
+	TIER_BLOCK,
+	TIER_TRACE,
+	NR_TIERS
+};
+
+#if ENABLE_JIT_TRACE
+#define TIER_TOP	TIER_TRACE
+#else
+#define TIER_TOP	TIER_BLOCK
+#endif
+
+#if ENABLE_JIT_CHAIN
+/* Two for the end of the block, plus any for a trace's side exits: */
+#if ENABLE_JIT_TRACE
+#define BLOCK_EXITS	4
+#else
+#define BLOCK_EXITS	2
+#endif
+
+/* An exit from a block to a known next PC, which can be patched to jump
+ * straight to the block there (see blockgen.cc):
+ */
+typedef struct _block_exit {
+	VA target;
+	unsigned int jmp_ofs;		/* The jmp to patch, from BLOCK_CODEPTR */
+	struct _block *from;		/* Block it's in, once linked */
+	struct _block *to;		/* Block linked to, or 0 */
+	struct _block_exit *next_in;	/* Other exits linked to the same block */
+} block_exit_t;
+#endif
+
 struct _block {
 	struct _block *next;
 	/* Match state */
 	VA pc;
-	PA pc_pa;
+	u64 pc_pa;			/* As translateAddr() gives, i.e. host VA for RAM */
 	u32 msr;
 	unsigned int codelen;
+	unsigned int guest_ofs;		/* Page offset of the first guest instruction translated */
+	unsigned int guest_len;		/* Bytes spanned by those translated, from guest_ofs */
+	struct _block *next_in_page;	/* Other blocks from the same code page */
+	unsigned int tier;
+	u32 tier_left;			/* Runs until recompiled at the next tier, if below TIER_TOP */
+#if ENABLE_JIT_CHAIN
+	unsigned int entry_ofs;		/* Where chained blocks jump in, past the prologue */
+	unsigned int nr_exits;
+	block_exit_t exit[BLOCK_EXITS];
+	block_exit_t *links_in;		/* Exits of other blocks that jump here */
+#endif
 };
 
 typedef struct _block block_t;
 
 #define BLOCK_CODEPTR(x)	( ((u8 *)(x)) + ALIGN_TO(sizeof(block_t), 64) )
 
-extern block_t *last_block;
+#define JC_ENTRIES		4096
+#define JC_IDX(pc, msr)		((((pc) >> 2) ^ ((msr) >> 4)) & (JC_ENTRIES - 1))
+
+extern block_t *bs_jump_cache[JC_ENTRIES];
 extern unsigned int bs_gencount;
 
 block_t *findBlock_slow(PPCMMU *mmu, PPCCPUState *pcs, PPCMMU::fault_t *fault);
-block_t *allocBlock(VA pc, PA pc_pa, u32 msr, unsigned int *bytes_avail);
-void 	amendBlockSize(block_t *b, unsigned int real_size);
-void	initBlockStore(void);
+block_t *allocBlock(VA pc, u64 pc_pa, u32 msr, unsigned int *bytes_avail);
+void 	amendBlockSize(block_t *b, unsigned int real_size, unsigned int guest_ofs, unsigned int guest_len);
+void	abandonBlock(block_t *b);
+void	retireBlock(block_t *b);
+u8	*blockVeneer(u64 dest);
+void	initBlockStore(PPCMMU *mmu, unsigned int cache_mb);
 void 	resetBlockstore(void);
 
+/* rel32 for a callq at here (relative to the end of its 5 bytes), via a
+ * veneer if dest is out of reach:
+ */
+static inline s32	blockCallRel(u8 *here, u64 dest)
+{
+	s64 r = (intptr_t)dest - (intptr_t)here - 5;
+
+	if (r != (s32)r)
+		r = (intptr_t)blockVeneer(dest) - (intptr_t)here - 5;
+	return r;
+}
+
+#if ENABLE_JIT_CHAIN
+int	blockExitID(block_t *b, unsigned int exit);
+void	setBlockLinkPending(int id);
+void	linkPendingBlock(block_t *to);
+void	unlinkBlock(block_t *b);
+#endif
+
 static inline block_t *findBlock(PPCMMU *mmu, PPCCPUState *pcs, PPCMMU::fault_t *fault)
 {
 	/* This quick shortcut does depend on MMU config staying the same.  If
-	 * the gc has changed, don't do this and fall back to the old lookup.
+	 * the gc has changed, don't do this and fall back to the old lookup
+	 * (which flushes the jump cache).
 	 */
-	if (mmu->getGenCount() == bs_gencount &&
-	    last_block->pc == pcs->getPC() &&
-	    last_block->msr == pcs->getMSR())
-		return last_block;
-	else
-		return findBlock_slow(mmu, pcs, fault);
+	VA pc = pcs->getPC();
+	u32 msr = pcs->getMSR();
+	block_t *b = bs_jump_cache[JC_IDX(pc, msr)];
+
+	if (mmu->getGenCount() == bs_gencount && b->pc == pc && b->msr == msr) {
+		COUNT(CTR_JIT_JC_HIT);
+		return b;
+	}
+	return findBlock_slow(mmu, pcs, fault);
+}
+
+#if ENABLE_JIT_TIER
+bool	warmBlock(u32 msr, unsigned int threshold);
+#endif
+void	tierCompiled(unsigned int tier, u64 cycles);
+void	tierRan(unsigned int tier, u64 cycles);
+
+/* Timestamp for the per-tier counters: */
+static inline u64	tierClock(void)
+{
+#if ENABLE_COUNTERS > 0
+	return __rdtsc();
+#else
+	return 0;
+#endif
 }
 
 #endif
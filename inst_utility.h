@@ -27,11 +27,11 @@
 #ifndef INST_UTILITY_H
 #define INST_UTILITY_H
 
-/* Arithmetic 'dot' instructions set CR0 with a comparison to 0: */
+/* Arithmetic 'dot' instructions set CR0 with a comparison to 0 (and
+ * XER.SO); this might be evaluated lazily, see PPCCPUState::setCR0Result().
+ */
 #define SET_CR0(x) 		do {		  \
-		u32 cr = READ_CR();		  \
-		WRITE_CR_FIELD(cr, 0, CMP(x, 0)); \
-		WRITE_CR(cr);			  \
+		cpus->setCR0Result(x);		  \
 	} while(0)
 
 /* Set XER.OV and OR the flag into XER.SO: */
@@ -81,21 +81,27 @@
  *   1  0  0   0
  *   1  0  1   0
  *
- * TODO: Investigate whether inline asm (on hosts that support
- * carry/OV flags) makes a useful difference.
- *
+ * Rather than doing all of that by hand, the host's overflow builtins
+ * give carry-out (unsigned) and overflow (signed) directly, which
+ * usually come straight from the host's flags.  The carry-in is a
+ * second add; at most one of the two adds can carry out, and the
+ * overall result overflows if exactly one of the two signed adds did
+ * (e.g. 0x80000000 + 0xffffffff + 1 overflows in the first add and back
+ * again in the second, but -0x80000000 is representable).
  */
 #define ADD_OV_CO_CI(val, ov, co, a, b, ci)	do {			\
-	REG ia = (a);							\
-	REG ib = (b);							\
-	REG ic = (ci);							\
-	u64 r = (u64)ia + (u32)ib + (u32)ic;				\
-	co = (r & 0x100000000) ? 1 : 0;					\
-	val = r & 0xffffffff;						\
-	/* Calc OVF */							\
-	u32 ra = (u32)r;						\
-	ov = ( !(ia & 0x80000000) && !(ib & 0x80000000) &&  (ra & 0x80000000) ) || \
-		(  (ia & 0x80000000) &&  (ib & 0x80000000) && !(ra & 0x80000000) ); \
+	u32 ia = (a);							\
+	u32 ib = (b);							\
+	u32 ic = (ci);							\
+	u32 r1, r2;							\
+	s32 s1, s2;							\
+	bool c1 = __builtin_add_overflow(ia, ib, &r1);			\
+	bool c2 = __builtin_add_overflow(r1, ic, &r2);			\
+	bool o1 = __builtin_add_overflow((s32)ia, (s32)ib, &s1);	\
+	bool o2 = __builtin_add_overflow(s1, (s32)ic, &s2);		\
+	val = r2;							\
+	co = c1 | c2;							\
+	ov = o1 ^ o2;							\
 	} while(0)
 
 #define ADD_CO(val, co, a, b)			do { u32 d; ADD_OV_CO_CI(val, d, co, a, b, 0); } while(0)
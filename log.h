@@ -37,13 +37,23 @@
 #define LOG_FLAG_EXC_TRACE	64
 #define LOG_FLAG_JIT_TRACE	128
 
+/* The interpreter's op_xxx() handlers are built in two variants: one with
+ * DISASS()/BRTRACE() compiled in, and one without, selected by a
+ * trace_variant template parameter that shadows this.  Everything else
+ * always gets the (runtime-checked) tracing variant.  The run loop picks the
+ * tracing variant only when one of these flags is on:
+ */
+static const bool trace_variant = true;
+#define LOG_INTERP_TRACE_FLAGS	(LOG_FLAG_DISASS | LOG_FLAG_BRANCH_TRACE)
+#define LOG_INTERP_TRACING	(!!(log_enables_mask & LOG_INTERP_TRACE_FLAGS))
+
 #define LOG_MSG 	""
 #define LOG_WARN	"WARN: "
 #define LOG_FATAL	"ERROR: "
 
 #if ENABLE_TRACING > 0
 #define DEBUG(x...)	do { if (log_enables_mask & LOG_FLAG_DBG) { lprintf( x ); } } while (0)
-#define DISASS(x...)	do { if (log_enables_mask & LOG_FLAG_DISASS) { lprintf( x ); } } while (0)
+#define DISASS(x...)	do { if (trace_variant && (log_enables_mask & LOG_FLAG_DISASS)) { lprintf( x ); } } while (0)
 #define STRACE(x...)	do { if (log_enables_mask & LOG_FLAG_STRACE) { lprintf( "+++ STRACE " x ); } } while (0)
 #define IOTRACE(x...)	do { if (log_enables_mask & LOG_FLAG_IO_TRACE) { lprintf( "+++ IO " x ); } } while (0)
 #define MMUTRACE(x...)	do { if (log_enables_mask & LOG_FLAG_MMU_TRACE) { lprintf( "+++ MMU " x ); } } while (0)
@@ -63,7 +73,7 @@
 #define LOG(x...)	do { lprintf( LOG_MSG x ); } while (0)
 #define WARN(x...)	do { lprintf( LOG_WARN x); } while (0)
 #define FATAL(x...)	do { lprintf( LOG_FATAL x); sim_quit(); } while (0)
-#define BRTRACE(x...)	do { if (log_enables_mask & LOG_FLAG_BRANCH_TRACE) { lprintf( "+++ BR " x ); } } while (0)
+#define BRTRACE(x...)	do { if (trace_variant && (log_enables_mask & LOG_FLAG_BRANCH_TRACE)) { lprintf( "+++ BR " x ); } } while (0)
 
 void 	log_init(void);
 
@@ -33,6 +33,7 @@
 #include "platform.h"
 #include "PPCInterpreter.h"
 #include "blockstore.h"
+#include "blockcache.h"
 #include "runloop.h"
 #include "sim_state.h"
 
@@ -79,6 +80,22 @@ void 	sim_quit(void)
 	exit(1);
 }
 
+/* Run instructions up to the run horizon, with the given variant of the
+ * interpreter (see log.h):
+ */
+template <bool trace_variant>
+static void	run_batch(PPCInterpreter *interp, PPCCPUState *pcs)
+{
+	do {
+#if ENABLE_THREADED
+		interp->execute_threaded<trace_variant>();
+#else
+		interp->execute<trace_variant>();
+		pcs->CPUTick();
+#endif
+	} while (!pcs->runHorizonReached());
+}
+
 int 	main(int argc, char *argv[])
 {
 	////////////////////////////// General init
@@ -115,6 +132,8 @@ int 	main(int argc, char *argv[])
 	mmu.setBus(&bus);
 	interp.setMMU(&mmu);
 	pcs.setMMU(&mmu);
+	/* Start in the context given by the initial MSR: */
+	mmu.setMode(pcs.isPrivileged(), pcs.getMSR() & MSR_IR, pcs.getMSR() & MSR_DR);
 
 	LOG("----\n\n");
 	// Fixme:
@@ -127,11 +146,19 @@ int 	main(int argc, char *argv[])
 	unsigned int dsp = CFG(dump_state_period);
 
 	while (!interp.breakRequested()) {
-		interp.execute();
-		// Print PC/state?
-		// Apply debug/breakpoint activities?
-		// Poll devices?
-		pcs.CPUTick();
+		/* Run a batch of instructions up to the next tick that one of
+		 * the checks below cares about.  Nothing else is checked per
+		 * instruction; IRQs, breaks etc. cut the batch short.  If the
+		 * CPU's dozing, sleep until then instead.
+		 */
+		pcs.setRunHorizon(next_horizon(&pcs, instr_limit, dsp));
+		if (pcs.isDozing())
+			pcs.doze();
+		else if (interp.traceVariant())
+			run_batch<true>(&interp, &pcs);
+		else
+			run_batch<false>(&interp, &pcs);
+
 		if (pcs.isIRQPending()) {
 			pcs.raiseIRQException();
 		} else if (pcs.isDecrementerPending()) {
@@ -151,7 +178,11 @@ int 	main(int argc, char *argv[])
 		platform_poll_periodic(pcs.getCPUTicks());
 	};
 #else
-	initBlockStore();
+	initBlockStore(&mmu, CFG(jit_cache_mb));
+#if ENABLE_JIT_PERSIST
+	if (CFG(jit_persist_path))
+		initBlockCache(&mmu, CFG(jit_persist_path));
+#endif
 	runloop(&mmu, &interp, &pcs);
 #endif
 
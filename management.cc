@@ -195,6 +195,8 @@ static	void	process_line(char *line)
 		char *val = skip_whitespace(end_flag);
 		*end_flag = '\0';
 		log_set(flag, val);
+		/* The run loop picks the (non-)tracing interpreter per batch: */
+		pcs.cutRun();
 	} else {
 		write_response((char *)"ONOES\n");
 	}
@@ -0,0 +1,397 @@
+extern "C" u64 get_op_add_t();
+extern "C" u64 get_op_add_nt();
+extern "C" u64 get_op_addc_t();
+extern "C" u64 get_op_addc_nt();
+extern "C" u64 get_op_adde_t();
+extern "C" u64 get_op_adde_nt();
+extern "C" u64 get_op_addi_t();
+extern "C" u64 get_op_addi_nt();
+extern "C" u64 get_op_li_t();
+extern "C" u64 get_op_li_nt();
+extern "C" u64 get_op_addis_t();
+extern "C" u64 get_op_addis_nt();
+extern "C" u64 get_op_lis_t();
+extern "C" u64 get_op_lis_nt();
+extern "C" u64 get_op_addic_t();
+extern "C" u64 get_op_addic_nt();
+extern "C" u64 get_op_addic_rc_t();
+extern "C" u64 get_op_addic_rc_nt();
+extern "C" u64 get_op_addme_t();
+extern "C" u64 get_op_addme_nt();
+extern "C" u64 get_op_addze_t();
+extern "C" u64 get_op_addze_nt();
+extern "C" u64 get_op_and_t();
+extern "C" u64 get_op_and_nt();
+extern "C" u64 get_op_andc_t();
+extern "C" u64 get_op_andc_nt();
+extern "C" u64 get_op_andi_rc_t();
+extern "C" u64 get_op_andi_rc_nt();
+extern "C" u64 get_op_andis_rc_t();
+extern "C" u64 get_op_andis_rc_nt();
+extern "C" u64 get_op_b_t();
+extern "C" u64 get_op_b_nt();
+extern "C" u64 get_op_bc_t();
+extern "C" u64 get_op_bc_nt();
+extern "C" u64 get_op_bclr_t();
+extern "C" u64 get_op_bclr_nt();
+extern "C" u64 get_op_blr_t();
+extern "C" u64 get_op_blr_nt();
+extern "C" u64 get_op_bcctr_t();
+extern "C" u64 get_op_bcctr_nt();
+extern "C" u64 get_op_bctr_t();
+extern "C" u64 get_op_bctr_nt();
+extern "C" u64 get_op_cmp_t();
+extern "C" u64 get_op_cmp_nt();
+extern "C" u64 get_op_cmpi_t();
+extern "C" u64 get_op_cmpi_nt();
+extern "C" u64 get_op_cmpl_t();
+extern "C" u64 get_op_cmpl_nt();
+extern "C" u64 get_op_cmpli_t();
+extern "C" u64 get_op_cmpli_nt();
+extern "C" u64 get_op_cntlzw_t();
+extern "C" u64 get_op_cntlzw_nt();
+extern "C" u64 get_op_crand_t();
+extern "C" u64 get_op_crand_nt();
+extern "C" u64 get_op_crandc_t();
+extern "C" u64 get_op_crandc_nt();
+extern "C" u64 get_op_creqv_t();
+extern "C" u64 get_op_creqv_nt();
+extern "C" u64 get_op_crnand_t();
+extern "C" u64 get_op_crnand_nt();
+extern "C" u64 get_op_crnor_t();
+extern "C" u64 get_op_crnor_nt();
+extern "C" u64 get_op_cror_t();
+extern "C" u64 get_op_cror_nt();
+extern "C" u64 get_op_crorc_t();
+extern "C" u64 get_op_crorc_nt();
+extern "C" u64 get_op_crxor_t();
+extern "C" u64 get_op_crxor_nt();
+extern "C" u64 get_op_divw_t();
+extern "C" u64 get_op_divw_nt();
+extern "C" u64 get_op_divwu_t();
+extern "C" u64 get_op_divwu_nt();
+extern "C" u64 get_op_eieio_t();
+extern "C" u64 get_op_eieio_nt();
+extern "C" u64 get_op_eqv_t();
+extern "C" u64 get_op_eqv_nt();
+extern "C" u64 get_op_extsb_t();
+extern "C" u64 get_op_extsb_nt();
+extern "C" u64 get_op_extsh_t();
+extern "C" u64 get_op_extsh_nt();
+extern "C" u64 get_op_isync_t();
+extern "C" u64 get_op_isync_nt();
+extern "C" u64 get_op_lbz_t();
+extern "C" u64 get_op_lbz_nt();
+extern "C" u64 get_op_lbzu_t();
+extern "C" u64 get_op_lbzu_nt();
+extern "C" u64 get_op_lbzx_t();
+extern "C" u64 get_op_lbzx_nt();
+extern "C" u64 get_op_lbzux_t();
+extern "C" u64 get_op_lbzux_nt();
+extern "C" u64 get_op_lha_t();
+extern "C" u64 get_op_lha_nt();
+extern "C" u64 get_op_lhau_t();
+extern "C" u64 get_op_lhau_nt();
+extern "C" u64 get_op_lhax_t();
+extern "C" u64 get_op_lhax_nt();
+extern "C" u64 get_op_lhaux_t();
+extern "C" u64 get_op_lhaux_nt();
+extern "C" u64 get_op_lhbrx_t();
+extern "C" u64 get_op_lhbrx_nt();
+extern "C" u64 get_op_lhz_t();
+extern "C" u64 get_op_lhz_nt();
+extern "C" u64 get_op_lhzu_t();
+extern "C" u64 get_op_lhzu_nt();
+extern "C" u64 get_op_lhzx_t();
+extern "C" u64 get_op_lhzx_nt();
+extern "C" u64 get_op_lhzux_t();
+extern "C" u64 get_op_lhzux_nt();
+extern "C" u64 get_op_lmw_t();
+extern "C" u64 get_op_lmw_nt();
+extern "C" u64 get_op_lswi_t();
+extern "C" u64 get_op_lswi_nt();
+extern "C" u64 get_op_lswx_t();
+extern "C" u64 get_op_lswx_nt();
+extern "C" u64 get_op_lwarx_t();
+extern "C" u64 get_op_lwarx_nt();
+extern "C" u64 get_op_lwbrx_t();
+extern "C" u64 get_op_lwbrx_nt();
+extern "C" u64 get_op_lwz_t();
+extern "C" u64 get_op_lwz_nt();
+extern "C" u64 get_op_lwzu_t();
+extern "C" u64 get_op_lwzu_nt();
+extern "C" u64 get_op_lwzx_t();
+extern "C" u64 get_op_lwzx_nt();
+extern "C" u64 get_op_lwzux_t();
+extern "C" u64 get_op_lwzux_nt();
+extern "C" u64 get_op_mcrf_t();
+extern "C" u64 get_op_mcrf_nt();
+extern "C" u64 get_op_mcrxr_t();
+extern "C" u64 get_op_mcrxr_nt();
+extern "C" u64 get_op_mfcr_t();
+extern "C" u64 get_op_mfcr_nt();
+extern "C" u64 get_op_mfmsr_t();
+extern "C" u64 get_op_mfmsr_nt();
+extern "C" u64 get_op_mfspr_t();
+extern "C" u64 get_op_mfspr_nt();
+extern "C" u64 get_op_mftb_t();
+extern "C" u64 get_op_mftb_nt();
+extern "C" u64 get_op_mtcrf_t();
+extern "C" u64 get_op_mtcrf_nt();
+extern "C" u64 get_op_mtmsr_t();
+extern "C" u64 get_op_mtmsr_nt();
+extern "C" u64 get_op_mtspr_t();
+extern "C" u64 get_op_mtspr_nt();
+extern "C" u64 get_op_mulhw_t();
+extern "C" u64 get_op_mulhw_nt();
+extern "C" u64 get_op_mulhwu_t();
+extern "C" u64 get_op_mulhwu_nt();
+extern "C" u64 get_op_mulli_t();
+extern "C" u64 get_op_mulli_nt();
+extern "C" u64 get_op_mullw_t();
+extern "C" u64 get_op_mullw_nt();
+extern "C" u64 get_op_nand_t();
+extern "C" u64 get_op_nand_nt();
+extern "C" u64 get_op_neg_t();
+extern "C" u64 get_op_neg_nt();
+extern "C" u64 get_op_nor_t();
+extern "C" u64 get_op_nor_nt();
+extern "C" u64 get_op_or_t();
+extern "C" u64 get_op_or_nt();
+extern "C" u64 get_op_mr_t();
+extern "C" u64 get_op_mr_nt();
+extern "C" u64 get_op_orc_t();
+extern "C" u64 get_op_orc_nt();
+extern "C" u64 get_op_ori_t();
+extern "C" u64 get_op_ori_nt();
+extern "C" u64 get_op_nop_t();
+extern "C" u64 get_op_nop_nt();
+extern "C" u64 get_op_oris_t();
+extern "C" u64 get_op_oris_nt();
+extern "C" u64 get_op_rfi_t();
+extern "C" u64 get_op_rfi_nt();
+extern "C" u64 get_op_rlwimi_t();
+extern "C" u64 get_op_rlwimi_nt();
+extern "C" u64 get_op_rlwinm_t();
+extern "C" u64 get_op_rlwinm_nt();
+extern "C" u64 get_op_slwi_t();
+extern "C" u64 get_op_slwi_nt();
+extern "C" u64 get_op_srwi_t();
+extern "C" u64 get_op_srwi_nt();
+extern "C" u64 get_op_clrlwi_t();
+extern "C" u64 get_op_clrlwi_nt();
+extern "C" u64 get_op_rlwnm_t();
+extern "C" u64 get_op_rlwnm_nt();
+extern "C" u64 get_op_sc_t();
+extern "C" u64 get_op_sc_nt();
+extern "C" u64 get_op_slw_t();
+extern "C" u64 get_op_slw_nt();
+extern "C" u64 get_op_sraw_t();
+extern "C" u64 get_op_sraw_nt();
+extern "C" u64 get_op_srawi_t();
+extern "C" u64 get_op_srawi_nt();
+extern "C" u64 get_op_srw_t();
+extern "C" u64 get_op_srw_nt();
+extern "C" u64 get_op_stb_t();
+extern "C" u64 get_op_stb_nt();
+extern "C" u64 get_op_stbu_t();
+extern "C" u64 get_op_stbu_nt();
+extern "C" u64 get_op_stbx_t();
+extern "C" u64 get_op_stbx_nt();
+extern "C" u64 get_op_stbux_t();
+extern "C" u64 get_op_stbux_nt();
+extern "C" u64 get_op_sth_t();
+extern "C" u64 get_op_sth_nt();
+extern "C" u64 get_op_sthbrx_t();
+extern "C" u64 get_op_sthbrx_nt();
+extern "C" u64 get_op_sthu_t();
+extern "C" u64 get_op_sthu_nt();
+extern "C" u64 get_op_sthx_t();
+extern "C" u64 get_op_sthx_nt();
+extern "C" u64 get_op_sthux_t();
+extern "C" u64 get_op_sthux_nt();
+extern "C" u64 get_op_stmw_t();
+extern "C" u64 get_op_stmw_nt();
+extern "C" u64 get_op_stswi_t();
+extern "C" u64 get_op_stswi_nt();
+extern "C" u64 get_op_stswx_t();
+extern "C" u64 get_op_stswx_nt();
+extern "C" u64 get_op_stw_t();
+extern "C" u64 get_op_stw_nt();
+extern "C" u64 get_op_stwbrx_t();
+extern "C" u64 get_op_stwbrx_nt();
+extern "C" u64 get_op_stwcx_t();
+extern "C" u64 get_op_stwcx_nt();
+extern "C" u64 get_op_stwu_t();
+extern "C" u64 get_op_stwu_nt();
+extern "C" u64 get_op_stwx_t();
+extern "C" u64 get_op_stwx_nt();
+extern "C" u64 get_op_stwux_t();
+extern "C" u64 get_op_stwux_nt();
+extern "C" u64 get_op_subf_t();
+extern "C" u64 get_op_subf_nt();
+extern "C" u64 get_op_subfc_t();
+extern "C" u64 get_op_subfc_nt();
+extern "C" u64 get_op_subfe_t();
+extern "C" u64 get_op_subfe_nt();
+extern "C" u64 get_op_subfic_t();
+extern "C" u64 get_op_subfic_nt();
+extern "C" u64 get_op_subfme_t();
+extern "C" u64 get_op_subfme_nt();
+extern "C" u64 get_op_subfze_t();
+extern "C" u64 get_op_subfze_nt();
+extern "C" u64 get_op_sync_t();
+extern "C" u64 get_op_sync_nt();
+extern "C" u64 get_op_tw_t();
+extern "C" u64 get_op_tw_nt();
+extern "C" u64 get_op_twi_t();
+extern "C" u64 get_op_twi_nt();
+extern "C" u64 get_op_xor_t();
+extern "C" u64 get_op_xor_nt();
+extern "C" u64 get_op_xori_t();
+extern "C" u64 get_op_xori_nt();
+extern "C" u64 get_op_xoris_t();
+extern "C" u64 get_op_xoris_nt();
+extern "C" u64 get_op_lfs_t();
+extern "C" u64 get_op_lfs_nt();
+extern "C" u64 get_op_lfsu_t();
+extern "C" u64 get_op_lfsu_nt();
+extern "C" u64 get_op_lfsx_t();
+extern "C" u64 get_op_lfsx_nt();
+extern "C" u64 get_op_lfsux_t();
+extern "C" u64 get_op_lfsux_nt();
+extern "C" u64 get_op_lfd_t();
+extern "C" u64 get_op_lfd_nt();
+extern "C" u64 get_op_lfdu_t();
+extern "C" u64 get_op_lfdu_nt();
+extern "C" u64 get_op_lfdx_t();
+extern "C" u64 get_op_lfdx_nt();
+extern "C" u64 get_op_lfdux_t();
+extern "C" u64 get_op_lfdux_nt();
+extern "C" u64 get_op_stfs_t();
+extern "C" u64 get_op_stfs_nt();
+extern "C" u64 get_op_stfsu_t();
+extern "C" u64 get_op_stfsu_nt();
+extern "C" u64 get_op_stfsx_t();
+extern "C" u64 get_op_stfsx_nt();
+extern "C" u64 get_op_stfsux_t();
+extern "C" u64 get_op_stfsux_nt();
+extern "C" u64 get_op_stfd_t();
+extern "C" u64 get_op_stfd_nt();
+extern "C" u64 get_op_stfdu_t();
+extern "C" u64 get_op_stfdu_nt();
+extern "C" u64 get_op_stfdx_t();
+extern "C" u64 get_op_stfdx_nt();
+extern "C" u64 get_op_stfdux_t();
+extern "C" u64 get_op_stfdux_nt();
+extern "C" u64 get_op_stfiwx_t();
+extern "C" u64 get_op_stfiwx_nt();
+extern "C" u64 get_op_fadd_t();
+extern "C" u64 get_op_fadd_nt();
+extern "C" u64 get_op_fsub_t();
+extern "C" u64 get_op_fsub_nt();
+extern "C" u64 get_op_fmul_t();
+extern "C" u64 get_op_fmul_nt();
+extern "C" u64 get_op_fdiv_t();
+extern "C" u64 get_op_fdiv_nt();
+extern "C" u64 get_op_fsqrt_t();
+extern "C" u64 get_op_fsqrt_nt();
+extern "C" u64 get_op_fmadd_t();
+extern "C" u64 get_op_fmadd_nt();
+extern "C" u64 get_op_fmsub_t();
+extern "C" u64 get_op_fmsub_nt();
+extern "C" u64 get_op_fnmadd_t();
+extern "C" u64 get_op_fnmadd_nt();
+extern "C" u64 get_op_fnmsub_t();
+extern "C" u64 get_op_fnmsub_nt();
+extern "C" u64 get_op_fadds_t();
+extern "C" u64 get_op_fadds_nt();
+extern "C" u64 get_op_fsubs_t();
+extern "C" u64 get_op_fsubs_nt();
+extern "C" u64 get_op_fmuls_t();
+extern "C" u64 get_op_fmuls_nt();
+extern "C" u64 get_op_fdivs_t();
+extern "C" u64 get_op_fdivs_nt();
+extern "C" u64 get_op_fsqrts_t();
+extern "C" u64 get_op_fsqrts_nt();
+extern "C" u64 get_op_fmadds_t();
+extern "C" u64 get_op_fmadds_nt();
+extern "C" u64 get_op_fmsubs_t();
+extern "C" u64 get_op_fmsubs_nt();
+extern "C" u64 get_op_fnmadds_t();
+extern "C" u64 get_op_fnmadds_nt();
+extern "C" u64 get_op_fnmsubs_t();
+extern "C" u64 get_op_fnmsubs_nt();
+extern "C" u64 get_op_fres_t();
+extern "C" u64 get_op_fres_nt();
+extern "C" u64 get_op_frsqrte_t();
+extern "C" u64 get_op_frsqrte_nt();
+extern "C" u64 get_op_fsel_t();
+extern "C" u64 get_op_fsel_nt();
+extern "C" u64 get_op_fmr_t();
+extern "C" u64 get_op_fmr_nt();
+extern "C" u64 get_op_fneg_t();
+extern "C" u64 get_op_fneg_nt();
+extern "C" u64 get_op_fabs_t();
+extern "C" u64 get_op_fabs_nt();
+extern "C" u64 get_op_fnabs_t();
+extern "C" u64 get_op_fnabs_nt();
+extern "C" u64 get_op_frsp_t();
+extern "C" u64 get_op_frsp_nt();
+extern "C" u64 get_op_fctiw_t();
+extern "C" u64 get_op_fctiw_nt();
+extern "C" u64 get_op_fctiwz_t();
+extern "C" u64 get_op_fctiwz_nt();
+extern "C" u64 get_op_fcmpu_t();
+extern "C" u64 get_op_fcmpu_nt();
+extern "C" u64 get_op_fcmpo_t();
+extern "C" u64 get_op_fcmpo_nt();
+extern "C" u64 get_op_mffs_t();
+extern "C" u64 get_op_mffs_nt();
+extern "C" u64 get_op_mtfsf_t();
+extern "C" u64 get_op_mtfsf_nt();
+extern "C" u64 get_op_mtfsfi_t();
+extern "C" u64 get_op_mtfsfi_nt();
+extern "C" u64 get_op_mtfsb0_t();
+extern "C" u64 get_op_mtfsb0_nt();
+extern "C" u64 get_op_mtfsb1_t();
+extern "C" u64 get_op_mtfsb1_nt();
+extern "C" u64 get_op_mcrfs_t();
+extern "C" u64 get_op_mcrfs_nt();
+extern "C" u64 get_op_DEBUG_t();
+extern "C" u64 get_op_DEBUG_nt();
+extern "C" u64 get_op_dcba_t();
+extern "C" u64 get_op_dcba_nt();
+extern "C" u64 get_op_dcbi_t();
+extern "C" u64 get_op_dcbi_nt();
+extern "C" u64 get_op_dcbf_t();
+extern "C" u64 get_op_dcbf_nt();
+extern "C" u64 get_op_dcbt_t();
+extern "C" u64 get_op_dcbt_nt();
+extern "C" u64 get_op_dcbst_t();
+extern "C" u64 get_op_dcbst_nt();
+extern "C" u64 get_op_dcbtst_t();
+extern "C" u64 get_op_dcbtst_nt();
+extern "C" u64 get_op_dcbz_t();
+extern "C" u64 get_op_dcbz_nt();
+extern "C" u64 get_op_icbi_t();
+extern "C" u64 get_op_icbi_nt();
+extern "C" u64 get_op_icbt_t();
+extern "C" u64 get_op_icbt_nt();
+extern "C" u64 get_op_mfsr_t();
+extern "C" u64 get_op_mfsr_nt();
+extern "C" u64 get_op_mfsrin_t();
+extern "C" u64 get_op_mfsrin_nt();
+extern "C" u64 get_op_mtsr_t();
+extern "C" u64 get_op_mtsr_nt();
+extern "C" u64 get_op_mtsrin_t();
+extern "C" u64 get_op_mtsrin_nt();
+extern "C" u64 get_op_tlbie_t();
+extern "C" u64 get_op_tlbie_nt();
+extern "C" u64 get_op_tlbiel_t();
+extern "C" u64 get_op_tlbiel_nt();
+extern "C" u64 get_op_tlbia_t();
+extern "C" u64 get_op_tlbia_nt();
+extern "C" u64 get_op_tlbsync_t();
+extern "C" u64 get_op_tlbsync_nt();
+extern "C" u64 get_op_unk();
@@ -77,6 +77,12 @@ static inline void	platform_poll_periodic(u64 ticks)
 	// Nothing, no overhead.
 }
 
+/* Ticks until platform_poll_periodic() next does something: */
+static inline u64	platform_poll_distance(u64 ticks)
+{
+	return ~0ULL;
+}
+
 static inline void      platform_state_save(int handle)
 {
 }
@@ -107,6 +113,11 @@ static inline void	platform_poll_periodic(u64 ticks)
 		platform_poll_lcdc0(ticks);
 }
 
+static inline u64	platform_poll_distance(u64 ticks)
+{
+	return LCDC0_POLL_PERIOD_MASK + 1 - (ticks & LCDC0_POLL_PERIOD_MASK);
+}
+
 static inline void      platform_state_save(int handle)
 {
 }
@@ -176,6 +187,11 @@ static inline void	platform_poll_periodic(u64 ticks)
 	// FIXME:  LCDC1
 }
 
+static inline u64	platform_poll_distance(u64 ticks)
+{
+	return LCDC0_POLL_PERIOD_MASK + 1 - (ticks & LCDC0_POLL_PERIOD_MASK);
+}
+
 void      platform_state_save(int handle);
 
 #endif
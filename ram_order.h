@@ -0,0 +1,263 @@
+/* Copyright 2016-2022 Matt Evans
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RAM_ORDER_H
+#define RAM_ORDER_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "utility.h"
+#include "portable_endian.h"
+
+/* Byte order of guest RAM, as seen through host pointers (DevRAM's mmap).
+ *
+ * Normally RAM is held as the guest sees it, big-endian, so on a
+ * little-endian host every word access is byte-swapped.  With
+ * HOST_ENDIAN_RAM, each aligned word is held in host order instead:  aligned
+ * word accesses (most loads and stores, and all instruction fetches) are
+ * plain host accesses, and smaller ones are found by XORing the address
+ * (the byte at guest offset a is at host offset a^3, and the aligned
+ * halfword at a is at a^2).  RAM is page-aligned on the host, so a host
+ * pointer has the same alignment as the guest PA it maps.
+ *
+ * Anything touching RAM through a host pointer must go through these.  Code
+ * wanting plain guest-order bytes (DMA to/from files, state save, etc.) uses
+ * ram_dma_buf()/ram_dma_done().
+ */
+#if HOST_ENDIAN_RAM && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define RAM_SWIZZLED	1
+#else
+#define RAM_SWIZZLED	0
+#endif
+
+/* Aligned accesses: */
+static inline void	ram_load(const u8 *h, u32 *d)
+{
+	*d = RAM_SWIZZLED ? *(const u32 *)h : be32toh(*(const u32 *)h);
+}
+
+static inline void	ram_load(const u8 *h, u16 *d)
+{
+	*d = RAM_SWIZZLED ? *(const u16 *)((uintptr_t)h ^ 2) : be16toh(*(const u16 *)h);
+}
+
+static inline void	ram_load(const u8 *h, u8 *d)
+{
+	*d = *(const u8 *)((uintptr_t)h ^ (RAM_SWIZZLED ? 3 : 0));
+}
+
+static inline void	ram_store(u8 *h, u32 v)
+{
+	*(u32 *)h = RAM_SWIZZLED ? v : htobe32(v);
+}
+
+static inline void	ram_store(u8 *h, u16 v)
+{
+	if (RAM_SWIZZLED)
+		*(u16 *)((uintptr_t)h ^ 2) = v;
+	else
+		*(u16 *)h = htobe16(v);
+}
+
+static inline void	ram_store(u8 *h, u8 v)
+{
+	*(u8 *)((uintptr_t)h ^ (RAM_SWIZZLED ? 3 : 0)) = v;
+}
+
+/* Any alignment (a misaligned access mustn't cross a page): */
+static inline u8	ram_read8(const u8 *h)
+{
+	u8 v;
+	ram_load(h, &v);
+	return v;
+}
+
+static inline void	ram_write8(u8 *h, u8 v)
+{
+	ram_store(h, v);
+}
+
+static inline u16	ram_read16(const u8 *h)
+{
+	u16 v;
+#if RAM_SWIZZLED
+	if (unlikely((uintptr_t)h & 1))
+		return (ram_read8(h) << 8) | ram_read8(h + 1);
+	ram_load(h, &v);
+#else
+	v = be16toh(*(const u16 *)h);
+#endif
+	return v;
+}
+
+static inline void	ram_write16(u8 *h, u16 v)
+{
+#if RAM_SWIZZLED
+	if (unlikely((uintptr_t)h & 1)) {
+		ram_write8(h, v >> 8);
+		ram_write8(h + 1, v);
+		return;
+	}
+	ram_store(h, v);
+#else
+	*(u16 *)h = htobe16(v);
+#endif
+}
+
+static inline u32	ram_read32(const u8 *h)
+{
+	u32 v;
+#if RAM_SWIZZLED
+	if (unlikely((uintptr_t)h & 3))
+		return (ram_read8(h) << 24) | (ram_read8(h + 1) << 16) |
+			(ram_read8(h + 2) << 8) | ram_read8(h + 3);
+	ram_load(h, &v);
+#else
+	v = be32toh(*(const u32 *)h);
+#endif
+	return v;
+}
+
+static inline void	ram_write32(u8 *h, u32 v)
+{
+#if RAM_SWIZZLED
+	if (unlikely((uintptr_t)h & 3)) {
+		ram_write8(h, v >> 24);
+		ram_write8(h + 1, v >> 16);
+		ram_write8(h + 2, v >> 8);
+		ram_write8(h + 3, v);
+		return;
+	}
+	ram_store(h, v);
+#else
+	*(u32 *)h = htobe32(v);
+#endif
+}
+
+/* Copy len guest-order bytes into/out of RAM at h: */
+static inline void	ram_copy_in(u8 *h, const u8 *src, size_t len)
+{
+#if RAM_SWIZZLED
+	size_t i = 0;
+
+	for (; i < len && ((uintptr_t)(h + i) & 3); i++)
+		ram_write8(h + i, src[i]);
+	for (; i + 4 <= len; i += 4) {
+		u32 w;
+		memcpy(&w, src + i, 4);
+		*(u32 *)(h + i) = be32toh(w);
+	}
+	for (; i < len; i++)
+		ram_write8(h + i, src[i]);
+#else
+	memcpy(h, src, len);
+#endif
+}
+
+static inline void	ram_copy_out(u8 *dest, const u8 *h, size_t len)
+{
+#if RAM_SWIZZLED
+	size_t i = 0;
+
+	for (; i < len && ((uintptr_t)(h + i) & 3); i++)
+		dest[i] = ram_read8(h + i);
+	for (; i + 4 <= len; i += 4) {
+		u32 w = htobe32(*(const u32 *)(h + i));
+		memcpy(dest + i, &w, 4);
+	}
+	for (; i < len; i++)
+		dest[i] = ram_read8(h + i);
+#else
+	memcpy(dest, h, len);
+#endif
+}
+
+/* Copy/set len bytes within RAM: */
+static inline void	ram_memcpy(u8 *d, const u8 *s, size_t len)
+{
+#if RAM_SWIZZLED
+	size_t i = 0;
+
+	if (((uintptr_t)d ^ (uintptr_t)s) & 3) {
+		for (; i < len; i++)
+			ram_write8(d + i, ram_read8(s + i));
+		return;
+	}
+	/* Same alignment, so whole words stay whole: */
+	for (; i < len && ((uintptr_t)(d + i) & 3); i++)
+		ram_write8(d + i, ram_read8(s + i));
+	size_t words = (len - i) & ~(size_t)3;
+	memcpy(d + i, s + i, words);
+	for (i += words; i < len; i++)
+		ram_write8(d + i, ram_read8(s + i));
+#else
+	memcpy(d, s, len);
+#endif
+}
+
+static inline void	ram_memset(u8 *d, u8 v, size_t len)
+{
+#if RAM_SWIZZLED
+	size_t i = 0;
+
+	for (; i < len && ((uintptr_t)(d + i) & 3); i++)
+		ram_write8(d + i, v);
+	size_t words = (len - i) & ~(size_t)3;
+	memset(d + i, v, words);
+	for (i += words; i < len; i++)
+		ram_write8(d + i, v);
+#else
+	memset(d, v, len);
+#endif
+}
+
+/* For handing len bytes of RAM at h to something expecting guest-order bytes
+ * (read(), write(), etc.):  use the buffer from ram_dma_buf() in its place,
+ * then ram_dma_done(), with to_ram if the buffer was written.  Unless RAM is
+ * swizzled, the buffer is just h.
+ */
+static inline u8	*ram_dma_buf(u8 *h, size_t len)
+{
+#if RAM_SWIZZLED
+	u8 *b = (u8 *)malloc(len);
+	ASSERT(b);
+	/* Even if it's going to be written, as it might not all be: */
+	ram_copy_out(b, h, len);
+	return b;
+#else
+	return h;
+#endif
+}
+
+static inline void	ram_dma_done(u8 *h, u8 *buf, size_t len, bool to_ram)
+{
+#if RAM_SWIZZLED
+	if (to_ram)
+		ram_copy_in(h, buf, len);
+	free(buf);
+#endif
+}
+
+#endif
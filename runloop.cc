@@ -33,14 +33,77 @@
 #include "Config.h"
 #include "blockstore.h"
 #include "blockgen.h"
+#include "blockcache.h"
+#include "runloop.h"
 
 jmp_buf	runloop_restart; /* Todo: shove in an object, multithread-safe */
+static bool runloop_tracing = false;	/* Variant of ops blocks are built with */
+
+#if ENABLE_JIT_CHAIN || ENABLE_JIT_TIER
+/* Most instructions chained blocks run before coming back to the runloop: */
+#define CHAIN_BUDGET	100000
+
+/* Chained blocks (and interpreted runs) go on until the tick count reaches
+ * the run horizon:  the main loop's (see next_horizon()), or the budget if
+ * that's sooner.  (IRQs cut the run short, as for the interpreter.)
+ */
+static u64	chain_horizon(PPCCPUState *pcs, unsigned int instr_limit, unsigned int dsp)
+{
+	return MIN(next_horizon(pcs, instr_limit, dsp), pcs->getCPUTicks() + CHAIN_BUDGET);
+}
+#endif
+
+#if ENABLE_JIT_TIER
+/* Tiered execution:  a PC with no block is interpreted (from predecoded
+ * instructions) until it's been run from jit_threshold times, so code only
+ * run a few times (e.g. at boot) isn't compiled.  It's then compiled as a
+ * plain block, which counts down jit_reopt runs before being recompiled as
+ * a trace (see blockgen.cc).  A threshold of 0 skips that tier.
+ *
+ * An interpreted run goes on until the PC leaves straight-line code (a
+ * fused pair counts as one step), the page, MAX_INSTRS, or the horizon:
+ */
+template <bool trace_variant>
+static void	interpretRun(PPCInterpreter *interp, PPCCPUState *pcs)
+{
+	VA pc = pcs->getPC();
+
+	/* Each instruction's ticked once it's done, so one that takes an
+	 * exception is ticked by the runloop instead:
+	 */
+	pcs->setBlockTicks(1);
+	for (unsigned int i = 0; i < MAX_INSTRS; i++) {
+		interp->execute<trace_variant>();
+		pcs->CPUTick();
+
+		VA next = pcs->getPC();
+		if ((next != pc + 4 && next != pc + 8) || (next & 0xfff) < (pc & 0xfff) ||
+		    pcs->runHorizonReached())
+			break;
+		pc = next;
+	}
+	pcs->setBlockTicks(0);
+	/* Blocks don't keep the interpreter's own PC, so it's 0 as far as
+	 * the handlers they call are concerned; left as the last one
+	 * interpreted, every backward branch near it looks like an idle
+	 * loop (see idle_branch()):
+	 */
+	interp->setPCInst(0, 0);
+}
+#endif
 
 void runloop(PPCMMU *mmu, PPCInterpreter *interp, PPCCPUState *pcs)
 {
 	unsigned int instr_limit = CFG(instr_limit);
 	unsigned int dsp = CFG(dump_state_period);
 	bool break_runloop = false;
+#if ENABLE_JIT_TIER
+	unsigned int threshold = CFG(jit_threshold);
+	unsigned int reopt = CFG(jit_reopt);
+	unsigned int first_tier = reopt ? TIER_BLOCK : TIER_TOP;
+#else
+	unsigned int first_tier = TIER_TOP;
+#endif
 
         pcs->setJmpbuf(&runloop_restart);
 	/* The instruction routines longjmp back to here if they have an
@@ -48,6 +111,12 @@ void runloop(PPCMMU *mmu, PPCInterpreter *interp, PPCCPUState *pcs)
 	 */
 	if (setjmp(runloop_restart)) {
 		JITTRACE("Restarting runloop after exception\n");
+		/* The block (or interpreted run) left before ticking the
+		 * instructions it did up to and including the one taking the
+		 * exception, as the interpreter would:
+		 */
+		pcs->CPUTick(pcs->getBlockTicks());
+		pcs->setBlockTicks(0);
 	}
 
 	if (break_runloop)
@@ -58,32 +127,109 @@ void runloop(PPCMMU *mmu, PPCInterpreter *interp, PPCCPUState *pcs)
 		// are fairly frequent so worth not invalidating blockcache.
 		block_t *to;
 		PPCMMU::fault_t fault;
+		unsigned int tier;
+
+		/* Existing blocks call the other variant of the ops if the
+		 * tracing flags have changed, so throw them away:
+		 */
+		if (unlikely(LOG_INTERP_TRACING != runloop_tracing)) {
+			runloop_tracing = LOG_INTERP_TRACING;
+			resetBlockstore();
+		}
 
 	find_block:
 		to = findBlock(mmu, pcs /* current CPU state */, &fault);
+		tier = first_tier;
+#if ENABLE_JIT_TIER
+		bool going_up = false;
+		if (to && unlikely(to->tier < TIER_TOP && !to->tier_left)) {
+			/* Its runs are up, so make it again at the next tier: */
+			JITTRACE("Block %p (PC %08x) going up from tier %d\n", to, to->pc, to->tier);
+			tier = to->tier + 1;
+			retireBlock(to);
+			to = 0;
+			fault = PPCMMU::FAULT_NONE;
+			going_up = true;
+		}
+#endif
+#if ENABLE_JIT_PERSIST
+		/* A block from an earlier run needn't be warmed up again: */
+		if (!to && fault == PPCMMU::FAULT_NONE && !runloop_tracing) {
+			to = blockCacheLoad(mmu, pcs, tier);
+#if ENABLE_JIT_TIER
+			if (to && to->tier < TIER_TOP)
+				to->tier_left = reopt;
+#endif
+		}
+#endif
+#if ENABLE_JIT_TIER
+		if (!to && fault == PPCMMU::FAULT_NONE && !going_up && !warmBlock(pcs->getMSR(), threshold)) {
+			/* Still cold, so interpret: */
+			u64 t = tierClock();
+			pcs->setRunHorizon(chain_horizon(pcs, instr_limit, dsp));
+			if (interp->traceVariant())
+				interpretRun<true>(interp, pcs);
+			else
+				interpretRun<false>(interp, pcs);
+			tierRan(TIER_INTERP, tierClock() - t);
+			goto ran;
+		}
+#endif
 		if (!to) {
 			if (fault != PPCMMU::FAULT_NONE) {
 				JITTRACE("Fault %d\n", fault);
-				pcs->raiseMemException(true, true, pcs->getPC(), fault);
+				pcs->raiseMemException(true, true, pcs->getPC(), fault, 0);
 				continue;
 			} else {
 				/* Otherise no block; make one */
-				to = createBlock(mmu, pcs);
+				u64 t = tierClock();
+				to = createBlock(mmu, pcs, runloop_tracing, tier);
 				if (!to)	/* PC faults, no block created */
 					goto find_block;
+#if ENABLE_JIT_TIER
+				if (tier < TIER_TOP)
+					to->tier_left = reopt;
+#endif
+				tierCompiled(tier, tierClock() - t);
 				COUNT(CTR_JIT_BLOCKS_GEN);
 			}
 		}
+#if ENABLE_JIT_CHAIN
+		linkPendingBlock(to);
+		pcs->setRunHorizon(chain_horizon(pcs, instr_limit, dsp));
+#endif
 		JITTRACE("Calling block %p, code at %p\n", to, BLOCK_CODEPTR(to));
 		COUNT(CTR_JIT_BLOCKS_EXEC);
 
-		/* Runs block. */
-		block_fn_t c = (block_fn_t)BLOCK_CODEPTR(to);
-		int r = c(interp);
-		JITTRACE("Back, retval %d\n", r);
+		{
+			/* Runs block. */
+			u64 t = tierClock();
+			block_fn_t c = (block_fn_t)BLOCK_CODEPTR(to);
+			int r = c(interp);
+			pcs->setBlockTicks(0);
+			JITTRACE("Back, retval %d\n", r);
+			tierRan(to->tier, tierClock() - t);
 
-		/* Use returned nr of cycles consumed by block, to bump on the DEC/ticks: */
-		pcs->CPUTick(r);
+#if ENABLE_JIT_CHAIN
+			/* Blocks tick the count themselves; r is the ID of the
+			 * exit that wants linking to whichever block's found
+			 * next, if any:
+			 */
+			setBlockLinkPending(r);
+#else
+			/* Use returned nr of cycles consumed by block, to bump on the DEC/ticks: */
+			pcs->CPUTick(r);
+#endif
+		}
+#if ENABLE_JIT_TIER
+	ran:
+#endif
+		if (pcs->isDozing()) {
+			/* Sleep until the DEC (or an IRQ): */
+			pcs->setRunHorizon(pcs->getCPUTicks() + pcs->ticksToDECPending());
+			pcs->doze();
+			pcs->cutRun();
+		}
 		if (pcs->isIRQPending()) {
 			pcs->raiseIRQException();
 		} else if (pcs->isDecrementerPending()) {
@@ -27,8 +27,24 @@
 #include "PPCMMU.h"
 #include "PPCInterpreter.h"
 #include "PPCCPUState.h"
+#include "platform.h"
 
 void runloop(PPCMMU *mmu, PPCInterpreter *interp, PPCCPUState *pc);
 
+/* Returns the tick count at which the run loop next needs to do something:
+ * deliver a DEC, poll a device, stop at the instruction limit or dump state.
+ */
+static inline u64	next_horizon(PPCCPUState *pcs, unsigned int instr_limit, unsigned int dsp)
+{
+	u64 ticks = pcs->getCPUTicks();
+	u64 n = MIN(platform_poll_distance(ticks), pcs->ticksToDECPending());
+
+	if (instr_limit && ticks <= instr_limit)
+		n = MIN(n, instr_limit + 1 - ticks);
+	if (dsp)
+		n = MIN(n, dsp - (ticks % dsp));
+	return ticks + MIN(n, ~0ULL - ticks);
+}
+
 
 #endif
@@ -31,6 +31,7 @@
 #include "PPCMMU.h"
 #include "PPCCPUState.h"
 #include "log.h"
+#include "ram_order.h"
 #include "Config.h"
 
 
@@ -75,6 +76,15 @@ int state_save_open(PPCCPUState *pcs, meminfo_t meminfo[], unsigned int membanks
 	SAVE_REG_CHUNK(fd, pcs->getDEC(), "DEC");
 	SAVE_REG_CHUNK(fd, pcs->getTB(), "TB");
 
+#if ENABLE_FPU
+	for (int i = 0; i < 32; i++) {
+		char name[8];
+		snprintf(name, 8, STS_FPR_FMT, i);
+		SAVE_REG_CHUNK(fd, pcs->getFPR(i), name);
+	}
+	SAVE_REG_CHUNK(fd, pcs->getFPSCR(), "FPSCR");
+#endif
+
 	// MMU
 	SAVE_REG_CHUNK(fd, pcs->getSDR1(), "SDR1");
 
@@ -124,7 +134,10 @@ int state_save_open(PPCCPUState *pcs, meminfo_t meminfo[], unsigned int membanks
                                         WARN("save_state: write failed (%d)\n", r);
                                         goto err;
                                 }
-                                r = write(fd, chunk_base, STS_MEM_CHUNK_SZ);
+                                // Saved in guest order, whatever RAM's is:
+                                u8 *buf = ram_dma_buf(chunk_base, STS_MEM_CHUNK_SZ);
+                                r = write(fd, buf, STS_MEM_CHUNK_SZ);
+                                ram_dma_done(chunk_base, buf, STS_MEM_CHUNK_SZ, false);
                                 if (r != STS_MEM_CHUNK_SZ) {
                                         WARN("save_state: write failed (%d)\n", r);
                                         goto err;
@@ -45,6 +45,7 @@ typedef struct {
 
 #define STS_GPR_FMT	"GPR%02d"
 #define STS_SR_FMT	"SR%02d"
+#define STS_FPR_FMT	"FPR%02d"
 #define STS_MEM		"MEMBLK"
 
 #define STS_MEM_CHUNK_SZ	0x200000
@@ -25,14 +25,17 @@
 #define STATS_H
 
 /* Counters:  sprinkle these through code & they are automatically gathered into output.
- * Use the format CTR_nnn for the given parameter.
+ * Use the format CTR_nnn for the given parameter.  COUNT_SET() is for gauges
+ * (e.g. occupancy), which go up and down.
  */
 
 #if ENABLE_COUNTERS > 0
 #include "stats_counter_defs.h"
 #define COUNT(x)	do { global_counters[x]++; } while(0)
+#define COUNT_SET(x, v)	do { global_counters[x] = (v); } while(0)
 #else
 #define COUNT(x)	do { } while(0)
+#define COUNT_SET(x, v)	do { } while(0)
 #define COUNTER_START	0
 #define COUNTER_MAX	0
 static const char *global_counter_names[] = { "" };
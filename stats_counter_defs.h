@@ -0,0 +1,6 @@
+enum { COUNTER_START = 0,
+CTR_BULK_LOOP, CTR_CPU_DOZE, CTR_EXCEPTION_DEC, CTR_EXCEPTION_FPUN, CTR_EXCEPTION_IRQ, CTR_EXCEPTION_MEM, CTR_EXCEPTION_PROG, CTR_EXCEPTION_SC, CTR_IDLE_SKIP, CTR_INST_ADD, CTR_INST_ADDC, CTR_INST_ADDE, CTR_INST_ADDI, CTR_INST_ADDIC, CTR_INST_ADDIC_RC, CTR_INST_ADDIS, CTR_INST_ADDME, CTR_INST_ADDZE, CTR_INST_AND, CTR_INST_ANDC, CTR_INST_ANDIS_RC, CTR_INST_ANDI_RC, CTR_INST_B, CTR_INST_BC, CTR_INST_BCCTR, CTR_INST_BCLR, CTR_INST_BCTR, CTR_INST_BLR, CTR_INST_CLRLWI, CTR_INST_CMP, CTR_INST_CMPI, CTR_INST_CMPL, CTR_INST_CMPLI, CTR_INST_CNTLZW, CTR_INST_CRAND, CTR_INST_CRANDC, CTR_INST_CREQV, CTR_INST_CRNAND, CTR_INST_CRNOR, CTR_INST_CROR, CTR_INST_CRORC, CTR_INST_CRXOR, CTR_INST_DCBA, CTR_INST_DCBF, CTR_INST_DCBI, CTR_INST_DCBST, CTR_INST_DCBT, CTR_INST_DCBTST, CTR_INST_DCBZ, CTR_INST_DIVW, CTR_INST_DIVWU, CTR_INST_EIEIO, CTR_INST_EQV, CTR_INST_EXECUTED, CTR_INST_EXIT, CTR_INST_EXTSB, CTR_INST_EXTSH, CTR_INST_FABS, CTR_INST_FADD, CTR_INST_FADDS, CTR_INST_FCMPO, CTR_INST_FCMPU, CTR_INST_FCTIW, CTR_INST_FCTIWZ, CTR_INST_FDIV, CTR_INST_FDIVS, CTR_INST_FMADD, CTR_INST_FMADDS, CTR_INST_FMR, CTR_INST_FMSUB, CTR_INST_FMSUBS, CTR_INST_FMUL, CTR_INST_FMULS, CTR_INST_FNABS, CTR_INST_FNEG, CTR_INST_FNMADD, CTR_INST_FNMADDS, CTR_INST_FNMSUB, CTR_INST_FNMSUBS, CTR_INST_FRES, CTR_INST_FRSP, CTR_INST_FRSQRTE, CTR_INST_FSEL, CTR_INST_FSQRT, CTR_INST_FSQRTS, CTR_INST_FSUB, CTR_INST_FSUBS, CTR_INST_ICBI, CTR_INST_ICBT, CTR_INST_ISYNC, CTR_INST_LBZ, CTR_INST_LBZU, CTR_INST_LBZUX, CTR_INST_LBZX, CTR_INST_LFD, CTR_INST_LFDU, CTR_INST_LFDUX, CTR_INST_LFDX, CTR_INST_LFS, CTR_INST_LFSU, CTR_INST_LFSUX, CTR_INST_LFSX, CTR_INST_LHA, CTR_INST_LHAU, CTR_INST_LHAUX, CTR_INST_LHAX, CTR_INST_LHBRX, CTR_INST_LHZ, CTR_INST_LHZU, CTR_INST_LHZUX, CTR_INST_LHZX, CTR_INST_LI, CTR_INST_LIS, CTR_INST_LMW, CTR_INST_LSWI, CTR_INST_LSWX, CTR_INST_LWARX, CTR_INST_LWBRX, CTR_INST_LWZ, CTR_INST_LWZU, CTR_INST_LWZUX, CTR_INST_LWZX, CTR_INST_MCRF, CTR_INST_MCRFS, CTR_INST_MCRXR, CTR_INST_MFCR, CTR_INST_MFFS, CTR_INST_MFMSR, CTR_INST_MFSPR, CTR_INST_MFSR, CTR_INST_MFSRIN, CTR_INST_MFTB, CTR_INST_MR, CTR_INST_MTCRF, CTR_INST_MTFSB0, CTR_INST_MTFSB1, CTR_INST_MTFSF, CTR_INST_MTFSFI, CTR_INST_MTMSR, CTR_INST_MTSPR, CTR_INST_MTSR, CTR_INST_MTSRIN, CTR_INST_MULHW, CTR_INST_MULHWU, CTR_INST_MULLI, CTR_INST_MULLW, CTR_INST_NAND, CTR_INST_NEG, CTR_INST_NOP, CTR_INST_NOR, CTR_INST_OR, CTR_INST_ORC, CTR_INST_ORI, CTR_INST_ORIS, CTR_INST_RFI, CTR_INST_RLWIMI, CTR_INST_RLWINM, CTR_INST_RLWNM, CTR_INST_SC, CTR_INST_SLW, CTR_INST_SLWI, CTR_INST_SRAW, CTR_INST_SRAWI, CTR_INST_SRW, CTR_INST_SRWI, CTR_INST_STB, CTR_INST_STBU, CTR_INST_STBUX, CTR_INST_STBX, CTR_INST_STFD, CTR_INST_STFDU, CTR_INST_STFDUX, CTR_INST_STFDX, CTR_INST_STFIWX, CTR_INST_STFS, CTR_INST_STFSU, CTR_INST_STFSUX, CTR_INST_STFSX, CTR_INST_STH, CTR_INST_STHBRX, CTR_INST_STHU, CTR_INST_STHUX, CTR_INST_STHX, CTR_INST_STMW, CTR_INST_STRING_LD_ODD, CTR_INST_STRING_LD_UNALIGNED, CTR_INST_STRING_ST_ODD, CTR_INST_STRING_ST_UNALIGNED, CTR_INST_STSWI, CTR_INST_STSWX, CTR_INST_STW, CTR_INST_STWBRX, CTR_INST_STWCX, CTR_INST_STWU, CTR_INST_STWUX, CTR_INST_STWX, CTR_INST_SUBF, CTR_INST_SUBFC, CTR_INST_SUBFE, CTR_INST_SUBFIC, CTR_INST_SUBFME, CTR_INST_SUBFZE, CTR_INST_SYNC, CTR_INST_TLBIA, CTR_INST_TLBIE, CTR_INST_TLBIEL, CTR_INST_TLBSYNC, CTR_INST_TW, CTR_INST_TWI, CTR_INST_UNK, CTR_INST_XOR, CTR_INST_XORI, CTR_INST_XORIS, CTR_JIT_BLK_ABANDON, CTR_JIT_BLK_INVAL, CTR_JIT_BLK_SPLIT_PAGE, CTR_JIT_BLOCKS_EXEC, CTR_JIT_BLOCKS_GEN, CTR_JIT_CACHE_BLOCKS, CTR_JIT_CACHE_BYTES, CTR_JIT_CHAIN_LINK, CTR_JIT_CHAIN_UNLINK, CTR_JIT_EVICT_BLOCK, CTR_JIT_EVICT_REGION, CTR_JIT_HASH_ENTRIES, CTR_JIT_HASH_GROW, CTR_JIT_HASH_HIT_DEEP, CTR_JIT_HASH_HIT_FIRST, CTR_JIT_HASH_HIT_SECOND, CTR_JIT_HASH_MISS, CTR_JIT_HASH_PROBE, CTR_JIT_INST_NATIVE, CTR_JIT_INST_NATIVE_MEM, CTR_JIT_INVAL_ALL, CTR_JIT_JC_FLUSH, CTR_JIT_JC_HIT, CTR_JIT_JC_MISS, CTR_JIT_PERSIST_BAD, CTR_JIT_PERSIST_HIT, CTR_JIT_PERSIST_RECORDS, CTR_JIT_PERSIST_SAVE, CTR_JIT_PERSIST_STALE, CTR_JIT_RESET_BS, CTR_JIT_TIER0_CYCLES, CTR_JIT_TIER0_RUNS, CTR_JIT_TIER1_COMPILES, CTR_JIT_TIER1_COMPILE_CYCLES, CTR_JIT_TIER1_CYCLES, CTR_JIT_TIER2_COMPILES, CTR_JIT_TIER2_COMPILE_CYCLES, CTR_JIT_TIER2_CYCLES, CTR_JIT_TIER_UP, CTR_JIT_TRACE_FOLLOW, CTR_JIT_TRACE_SIDE_EXIT, CTR_JIT_VENEER, CTR_MEM_FAST_R, CTR_MEM_FAST_W, CTR_MEM_HASH_HIT, CTR_MEM_HASH_LOOKUP, CTR_MEM_R16, CTR_MEM_R16_UNALIGNED, CTR_MEM_R16_UNALIGNED_CROSS8, CTR_MEM_R32, CTR_MEM_R32_UNALIGNED, CTR_MEM_R32_UNALIGNED_CROSS8, CTR_MEM_R8, CTR_MEM_RI, CTR_MEM_UTLB_HIT, CTR_MEM_UTLB_MISS, CTR_MEM_W16, CTR_MEM_W16_UNALIGNED, CTR_MEM_W16_UNALIGNED_CROSS8, CTR_MEM_W32, CTR_MEM_W32_UNALIGNED, CTR_MEM_W32_UNALIGNED_CROSS8, CTR_MEM_W8, CTR_PREDECODE_FILL, CTR_PREDECODE_FUSED, CTR_PREDECODE_INVAL, CTR_PREDECODE_PAGE_LOOKUP, CTR_PREDECODE_PAGE_NEW
+, COUNTER_MAX };
+static __attribute__((unused)) const char *global_counter_names[] = {
+"CTR_BULK_LOOP", "CTR_CPU_DOZE", "CTR_EXCEPTION_DEC", "CTR_EXCEPTION_FPUN", "CTR_EXCEPTION_IRQ", "CTR_EXCEPTION_MEM", "CTR_EXCEPTION_PROG", "CTR_EXCEPTION_SC", "CTR_IDLE_SKIP", "CTR_INST_ADD", "CTR_INST_ADDC", "CTR_INST_ADDE", "CTR_INST_ADDI", "CTR_INST_ADDIC", "CTR_INST_ADDIC_RC", "CTR_INST_ADDIS", "CTR_INST_ADDME", "CTR_INST_ADDZE", "CTR_INST_AND", "CTR_INST_ANDC", "CTR_INST_ANDIS_RC", "CTR_INST_ANDI_RC", "CTR_INST_B", "CTR_INST_BC", "CTR_INST_BCCTR", "CTR_INST_BCLR", "CTR_INST_BCTR", "CTR_INST_BLR", "CTR_INST_CLRLWI", "CTR_INST_CMP", "CTR_INST_CMPI", "CTR_INST_CMPL", "CTR_INST_CMPLI", "CTR_INST_CNTLZW", "CTR_INST_CRAND", "CTR_INST_CRANDC", "CTR_INST_CREQV", "CTR_INST_CRNAND", "CTR_INST_CRNOR", "CTR_INST_CROR", "CTR_INST_CRORC", "CTR_INST_CRXOR", "CTR_INST_DCBA", "CTR_INST_DCBF", "CTR_INST_DCBI", "CTR_INST_DCBST", "CTR_INST_DCBT", "CTR_INST_DCBTST", "CTR_INST_DCBZ", "CTR_INST_DIVW", "CTR_INST_DIVWU", "CTR_INST_EIEIO", "CTR_INST_EQV", "CTR_INST_EXECUTED", "CTR_INST_EXIT", "CTR_INST_EXTSB", "CTR_INST_EXTSH", "CTR_INST_FABS", "CTR_INST_FADD", "CTR_INST_FADDS", "CTR_INST_FCMPO", "CTR_INST_FCMPU", "CTR_INST_FCTIW", "CTR_INST_FCTIWZ", "CTR_INST_FDIV", "CTR_INST_FDIVS", "CTR_INST_FMADD", "CTR_INST_FMADDS", "CTR_INST_FMR", "CTR_INST_FMSUB", "CTR_INST_FMSUBS", "CTR_INST_FMUL", "CTR_INST_FMULS", "CTR_INST_FNABS", "CTR_INST_FNEG", "CTR_INST_FNMADD", "CTR_INST_FNMADDS", "CTR_INST_FNMSUB", "CTR_INST_FNMSUBS", "CTR_INST_FRES", "CTR_INST_FRSP", "CTR_INST_FRSQRTE", "CTR_INST_FSEL", "CTR_INST_FSQRT", "CTR_INST_FSQRTS", "CTR_INST_FSUB", "CTR_INST_FSUBS", "CTR_INST_ICBI", "CTR_INST_ICBT", "CTR_INST_ISYNC", "CTR_INST_LBZ", "CTR_INST_LBZU", "CTR_INST_LBZUX", "CTR_INST_LBZX", "CTR_INST_LFD", "CTR_INST_LFDU", "CTR_INST_LFDUX", "CTR_INST_LFDX", "CTR_INST_LFS", "CTR_INST_LFSU", "CTR_INST_LFSUX", "CTR_INST_LFSX", "CTR_INST_LHA", "CTR_INST_LHAU", "CTR_INST_LHAUX", "CTR_INST_LHAX", "CTR_INST_LHBRX", "CTR_INST_LHZ", "CTR_INST_LHZU", "CTR_INST_LHZUX", "CTR_INST_LHZX", "CTR_INST_LI", "CTR_INST_LIS", "CTR_INST_LMW", "CTR_INST_LSWI", "CTR_INST_LSWX", "CTR_INST_LWARX", "CTR_INST_LWBRX", "CTR_INST_LWZ", "CTR_INST_LWZU", "CTR_INST_LWZUX", "CTR_INST_LWZX", "CTR_INST_MCRF", "CTR_INST_MCRFS", "CTR_INST_MCRXR", "CTR_INST_MFCR", "CTR_INST_MFFS", "CTR_INST_MFMSR", "CTR_INST_MFSPR", "CTR_INST_MFSR", "CTR_INST_MFSRIN", "CTR_INST_MFTB", "CTR_INST_MR", "CTR_INST_MTCRF", "CTR_INST_MTFSB0", "CTR_INST_MTFSB1", "CTR_INST_MTFSF", "CTR_INST_MTFSFI", "CTR_INST_MTMSR", "CTR_INST_MTSPR", "CTR_INST_MTSR", "CTR_INST_MTSRIN", "CTR_INST_MULHW", "CTR_INST_MULHWU", "CTR_INST_MULLI", "CTR_INST_MULLW", "CTR_INST_NAND", "CTR_INST_NEG", "CTR_INST_NOP", "CTR_INST_NOR", "CTR_INST_OR", "CTR_INST_ORC", "CTR_INST_ORI", "CTR_INST_ORIS", "CTR_INST_RFI", "CTR_INST_RLWIMI", "CTR_INST_RLWINM", "CTR_INST_RLWNM", "CTR_INST_SC", "CTR_INST_SLW", "CTR_INST_SLWI", "CTR_INST_SRAW", "CTR_INST_SRAWI", "CTR_INST_SRW", "CTR_INST_SRWI", "CTR_INST_STB", "CTR_INST_STBU", "CTR_INST_STBUX", "CTR_INST_STBX", "CTR_INST_STFD", "CTR_INST_STFDU", "CTR_INST_STFDUX", "CTR_INST_STFDX", "CTR_INST_STFIWX", "CTR_INST_STFS", "CTR_INST_STFSU", "CTR_INST_STFSUX", "CTR_INST_STFSX", "CTR_INST_STH", "CTR_INST_STHBRX", "CTR_INST_STHU", "CTR_INST_STHUX", "CTR_INST_STHX", "CTR_INST_STMW", "CTR_INST_STRING_LD_ODD", "CTR_INST_STRING_LD_UNALIGNED", "CTR_INST_STRING_ST_ODD", "CTR_INST_STRING_ST_UNALIGNED", "CTR_INST_STSWI", "CTR_INST_STSWX", "CTR_INST_STW", "CTR_INST_STWBRX", "CTR_INST_STWCX", "CTR_INST_STWU", "CTR_INST_STWUX", "CTR_INST_STWX", "CTR_INST_SUBF", "CTR_INST_SUBFC", "CTR_INST_SUBFE", "CTR_INST_SUBFIC", "CTR_INST_SUBFME", "CTR_INST_SUBFZE", "CTR_INST_SYNC", "CTR_INST_TLBIA", "CTR_INST_TLBIE", "CTR_INST_TLBIEL", "CTR_INST_TLBSYNC", "CTR_INST_TW", "CTR_INST_TWI", "CTR_INST_UNK", "CTR_INST_XOR", "CTR_INST_XORI", "CTR_INST_XORIS", "CTR_JIT_BLK_ABANDON", "CTR_JIT_BLK_INVAL", "CTR_JIT_BLK_SPLIT_PAGE", "CTR_JIT_BLOCKS_EXEC", "CTR_JIT_BLOCKS_GEN", "CTR_JIT_CACHE_BLOCKS", "CTR_JIT_CACHE_BYTES", "CTR_JIT_CHAIN_LINK", "CTR_JIT_CHAIN_UNLINK", "CTR_JIT_EVICT_BLOCK", "CTR_JIT_EVICT_REGION", "CTR_JIT_HASH_ENTRIES", "CTR_JIT_HASH_GROW", "CTR_JIT_HASH_HIT_DEEP", "CTR_JIT_HASH_HIT_FIRST", "CTR_JIT_HASH_HIT_SECOND", "CTR_JIT_HASH_MISS", "CTR_JIT_HASH_PROBE", "CTR_JIT_INST_NATIVE", "CTR_JIT_INST_NATIVE_MEM", "CTR_JIT_INVAL_ALL", "CTR_JIT_JC_FLUSH", "CTR_JIT_JC_HIT", "CTR_JIT_JC_MISS", "CTR_JIT_PERSIST_BAD", "CTR_JIT_PERSIST_HIT", "CTR_JIT_PERSIST_RECORDS", "CTR_JIT_PERSIST_SAVE", "CTR_JIT_PERSIST_STALE", "CTR_JIT_RESET_BS", "CTR_JIT_TIER0_CYCLES", "CTR_JIT_TIER0_RUNS", "CTR_JIT_TIER1_COMPILES", "CTR_JIT_TIER1_COMPILE_CYCLES", "CTR_JIT_TIER1_CYCLES", "CTR_JIT_TIER2_COMPILES", "CTR_JIT_TIER2_COMPILE_CYCLES", "CTR_JIT_TIER2_CYCLES", "CTR_JIT_TIER_UP", "CTR_JIT_TRACE_FOLLOW", "CTR_JIT_TRACE_SIDE_EXIT", "CTR_JIT_VENEER", "CTR_MEM_FAST_R", "CTR_MEM_FAST_W", "CTR_MEM_HASH_HIT", "CTR_MEM_HASH_LOOKUP", "CTR_MEM_R16", "CTR_MEM_R16_UNALIGNED", "CTR_MEM_R16_UNALIGNED_CROSS8", "CTR_MEM_R32", "CTR_MEM_R32_UNALIGNED", "CTR_MEM_R32_UNALIGNED_CROSS8", "CTR_MEM_R8", "CTR_MEM_RI", "CTR_MEM_UTLB_HIT", "CTR_MEM_UTLB_MISS", "CTR_MEM_W16", "CTR_MEM_W16_UNALIGNED", "CTR_MEM_W16_UNALIGNED_CROSS8", "CTR_MEM_W32", "CTR_MEM_W32_UNALIGNED", "CTR_MEM_W32_UNALIGNED_CROSS8", "CTR_MEM_W8", "CTR_PREDECODE_FILL", "CTR_PREDECODE_FUSED", "CTR_PREDECODE_INVAL", "CTR_PREDECODE_PAGE_LOOKUP", "CTR_PREDECODE_PAGE_NEW",
+};
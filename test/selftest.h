@@ -0,0 +1,168 @@
+/* Common bits for the self-checking guest tests (*_test.S)
+ *
+ * Copyright 2016-2022 Matt Evans
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Each test starts at 0 (run with "sim -r x_test.bin -L 0"), and ends
+ * with the sim's register dump & exit, r3 being 0 if all went well or
+ * the number of the first check that failed.  An unexpected exception
+ * leaves r3 = its vector.  tools/run_guest_tests.sh runs them.
+ *
+ * The checks use r3, r30 and CTR (not the CR or XER, which the tests
+ * look at), so tests keep their own state out of those.
+ */
+
+#ifndef SELFTEST_H
+#define SELFTEST_H
+
+#define SPR_DEBUG	1023
+
+#define r0	0
+#define r1	1
+#define r2	2
+#define r3	3
+#define r4	4
+#define r5	5
+#define r6	6
+#define r7	7
+#define r8	8
+#define r9	9
+#define r10	10
+#define r11	11
+#define r12	12
+#define r13	13
+#define r14	14
+#define r15	15
+#define r16	16
+#define r17	17
+#define r18	18
+#define r19	19
+#define r20	20
+#define r21	21
+#define r22	22
+#define r23	23
+#define r24	24
+#define r25	25
+#define r26	26
+#define r27	27
+#define r28	28
+#define r29	29
+#define r30	30
+#define r31	31
+
+#define f0	0
+#define f1	1
+#define f2	2
+#define f3	3
+#define f4	4
+#define f5	5
+#define f6	6
+#define f7	7
+#define f8	8
+#define f9	9
+#define f10	10
+#define f11	11
+#define f12	12
+#define f13	13
+#define f14	14
+#define f15	15
+#define f16	16
+#define f17	17
+#define f18	18
+#define f19	19
+#define f20	20
+#define f21	21
+#define f22	22
+#define f23	23
+#define f24	24
+#define f25	25
+#define f26	26
+#define f27	27
+#define f28	28
+#define f29	29
+#define f30	30
+#define f31	31
+
+#define cr0	0
+#define cr1	1
+#define cr2	2
+#define cr3	3
+#define cr4	4
+#define cr5	5
+#define cr6	6
+#define cr7	7
+
+#define INT32(r, i)	lis	(r), (i)@ha ; \
+			addi	(r), (r), (i)@l
+
+/* Fail with r3 = n unless reg == val.  CTR = 1 iff equal, and bdz takes it: */
+#define CHECK(n, reg, val)					\
+			INT32(r30, val) ;			\
+			xor	r30, (reg), r30 ;		\
+			cntlzw	r30, r30 ;			\
+			srwi	r30, r30, 5 ;			\
+			mtctr	r30 ;				\
+			li	r3, (n) ;			\
+			bdz	1f ;				\
+			b	test_fail ;			\
+		1:
+
+/* The vectors, then the pass/fail exit; the test proper starts at
+ * test_start, in .text.
+ */
+#define UNEXPECTED(v)	.org (v) ;				\
+			li	r3, (v) ;			\
+			b	test_fail
+
+/* A test expecting alignment exceptions defines VEC_ALIGN (before including
+ * this) as its own 0x600 vector.
+ */
+#ifndef VEC_ALIGN
+#define VEC_ALIGN	UNEXPECTED(0x600)
+#endif
+
+#define TEST_HEAD						\
+			.section .vectors, "ax" ;		\
+			.globl	_start ;			\
+		_start:						\
+			b	test_start ;			\
+			UNEXPECTED(0x200) ;			\
+			UNEXPECTED(0x300) ;			\
+			UNEXPECTED(0x400) ;			\
+			UNEXPECTED(0x500) ;			\
+			VEC_ALIGN ;				\
+			UNEXPECTED(0x700) ;			\
+			UNEXPECTED(0x800) ;			\
+			UNEXPECTED(0x900) ;			\
+			UNEXPECTED(0xc00) ;			\
+			UNEXPECTED(0xd00) ;			\
+			.org 0x1000 ;				\
+		test_pass:					\
+			li	r3, 0 ;				\
+		test_fail:					\
+			rlwinm	r31, r3, 0, 24, 31 ;		\
+			mtspr	SPR_DEBUG, r31 ;		\
+			b	. ;				\
+			.text
+
+#endif
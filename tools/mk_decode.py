@@ -47,6 +47,10 @@ needs_accessor = ['RA', 'RA0', 'RB', 'RS', 'RT', 'CR', 'CA']
 
 regval_types = { 'RA':'REG', 'RA0':'REG', 'RB':'REG', 'RS':'REG', 'RT':'REG', 'CR':'uint32_t' }
 
+# The op_xxx() implementations are built twice, with and without tracing
+# (trace_variant shadows the one in log.h, which DISASS() etc. test):
+template_prefix = "template <bool trace_variant>"
+
 ################################################################################
 
 
@@ -134,7 +138,7 @@ def gen_fn_caller(name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk,
     else:
         params = ""
         types = ""
-    return "generate_call%s(codeptr, codelen, get_op_%s()%s); return %s" % (types, name, params, rt)
+    return "generate_call%s(codeptr, codelen, OP_ADDR(op_%s)%s); return %s" % (types, name, params, rt)
 
 
 def gen_fn_decl(obj_class, name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk):
@@ -160,7 +164,42 @@ def gen_call(name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk):
         if i != "":
             call_params.append("%s_%s(inst)" % (form, i))
 
-    return "return static_cast<T*>(this)->op_%s(%s)" % (name, ', '.join(call_params))
+    return "return static_cast<T*>(this)->template op_%s<trace_variant>(%s)" % (name, ', '.join(call_params))
+
+
+# Generate predecoder statements, which stash the extracted fields and a thunk
+# pointer into a predecoded_t (see AbstractPPCDecoder.h):
+def gen_predecode(name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk):
+    stmts = []
+    extra_regs = gen_extra_regs(has_rc, has_oe, has_aa, has_lk)
+    for n, i in enumerate([x for x in params_list(in_regs + "," + out_regs + extra_regs) if x != ""]):
+        stmts.append("pd->f[%d] = %s_%s(inst); " % (n, form, i))
+
+    return "%spd->fn = &pd_op_%s<trace_variant>; return" % (''.join(stmts), name)
+
+
+# Generate the thunk that a predecoded_t points to; it calls the real
+# implementation with the stashed fields.  PD_CALL either returns, or (for
+# threaded dispatch) carries on to the next instruction:
+def gen_predecode_fn(name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk):
+    call_params = []
+    extra_regs = gen_extra_regs(has_rc, has_oe, has_aa, has_lk)
+    for n, i in enumerate([x for x in params_list(in_regs + "," + out_regs + extra_regs) if x != ""]):
+        call_params.append("pd->f[%d]" % (n))
+
+    return "%s static RET_TYPE pd_op_%s(T *t, const predecoded_t *pd) { PD_CALL(t, t->template op_%s<trace_variant>(%s)); }" % \
+        (template_prefix, name, name, ', '.join(call_params))
+
+
+# Turn an idiom's match condition (a C expression over field names, e.g.
+# "RA == 0") into one on the instruction, using the form's field accessors:
+def gen_idiom_cond(form, cond):
+    return re.sub(r"\b([A-Z][A-Za-z0-9]*)\b(?!\s*\()", r"%s_\1(inst)" % (form), cond)
+
+
+# Generate an explicit instantiation of one variant of an op_xxx() definition:
+def gen_instantiation(fn_decl, variant):
+    return "template %s;" % (re.sub(r"::(op_\w+)\(", r"::\1<%s>(" % (variant), fn_decl, count = 1))
 
 
 def param_needs_accessor(pname):
@@ -338,6 +377,10 @@ def parse_csv_input(csv_file, cxx_class, verbose = False):
     fn_info = dict()
     # List of fn prototypes:
     proto_list = []
+    # List of predecode thunks:
+    pd_fn_list = []
+    # (Opcode, sub-opcode) to list of idioms, each (condition, call strings):
+    idioms = dict()
 
     for idx, row in enumerate(read_csv(csv_file)):
         name = row['Name']
@@ -358,6 +401,7 @@ def parse_csv_input(csv_file, cxx_class, verbose = False):
         ends_bb = row['End']
         privilege = row['Priv']
         notes = row['Notes']
+        idiom = row['Idiom'] or ''
 
         if form != '' and opcode != '':
             if verbose:
@@ -397,25 +441,52 @@ def parse_csv_input(csv_file, cxx_class, verbose = False):
                                           has_rc, has_oe, has_aa, has_lk,
                                           action, notes, privilege)
             gen_call_str = gen_fn_caller(name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk, ends_bb)
+            pd_str = gen_predecode(name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk)
 
-            if x_opcode != -1:
+            if idiom != '':
+                # An idiom is a special case of another row's encoding
+                # (e.g. mr is or with RS == RB), with its own simpler
+                # handler.  It's tried before the general one:
+                if verbose:
+                    print("\t\t idiom of %d:%d when %s" % (opcode, x_opcode, idiom))
+                key = (opcode, x_opcode)
+                if key not in idioms:
+                    idioms[key] = []
+                idioms[key].append((gen_idiom_cond(form, idiom), call_str, gen_call_str, pd_str))
+            elif x_opcode != -1:
                 # Might've seen this opcode before, add it to the list (held in the dict)
-                opcodes[opcode].append((name, x_opcode, form, call_str, has_oe, gen_call_str))
+                opcodes[opcode].append((name, x_opcode, form, call_str, has_oe, gen_call_str, pd_str))
             else:
                 if len(opcodes[opcode]) != 0:
                     print("WARN:  Row %d (%s) duplicates opcode %d w/o a sub-opcode, ignoring" % (idx, name, opcode))
-                opcodes[opcode] = [(name, None, form, call_str, has_oe, gen_call_str)]
+                opcodes[opcode] = [(name, None, form, call_str, has_oe, gen_call_str, pd_str)]
 
             # Contains flag for action presence so that it can generate into an _auto.cc or regular .cc
             fn_info[classname].append((action != "", fn_decl_str, fn_contents));
             proto_list.append(proto_str)
+            pd_fn_list.append(gen_predecode_fn(name, form, in_regs, out_regs, has_rc, has_oe, has_aa, has_lk))
 
-    return (opcodes, fn_info, proto_list)
+    # Each of the call strings ends in a return, so idioms are just tested
+    # in front of the general case:
+    for opcode in opcodes:
+        for n, (name, x_opcode, form, call_str, has_oe, gen_call_str, pd_str) in enumerate(opcodes[opcode]):
+            key = (opcode, x_opcode if x_opcode != None else -1)
+            if key in idioms:
+                for (cond, i_call_str, i_gen_call_str, i_pd_str) in reversed(idioms.pop(key)):
+                    call_str = "if (%s) { %s; } %s" % (cond, i_call_str, call_str)
+                    gen_call_str = "if (%s) { %s; } %s" % (cond, i_gen_call_str, gen_call_str)
+                    pd_str = "if (%s) { %s; } %s" % (cond, i_pd_str, pd_str)
+                opcodes[opcode][n] = (name, x_opcode, form, call_str, has_oe, gen_call_str, pd_str)
+    for (opcode, x_opcode) in idioms:
+        fatal("Idiom for opcode %d:%d has no general row" % (opcode, x_opcode))
+
+    return (opcodes, fn_info, proto_list, pd_fn_list)
 
 
 def gen_decode_switch(opcodes, verbose = False):
     switch_stmt = "switch(opcode) {\n"
     gen_stmt = switch_stmt
+    pd_stmt = switch_stmt
 
     for f in sorted(opcodes):
         xop_list = sorted(opcodes[f], key = lambda x : x[1])
@@ -424,7 +495,7 @@ def gen_decode_switch(opcodes, verbose = False):
 
         # Singular case might be something like a D-form, or a one-off sub-opcode:
         if len(xop_list) == 1:
-            (name, x_opcode, form, call_str, has_oe, gen_call_str) = xop_list[0]
+            (name, x_opcode, form, call_str, has_oe, gen_call_str, pd_str) = xop_list[0]
             # Major opcode
             if x_opcode == None:
                 if verbose:
@@ -433,6 +504,7 @@ def gen_decode_switch(opcodes, verbose = False):
                 s = "\tcase 0x%03x: /* %d */\t%%s; \tbreak;  /* %s-form */\n" % (f, f, form)
                 switch_stmt += s % (call_str)
                 gen_stmt += s % (gen_call_str)
+                pd_stmt += s % (pd_str)
             else:
                 # Assumes 10-bit opcode!
                 if form != "X":
@@ -442,16 +514,54 @@ def gen_decode_switch(opcodes, verbose = False):
                 s = "\tcase 0x%03x: /* %d */\tif (%s_XOPC(inst) == %s) { %%s; } \tbreak;  /* %s-form */\n" % (f, f, form, x_opcode, form)
                 switch_stmt += s % (call_str)
                 gen_stmt += s % (gen_call_str)
+                pd_stmt += s % (pd_str)
         else:
+            # A-form sub-ops (FP arithmetic) have a 5-bit XO, and share
+            # their opcode with X-form ones whose low 5 bits of XO never
+            # collide.  The 10-bit XO is tried first; every call string
+            # returns, so anything not matched falls through to a second
+            # switch on the 5-bit XO:
+            a_list = [x for x in xop_list if x[2] == "A"]
+            xop_list = [x for x in xop_list if x[2] != "A"]
+
+            s = "\tcase 0x%03x: /* %d */ {\n" % (f, f)
+            switch_stmt += s
+            gen_stmt += s
+            pd_stmt += s
+
+            if len(a_list) > 0:
+                s = "\t\tswitch(A_XOPC(inst)) {\n"
+                for (name, x_opcode, form, call_str, has_oe, gen_call_str, pd_str) in a_list:
+                    if verbose:
+                        print("  Minor %d:\t\t\t %s  %s-form" % (x_opcode, name, form))
+                    s += "\t\t\tcase 0x%03x: /* %d */\t%%s; \tbreak;  /* %s-form */\n" % (x_opcode, x_opcode, form)
+                s += "\t\t\tdefault: break;\n\t\t}\n"
+                a_stmts = [s % tuple(x[3] for x in a_list),
+                           s % tuple(x[5] for x in a_list),
+                           s % tuple(x[6] for x in a_list)]
+            else:
+                a_stmts = ["", "", ""]
+
+            if len(xop_list) == 0:
+                switch_stmt += a_stmts[0]
+                gen_stmt += a_stmts[1]
+                pd_stmt += a_stmts[2]
+                s = "\t} break;\n"
+                switch_stmt += s
+                gen_stmt += s
+                pd_stmt += s
+                continue
+
             # Just want the form.  Assumes all forms are the same within an opcode.
             # This is a mess, FIXME!!
             # Deals with X, XO and nothing else.
-            (name, x_opcode, form, call_str, has_oe, gen_call_str) = xop_list[0]
-            s = "\tcase 0x%03x: /* %d */ {\n\t\tswitch(%s_XOPC(inst)) {\n" % (f, f, form)
+            (name, x_opcode, form, call_str, has_oe, gen_call_str, pd_str) = xop_list[0]
+            s = "\t\tswitch(%s_XOPC(inst)) {\n" % (form)
             switch_stmt += s
             gen_stmt += s
+            pd_stmt += s
 
-            for (name, x_opcode, form, call_str, has_oe, gen_call_str) in xop_list:
+            for (name, x_opcode, form, call_str, has_oe, gen_call_str, pd_str) in xop_list:
                 if x_opcode == None:
                     fatal("Opcode %d sub-instr %s with no x_opcode" % (f, name))
                 else:
@@ -464,28 +574,36 @@ def gen_decode_switch(opcodes, verbose = False):
                         s = "\t\t\tcase 0x%03x: /* %d */\t%%s; \tbreak;  /* %s-form */\n" % (x_opcode, x_opcode, form)
                         switch_stmt += s % (call_str)
                         gen_stmt += s % (gen_call_str)
+                        pd_stmt += s % (pd_str)
                     elif form == "XO": # has_oe 1
                         # Hack, just pipe both OE values (bit 21/10) into this fn
                         s = "\t\t\tcase 0x%03x: /* %d */\n" % (x_opcode, x_opcode)
                         s += "\t\t\tcase 0x%03x: /* %d */\t%%s; \tbreak;  /* %s-form */\n" % (x_opcode | 0x200, x_opcode | 0x400, form)
                         switch_stmt += s % (call_str)
                         gen_stmt += s % (gen_call_str)
+                        pd_stmt += s % (pd_str)
                     else:
                         fatal("Opcode %d sub-instr %s (op %d) form %s unsupported!" % (f, name, x_opcode, form))
-            s = "\t\t\tdefault: break;\n\t\t}\n\t} break;\n"
+            s = "\t\t\tdefault: break;\n\t\t}\n"
+            switch_stmt += s + a_stmts[0]
+            gen_stmt += s + a_stmts[1]
+            pd_stmt += s + a_stmts[2]
+            s = "\t} break;\n"
             switch_stmt += s
             gen_stmt += s
+            pd_stmt += s
 
     s = "}\n"
     switch_stmt += s
     gen_stmt += s
-    return (switch_stmt, gen_stmt)
+    pd_stmt += s
+    return (switch_stmt, gen_stmt, pd_stmt)
 
 
 def help():
     print("Syntax: this.py -c <classname> [-v] [-i \"#include <foo.h>\"] [] [-d DecoderFile.h] " \
           "[-p ProtosFile.h] [-P ProtosFile.h] [-a AutoGenOutputFile.cc] [-m ManualDir/Path_%s.cc] " \
-          "[-g GenFns.h] <defs.csv>")
+          "[-g GenFns.h] [-D PredecoderFile.h] [-T PredecodeFns.h] [-I InstantiationsFile.h] <defs.csv>")
     print("\t-h\t\t- Help")
     print("\t-v\t\t- Verbose")
     print("\t-c \"Classname\"\t- Class name for function implementations")
@@ -496,6 +614,9 @@ def help():
     print("\t-a <file>\t- Auto-generate implementation functions to file")
     print("\t-m <path>\t- Output auto-generated manual functions to files at path")
     print("\t-g <file>\t- Auto-generate codegen functions to file")
+    print("\t-D <file>\t- Output predecoder to file")
+    print("\t-T <file>\t- Output predecode thunk functions to file")
+    print("\t-I <file>\t- Output per-class instantiation macros (for manual functions) to file")
 
 
 ################################################################################
@@ -515,9 +636,12 @@ autogen_file = ""
 mangen_path = ""
 include_string = ""
 generator_file = ""
+predecoder_file = ""
+pd_fns_file = ""
+inst_file = ""
 
 try:
-    opts, args = getopt.getopt(sys.argv[1:], "hvc:i:d:p:P:a:m:g:")
+    opts, args = getopt.getopt(sys.argv[1:], "hvc:i:d:p:P:a:m:g:D:T:I:")
 except getopt.GetoptError as err:
     help()
     fatal("Invocation error: " + str(err))
@@ -544,6 +668,12 @@ for o, a in opts:
         mangen_path = a
     elif o == "-g":
         generator_file = a
+    elif o == "-D":
+        predecoder_file = a
+    elif o == "-T":
+        pd_fns_file = a
+    elif o == "-I":
+        inst_file = a
     else:
         help()
         fatal("Unknown option?")
@@ -563,9 +693,9 @@ else:
 
 # Do the work:
 
-(opcodes, fn_info, proto_list) = parse_csv_input(input_file, classname, verbose)
+(opcodes, fn_info, proto_list, pd_fn_list) = parse_csv_input(input_file, classname, verbose)
 
-(switch_stmt, gen_stmt) = gen_decode_switch(opcodes, verbose)
+(switch_stmt, gen_stmt, pd_stmt) = gen_decode_switch(opcodes, verbose)
 
 ################################################################################
 
@@ -579,6 +709,17 @@ if generator_file:
     with open(generator_file, "w") as output:
         output.write(gen_stmt)
 
+if predecoder_file:
+    print("Writing predecode table to %s" % (predecoder_file))
+    with open(predecoder_file, "w") as output:
+        output.write(pd_stmt)
+
+if pd_fns_file:
+    print("Writing predecode thunks to %s" % (pd_fns_file))
+    with open(pd_fns_file, "w") as output:
+        for f in pd_fn_list:
+            output.write("%s\n" % (f))
+
 if virt_protos_file:
     print("Writing virtual prototypes to %s" % (virt_protos_file))
     with open(virt_protos_file, "w") as output:
@@ -589,9 +730,9 @@ if protos_file:
     print("Writing non-virtual prototypes to %s" % (protos_file))
     with open(protos_file, "w") as output:
         for f in proto_list:
-            output.write("%s;\n" % (f))
+            output.write("%s %s;\n" % (template_prefix, f))
 
-if mangen_path or autogen_file:
+if mangen_path or autogen_file or inst_file:
     auto_file = []
     manu_files = dict()
 
@@ -615,7 +756,22 @@ if mangen_path or autogen_file:
             output.write("\n\n/*****************************************************************************/\n\n")
             for p in auto_file:
                 (proto, contents) = p
-                output.write("%s\n{\n%s}\n\n" % (proto, contents))
+                output.write("%s\n%s\n{\n%s}\n\n" % (template_prefix, proto, contents))
+            for v in ["true", "false"]:
+                for p in auto_file:
+                    (proto, contents) = p
+                    output.write("%s\n" % (gen_instantiation(proto, v)))
+
+    if inst_file:
+        print("Writing instantiation macros to %s" % (inst_file))
+
+        with open(inst_file, "w") as output:
+            for c in sorted(manu_files):
+                output.write("#define INSTANTIATE_OPS_%s(v)" % (c))
+                for p in manu_files[c]:
+                    (proto, contents) = p
+                    output.write(" \\\n\t%s" % (gen_instantiation(proto, "v")))
+                output.write("\n\n")
 
     if mangen_path:
         for c in sorted(manu_files):
@@ -629,6 +785,6 @@ if mangen_path or autogen_file:
 
                     for p in fn_list:
                         (proto, contents) = p
-                        output.write("%s\n{\n%s}\n\n" % (proto, contents))
+                        output.write("%s\n%s\n{\n%s}\n\n" % (template_prefix, proto, contents))
 
 ################################################################################
@@ -0,0 +1,75 @@
+#!/bin/bash
+#
+# Copyright 2016-2022 Matt Evans
+#
+# Permission is hereby granted, free of charge, to any person
+# obtaining a copy of this software and associated documentation files
+# (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge,
+# publish, distribute, sublicense, and/or sell copies of the Software,
+# and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+# BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+# ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# Runs the self-checking guest tests (test/*_test.bin, see test/selftest.h),
+# which finish with r3 = 0 or the number of the check that failed.
+#
+# With "-c <other sim>", the final registers and instruction count must
+# also be the same as from another build of the sim, e.g. one made with
+# LAZY_FLAGS=0, so that shortcuts are seen to end up exactly where running
+# the guest code plainly would.
+
+SIM=./sim
+OTHER=
+
+while getopts "s:c:" opt; do
+    case $opt in
+	s) SIM=$OPTARG ;;
+	c) OTHER=$OPTARG ;;
+	*) echo "this.sh [-s sim] [-c other_sim] [tests.bin...]"; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+TESTS=$*
+if [ -z "$TESTS" ] ; then
+    TESTS=`ls test/*_test.bin`
+fi
+
+# Registers from the exit dump, and the final Icount:
+state() {
+    $1 -r $2 -L 0 -l 100000000 2>&1 | grep -a -E "^(GPR[0-9]+|CR|LR|CTR|XER) |Icount [0-9a-f]*[1-9a-f]"
+}
+
+FAILS=0
+TF=`mktemp`
+for i in $TESTS; do
+    state $SIM $i > $TF
+    r3=`grep -a "^GPR3 " $TF | cut -d' ' -f2`
+    if [ -z "$r3" ] ; then
+	echo "$i: FAIL (no exit)"
+	FAILS=$((FAILS + 1))
+    elif [ $((16#$r3)) -ne 0 ] ; then
+	echo "$i: FAIL at check $((16#$r3))"
+	FAILS=$((FAILS + 1))
+    elif [ -n "$OTHER" ] && ! state $OTHER $i | diff -u $TF - ; then
+	echo "$i: FAIL (differs from $OTHER)"
+	FAILS=$((FAILS + 1))
+    else
+	echo "$i: pass"
+    fi
+done
+rm $TF
+
+exit $((FAILS != 0))
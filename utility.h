@@ -38,6 +38,9 @@
 #define likely(x)      __builtin_expect(!!(x), 1)
 #define unlikely(x)    __builtin_expect(!!(x), 0)
 
+#define MIN(x, y)	((x) < (y) ? (x) : (y))
+#define MAX(x, y)	((x) > (y) ? (x) : (y))
+
 #define ALIGN_TO(x, y)	(((uint64_t)(x) + ((y)-1)) & ~(uint64_t)((y)-1))
 
 #endif